@@ -0,0 +1,147 @@
+// ECEFToGeoConverter の精度プリセットごとの処理時間（単点・一括）と
+// 最悪誤差を計測する
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "converter/ECEF_to_geo_converter.hpp"  // ECEFToGeoConverter の定義
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "coordinate/ECEF_coordinate.hpp"       // ECEFCoordinate の定義
+#include "coordinate/geo_coordinate.hpp"        // GeoCoordinate の定義
+#include "ellipsoid/ellipsoid.hpp"              // Ellipsoid 構造体の定義
+#include "utils/utils.hpp"
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+namespace {
+/// 誤差を集計する高度帯の上限（メートル）
+constexpr double kAltitudeBands[] = {10e3, 100e3, 1000e3, 40000e3};
+constexpr std::size_t kBandCount = std::size(kAltitudeBands);
+
+struct Sample {
+  double lat;  ///< 真値の緯度（度）
+  double h;    ///< 真値の楕円体高（メートル）
+  ECEFCoordinate ecef;
+};
+
+/**
+ * @brief 決定的なデータセット（緯度 0.05° 刻み × 高度帯ごとに 40 段）を生成する
+ */
+std::vector<Sample> makeDataset() {
+  GeoToECEFConverter toEcef(WGS84);
+  std::vector<Sample> samples;
+  double lower = -1e3;
+  for (double upper : kAltitudeBands) {
+    for (int i = 0; i <= 3600; ++i) {
+      double lat = -90.0 + 0.05 * i;
+      for (int k = 0; k < 40; ++k) {
+        double h = lower + (upper - lower) * k / 39.0;
+        auto result = toEcef.convert(GeoCoordinate(lat, 12.5, h));
+        samples.push_back(
+            {lat, h, *dynamic_cast<ECEFCoordinate*>(result.get())});
+      }
+    }
+    lower = upper;
+  }
+  return samples;
+}
+
+const char* presetName(GeodeticPrecision precision) {
+  switch (precision) {
+    case GeodeticPrecision::Reference:
+      return "Reference";
+    case GeodeticPrecision::Micrometre:
+      return "Micrometre";
+    case GeodeticPrecision::Millimetre:
+      return "Millimetre";
+    case GeodeticPrecision::Decimetre:
+      return "Decimetre";
+  }
+  return "?";
+}
+
+/**
+ * @brief 最小処理時間（ナノ秒/点）を 3 回の計測から求める
+ */
+template <typename F>
+double bestNanosecondsPerPoint(std::size_t points, F&& run) {
+  double best = 1e300;
+  for (int rep = 0; rep < 3; ++rep) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    best = std::min(
+        best,
+        std::chrono::duration<double, std::nano>(elapsed).count() / points);
+  }
+  return best;
+}
+}  // namespace
+
+int main() {
+  std::vector<Sample> samples = makeDataset();
+  // 一括変換用の AoS 配列
+  std::vector<double> ecefValues;
+  ecefValues.reserve(samples.size() * 3);
+  for (const Sample& s : samples) {
+    ecefValues.insert(ecefValues.end(),
+                      {s.ecef.getX(), s.ecef.getY(), s.ecef.getZ()});
+  }
+  std::vector<double> geoValues(ecefValues.size());
+
+  std::printf("%zu points, WGS84\n\n", samples.size());
+  std::printf("%-11s %10s %9s %10s", "preset", "ns/point", "speedup",
+              "batch");
+  for (double band : kAltitudeBands) {
+    char label[32];
+    std::snprintf(label, sizeof(label), "h<=%.0fkm", band / 1e3);
+    std::printf("  %12s", label);
+  }
+  std::printf("\n");
+
+  double referenceNs = 0.0;
+  for (GeodeticPrecision precision :
+       {GeodeticPrecision::Reference, GeodeticPrecision::Micrometre,
+        GeodeticPrecision::Millimetre, GeodeticPrecision::Decimetre}) {
+    ECEFToGeoConverter converter(WGS84, precision);
+
+    // 誤差: 緯度方向の位置誤差と高度誤差の大きい方（メートル）
+    double worst[kBandCount] = {};
+    for (const Sample& s : samples) {
+      auto result = converter.convert(s.ecef);
+      auto* geo = dynamic_cast<GeoCoordinate*>(result.get());
+      double dLat = trans_geo::utils::degToRad(geo->getLatitude() - s.lat) *
+                    (WGS84.a + s.h);
+      double dH = geo->getAltitude().value_or(0.0) - s.h;
+      double err = std::max(std::fabs(dLat), std::fabs(dH));
+      for (std::size_t b = 0; b < kBandCount; ++b) {
+        if (s.h <= kAltitudeBands[b]) worst[b] = std::max(worst[b], err);
+      }
+    }
+
+    // 処理時間（3 回計測した最小値）
+    double sink = 0.0;
+    double best = bestNanosecondsPerPoint(samples.size(), [&] {
+      for (const Sample& s : samples) {
+        sink += converter.convert(s.ecef)->getValueArray()[0];
+      }
+    });
+    double batch = bestNanosecondsPerPoint(samples.size(), [&] {
+      converter.convertBatch(
+          ConstPointView::interleaved(ecefValues.data(), samples.size()),
+          PointView::interleaved(geoValues.data(), samples.size()));
+      sink += geoValues[0];
+    });
+    if (precision == GeodeticPrecision::Reference) referenceNs = best;
+
+    std::printf("%-11s %10.1f %8.2fx %10.1f", presetName(precision), best,
+                referenceNs / best, batch);
+    for (double w : worst) std::printf("  %12.2e", w);
+    std::printf("%s\n", sink == 0.123 ? " " : "");
+  }
+  return 0;
+}
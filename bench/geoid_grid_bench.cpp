@@ -0,0 +1,121 @@
+// ジオイド高の格子（全球 5' 格子、約 37 MB）の読み込み時間と、
+// 1 点ずつ／一括の補間、標高を扱う Geo→ECEF 変換の処理時間を計測する
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "coordinate/point_buffer.hpp"          // PointBuffer の定義
+#include "geoid/geoid_grid.hpp"                 // GeoidGrid の定義
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+using namespace trans_geo::geoid;
+
+namespace {
+constexpr std::size_t kPoints = 1000000;
+
+/**
+ * @brief 最小処理時間（ナノ秒/点）を 3 回の計測から求める
+ */
+template <typename F>
+double bestNanosecondsPerPoint(F&& run) {
+  double best = 1e300;
+  for (int rep = 0; rep < 3; ++rep) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    best = std::min(
+        best,
+        std::chrono::duration<double, std::nano>(elapsed).count() / kPoints);
+  }
+  return best;
+}
+}  // namespace
+
+int main() {
+  // EGM 風の滑らかな全球格子を生成してファイルに書き出す
+  GeoidGridLayout layout{-90.0, -180.0, 1.0 / 12.0, 1.0 / 12.0, 2161, 4321};
+  std::vector<float> values(std::size_t{layout.rows} * layout.columns);
+  for (std::uint32_t r = 0; r < layout.rows; ++r) {
+    double lat = (layout.south + r * layout.latitudeSpacing) * M_PI / 180.0;
+    for (std::uint32_t c = 0; c < layout.columns; ++c) {
+      double lon = (layout.west + c * layout.longitudeSpacing) * M_PI / 180.0;
+      values[std::size_t{r} * layout.columns + c] = static_cast<float>(
+          40.0 * std::cos(lat) * std::sin(2.0 * lon) + 15.0 * std::sin(lat));
+    }
+  }
+  std::string path = "/tmp/transgeo_geoid_bench.gtx";
+  {
+    std::vector<std::byte> bytes = serializeGtx(layout, values);
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(bytes.data()),
+              static_cast<std::streamsize>(bytes.size()));
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  auto grid = std::make_shared<const GeoidGrid>(path);
+  double openMicroseconds = std::chrono::duration<double, std::micro>(
+                                std::chrono::steady_clock::now() - start)
+                                .count();
+
+  std::mt19937_64 rng(1);
+  std::uniform_real_distribution<double> lat(-85.0, 85.0);
+  std::uniform_real_distribution<double> lon(-180.0, 180.0);
+  PointBuffer geo(kPoints);
+  for (std::size_t i = 0; i < kPoints; ++i) {
+    geo.view().set(i, {lat(rng), lon(rng), 100.0});
+  }
+  std::vector<double> undulation(kPoints);
+
+  double sink = 0.0;
+  double scalarBilinear = bestNanosecondsPerPoint([&] {
+    for (std::size_t i = 0; i < kPoints; ++i) {
+      undulation[i] = grid->undulation(geo.view()(i, 0), geo.view()(i, 1));
+    }
+    sink += undulation.back();
+  });
+  double batchBilinear = bestNanosecondsPerPoint([&] {
+    grid->undulations(geo.view(), undulation);
+    sink += undulation.back();
+  });
+  double batchBicubic = bestNanosecondsPerPoint([&] {
+    grid->undulations(geo.view(), undulation, GeoidInterpolation::Bicubic);
+    sink += undulation.back();
+  });
+
+  PointBuffer ecef(kPoints);
+  GeoToECEFConverter ellipsoidal(WGS84);
+  GeoToECEFConverter orthometric(WGS84, grid);
+  double convertEllipsoidal = bestNanosecondsPerPoint([&] {
+    ellipsoidal.convertBatch(geo.view(), ecef.view());
+    sink += ecef.view()(kPoints - 1, 0);
+  });
+  double convertOrthometric = bestNanosecondsPerPoint([&] {
+    orthometric.convertBatch(geo.view(), ecef.view());
+    sink += ecef.view()(kPoints - 1, 0);
+  });
+  std::remove(path.c_str());
+
+  std::printf("grid %u x %u (%.1f MB), open %.1f us\n", layout.rows,
+              layout.columns, values.size() * 4.0 / 1e6, openMicroseconds);
+  std::printf("%zu random points\n\n", kPoints);
+  std::printf("%-34s %10s\n", "operation", "ns/point");
+  std::printf("%-34s %10.1f\n", "undulation() bilinear, per point",
+              scalarBilinear);
+  std::printf("%-34s %10.1f\n", "undulations() bilinear, batch",
+              batchBilinear);
+  std::printf("%-34s %10.1f\n", "undulations() bicubic, batch", batchBicubic);
+  std::printf("%-34s %10.1f\n", "GeoToECEF ellipsoidal height",
+              convertEllipsoidal);
+  std::printf("%-34s %10.1f\n", "GeoToECEF orthometric height",
+              convertOrthometric);
+  return sink == 0.123 ? 1 : 0;
+}
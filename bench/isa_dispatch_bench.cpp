@@ -0,0 +1,102 @@
+// 一括変換カーネルの命令セットごとの版（generic / avx2 / avx512）の処理時間を
+// 同じマシンで比較する
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "converter/ENU_frame.hpp"      // ENUFrame の定義
+#include "coordinate/point_buffer.hpp"  // PointBuffer の定義
+#include "kernel/batch_dispatch.hpp"    // batchKernelsFor の定義
+#include "sample_points.hpp"            // ベンチマーク用の決定的な点列
+
+using namespace trans_geo::bench;
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+using namespace trans_geo::kernel;
+
+namespace {
+constexpr std::size_t kPoints = 1000000;
+
+/**
+ * @brief 最小処理時間（ナノ秒/点）を 5 回の計測から求める
+ */
+template <typename F>
+double bestNanosecondsPerPoint(F&& run) {
+  double best = 1e300;
+  for (int rep = 0; rep < 5; ++rep) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    best = std::min(
+        best,
+        std::chrono::duration<double, std::nano>(elapsed).count() / kPoints);
+  }
+  return best;
+}
+}  // namespace
+
+int main() {
+  // 日本周辺の決定的な緯度・経度・高度
+  PointBuffer geo =
+      geoSamples(kPoints, {30.0, 45.0}, {128.0, 146.0}, {0.0, 3000.0});
+  PointBuffer ecef(kPoints);
+  PointBuffer out(kPoints);
+  batchKernelsFor(Isa::Generic)
+      ->geoToEcef(WGS84, makeBatchSpan(geo.view(), ecef.view()));
+
+  // 同じ点列を AoS（x, y, z の繰り返し）でも用意する
+  std::vector<double> ecefAos(3 * kPoints);
+  std::vector<double> outAos(3 * kPoints);
+  for (std::size_t i = 0; i < kPoints; ++i) {
+    for (std::size_t k = 0; k < 3; ++k) {
+      ecefAos[3 * i + k] = ecef.component(k)[i];
+    }
+  }
+  ConstPointView ecefAosView =
+      ConstPointView::interleaved(ecefAos.data(), kPoints);
+  PointView outAosView = PointView::interleaved(outAos.data(), kPoints);
+
+  ENUFrame frame(WGS84, GeoCoordinate(35.0, 139.0, 0.0));
+  const double* R = frame.getRotation().data();
+  const double* p0 = frame.getOriginECEF().data();
+  double radiusSquared = (WGS84.b + 100e3) * (WGS84.b + 100e3);
+
+  std::printf("%zu points, selected: %s (TRANSGEO_FORCE_ISA で変更可)\n\n",
+              kPoints, isaName(batchKernels().isa));
+  std::printf("%-8s %12s %12s %14s %14s\n", "isa", "Geo->ECEF", "ECEF->Geo",
+              "ECEF->ENU SoA", "ECEF->ENU AoS");
+  double generic[4] = {};
+  for (Isa isa : {Isa::Generic, Isa::Avx2, Isa::Avx512}) {
+    const BatchKernels* kernels = batchKernelsFor(isa);
+    if (kernels == nullptr) {
+      std::printf("%-8s %12s\n", isaName(isa), "unsupported");
+      continue;
+    }
+    double ns[4] = {
+        bestNanosecondsPerPoint([&] {
+          kernels->geoToEcef(WGS84, makeBatchSpan(geo.view(), out.view()));
+        }),
+        bestNanosecondsPerPoint([&] {
+          kernels->ecefToGeo(WGS84, radiusSquared,
+                             makeBatchSpan(ecef.view(), out.view()));
+        }),
+        bestNanosecondsPerPoint([&] {
+          kernels->ecefToEnu(R, p0, makeBatchSpan(ecef.view(), out.view()));
+        }),
+        bestNanosecondsPerPoint([&] {
+          kernels->ecefToEnu(R, p0, makeBatchSpan(ecefAosView, outAosView));
+        })};
+    if (isa == Isa::Generic) {
+      std::copy(ns, ns + 4, generic);
+    }
+    std::printf("%-8s", isaName(isa));
+    for (int k = 0; k < 4; ++k) {
+      std::printf(" %7.2f (%.2fx)", ns[k], generic[k] / ns[k]);
+    }
+    std::printf("\n");
+  }
+  std::printf("\n(ns/point、括弧内は generic 比)\n");
+  return out.component(0)[kPoints / 2] + outAos[kPoints / 2] == 0.123 ? 1 : 0;
+}
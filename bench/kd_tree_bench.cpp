@@ -0,0 +1,94 @@
+// KD 木の構築と k 近傍・半径探索のスループットを計測する
+// 使い方: kd_tree_bench [点数]（既定は 1000 万点）
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "coordinate/point_buffer.hpp"          // PointBuffer の定義
+#include "spatial/kd_tree.hpp"                  // KdTree の定義
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+using namespace trans_geo::spatial;
+
+namespace {
+constexpr std::size_t kQueries = 1000000;
+constexpr std::size_t kRadiusQueries = 100000;
+constexpr std::size_t kNeighbors = 8;
+constexpr double kRadius = 500.0;
+
+/**
+ * @brief 日本付近の地表に散らばる点を ECEF で生成する
+ */
+PointBuffer randomPoints(std::size_t n, unsigned seed) {
+  std::mt19937_64 rng(seed);
+  std::uniform_real_distribution<double> lat(30.0, 45.0);
+  std::uniform_real_distribution<double> lon(130.0, 145.0);
+  std::uniform_real_distribution<double> h(0.0, 3000.0);
+  PointBuffer points(n);
+  PointView view = points.view();
+  for (std::size_t i = 0; i < n; ++i) {
+    view.set(i, {lat(rng), lon(rng), h(rng)});
+  }
+  GeoToECEFConverter(WGS84).convertBatch(view, view);
+  return points;
+}
+
+template <typename F>
+double seconds(F&& run) {
+  auto start = std::chrono::steady_clock::now();
+  run();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double>(elapsed).count();
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                               : std::size_t{10000000};
+  PointBuffer points = randomPoints(count, 1);
+  PointBuffer queries = randomPoints(kQueries, 2);
+  unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+  double sink = 0.0;
+  std::optional<KdTree> tree;
+  double build = seconds([&] { tree.emplace(points.view()); });
+
+  std::vector<Neighbor> result(kQueries * kNeighbors);
+  double serial = seconds(
+      [&] { tree->nearestBatch(queries.view(), kNeighbors, result, 1); });
+  sink += result.back().distance;
+  double parallel = seconds(
+      [&] { tree->nearestBatch(queries.view(), kNeighbors, result, threads); });
+  sink += result.back().distance;
+
+  std::vector<Neighbor> within;
+  std::size_t found = 0;
+  double radius = seconds([&] {
+    for (std::size_t i = 0; i < kRadiusQueries; ++i) {
+      tree->withinRadius(queries.view().get(i), kRadius, within);
+      found += within.size();
+    }
+  });
+
+  std::printf("%zu points, leaf size %zu, %u hardware threads\n\n", count,
+              kDefaultLeafSize, threads);
+  std::printf("%-30s %12s %14s\n", "operation", "seconds", "per second");
+  std::printf("%-30s %12.3f %12.2f M\n", "build", build,
+              count / build / 1e6);
+  std::printf("%-30s %12.3f %12.2f M\n", "k-NN (k=8), 1 thread", serial,
+              kQueries / serial / 1e6);
+  std::printf("%-30s %12.3f %12.2f M\n", "k-NN (k=8), all threads", parallel,
+              kQueries / parallel / 1e6);
+  std::printf("%-30s %12.3f %12.2f M   (%.1f hits/query)\n",
+              "radius (500 m)", radius, kRadiusQueries / radius / 1e6,
+              static_cast<double>(found) / kRadiusQueries);
+  return sink == 0.123 ? 1 : 0;
+}
@@ -0,0 +1,97 @@
+// 仮想関数経由の一括変換と、インライン展開したカーネルのループの処理時間を比較する
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "converter/ECEF_to_ENU_converter.hpp"  // ECEFToENUConverter の定義
+#include "converter/ENU_frame.hpp"              // ENUFrame の定義
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "coordinate/point_buffer.hpp"          // PointBuffer の定義
+#include "kernel/enu.hpp"                       // ecefToEnu の定義
+#include "kernel/geodetic.hpp"                  // geoToEcef の定義
+#include "sample_points.hpp"                    // ベンチマーク用の決定的な点列
+
+using namespace trans_geo::bench;
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+namespace {
+constexpr std::size_t kPoints = 1000000;
+
+/**
+ * @brief 最小処理時間（ナノ秒/点）を 5 回の計測から求める
+ */
+template <typename F>
+double bestNanosecondsPerPoint(F&& run) {
+  double best = 1e300;
+  for (int rep = 0; rep < 5; ++rep) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    best = std::min(
+        best,
+        std::chrono::duration<double, std::nano>(elapsed).count() / kPoints);
+  }
+  return best;
+}
+
+void report(const char* name, double virtualBatch, double inlined) {
+  std::printf("%-12s %14.2f %14.2f %8.2fx\n", name, virtualBatch, inlined,
+              virtualBatch / inlined);
+}
+}  // namespace
+
+int main() {
+  // 日本周辺の決定的な緯度・経度・高度
+  PointBuffer geo =
+      geoSamples(kPoints, {30.0, 45.0}, {128.0, 146.0}, {0.0, 3000.0});
+  PointBuffer ecef(kPoints);
+  PointBuffer enu(kPoints);
+
+  // Geo → ECEF
+  GeoToECEFConverter toEcef(WGS84);
+  double geoVirtual = bestNanosecondsPerPoint(
+      [&] { toEcef.convertBatch(geo.view(), ecef.view()); });
+  double geoInline = bestNanosecondsPerPoint([&] {
+    const double* lat = geo.component(0).data();
+    const double* lon = geo.component(1).data();
+    const double* h = geo.component(2).data();
+    PointView out = ecef.view();
+    for (std::size_t i = 0; i < kPoints; ++i) {
+      out.set(i, trans_geo::kernel::geoToEcef(WGS84, lat[i], lon[i], h[i]));
+    }
+  });
+
+  // ECEF → ENU
+  GeoCoordinate origin(35.0, 139.0, 0.0);
+  ECEFToENUConverter toEnu(WGS84, origin);
+  ENUFrame frame(WGS84, origin);
+  double enuVirtual = bestNanosecondsPerPoint(
+      [&] { toEnu.convertBatch(ecef.view(), enu.view()); });
+  double enuInline = bestNanosecondsPerPoint([&] {
+    const std::array<double, 9> R = frame.getRotation();
+    const std::array<double, 3> p0 = frame.getOriginECEF();
+    const double* x = ecef.component(0).data();
+    const double* y = ecef.component(1).data();
+    const double* z = ecef.component(2).data();
+    double* e = enu.view().component(0);
+    double* n = enu.view().component(1);
+    double* u = enu.view().component(2);
+    for (std::size_t i = 0; i < kPoints; ++i) {
+      std::array<double, 3> out =
+          trans_geo::kernel::ecefToEnu(R, p0, {x[i], y[i], z[i]});
+      e[i] = out[0];
+      n[i] = out[1];
+      u[i] = out[2];
+    }
+  });
+
+  std::printf("%zu points (SoA)\n\n", kPoints);
+  std::printf("%-12s %14s %14s %9s\n", "conversion", "convertBatch",
+              "inline kernel", "speedup");
+  report("Geo->ECEF", geoVirtual, geoInline);
+  report("ECEF->ENU", enuVirtual, enuInline);
+  return enu.component(0)[kPoints / 2] == 0.123 ? 1 : 0;
+}
@@ -0,0 +1,104 @@
+// NumaExecutor による大きな点列の一括変換の処理量を NUMA ノードごとに表示し、
+// 1 スレッドの convertBatch と比較する
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "converter/ECEF_to_geo_converter.hpp"  // ECEFToGeoConverter の定義
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "coordinate/point_buffer.hpp"          // PointBuffer の定義
+#include "parallel/numa_executor.hpp"           // NumaExecutor の定義
+#include "parallel/numa_point_buffer.hpp"       // NumaPointBuffer の定義
+#include "sample_points.hpp"                    // ベンチマーク用の決定的な点列
+
+using namespace trans_geo::bench;
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+using namespace trans_geo::parallel;
+
+namespace {
+/**
+ * @brief 最小処理時間（ナノ秒/点）を 5 回の計測から求める
+ */
+template <typename F>
+double bestNanosecondsPerPoint(std::size_t points, F&& run) {
+  double best = 1e300;
+  for (int rep = 0; rep < 5; ++rep) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    best = std::min(
+        best,
+        std::chrono::duration<double, std::nano>(elapsed).count() / points);
+  }
+  return best;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  // 点数は引数で変更できる（既定は 1600 万点、入出力で 768 MiB）
+  std::size_t points = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                                : std::size_t{1} << 24;
+
+  NumaExecutor executor;
+  const NumaTopology& topology = executor.getTopology();
+  std::printf("%zu points, %zu node(s), libnuma: %s\n", points,
+              topology.getNodes().size(),
+              topology.usesLibnuma() ? "yes" : "no (plain threads)");
+  for (std::size_t n = 0; n < topology.getNodes().size(); ++n) {
+    std::printf("  node %d: %zu cpu(s), %zu thread(s)\n",
+                topology.getNodes()[n].id,
+                topology.getNodes()[n].cpus.size(),
+                executor.getThreadCount(n));
+  }
+
+  // 日本周辺の決定的な緯度・経度・高度
+  PointBuffer geo =
+      geoSamples(points, {30.0, 45.0}, {128.0, 146.0}, {0.0, 3000.0});
+  NumaPointBuffer input(executor, points);
+  NumaPointBuffer output(executor, points);
+  input.assign(geo.view());
+  PointBuffer serialOut(points);
+
+  GeoToECEFConverter toEcef(WGS84);
+  ECEFToGeoConverter toGeo(WGS84, GeodeticPrecision::Millimetre);
+  NumaPointBuffer ecef(executor, points);
+  executor.convert(toEcef, input, ecef);
+  PointBuffer serialEcef(points);
+  ecef.copyTo(serialEcef.view());
+
+  std::printf("\n%-12s %14s %14s %8s\n", "converter", "serial ns/pt",
+              "numa ns/pt", "speedup");
+  struct Case {
+    const char* name;
+    const ICoordinateConverter& converter;
+    const NumaPointBuffer& numaInput;
+    const PointBuffer& serialInput;
+  };
+  for (const Case& c : {Case{"Geo->ECEF", toEcef, input, geo},
+                        Case{"ECEF->Geo", toGeo, ecef, serialEcef}}) {
+    double serial = bestNanosecondsPerPoint(points, [&] {
+      c.converter.convertBatch(c.serialInput.view(), serialOut.view());
+    });
+    NumaRunReport best;
+    double numa = bestNanosecondsPerPoint(points, [&] {
+      NumaRunReport report = executor.convert(c.converter, c.numaInput, output);
+      if (best.seconds == 0.0 || report.seconds < best.seconds) {
+        best = report;
+      }
+    });
+    std::printf("%-12s %14.2f %14.2f %7.2fx\n", c.name, serial, numa,
+                serial / numa);
+    for (const NodeThroughput& node : best.nodes) {
+      std::printf("  node %d: %zu threads, %zu points, %.1f Mpoints/s\n",
+                  node.node, node.threads, node.points,
+                  node.pointsPerSecond / 1e6);
+    }
+  }
+  return output.get(points / 2)[0] + serialOut.component(0)[points / 2] ==
+                 0.123
+             ? 1
+             : 0;
+}
@@ -0,0 +1,360 @@
+// 各変換器の一括変換のスループット（点/秒）を固定のデータセットで計測し、
+// CPU の機種ごとに保存したベースライン（JSON）と比較する。
+// しきい値を超えて低下した変換器があれば差分を表示して 1 を返す。
+//
+//   perf_regression [--baseline-dir DIR] [--threshold 0.10]
+//                   [--repetitions N] [--update-baseline]
+//
+// test.sh --perf から呼び出す。ベースラインがない CPU では計測結果を
+// 新しいベースラインとして保存する。
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__APPLE__)
+#include <sys/sysctl.h>
+#endif
+
+#include "converter/ECEF_to_ENU_converter.hpp"  // ECEFToENUConverter の定義
+#include "converter/ECEF_to_geo_converter.hpp"  // ECEFToGeoConverter の定義
+#include "converter/ENU_to_ECEF_converter.hpp"  // ENUToECEFConverter の定義
+#include "converter/ENU_to_geo_converter.hpp"   // ENUToGeoConverter の定義
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "converter/geo_to_ENU_converter.hpp"   // GeoToENUConverter の定義
+#include "coordinate/point_buffer.hpp"          // PointBuffer の定義
+#include "kernel/batch_dispatch.hpp"            // batchKernels の定義
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+namespace {
+/// データセットの点数（2^18）。版やマシンをまたいで変えないこと
+constexpr std::size_t kPoints = 262144;
+/// データセットの乱数の種
+constexpr std::uint64_t kSeed = 0x7472616e7367656fULL;
+
+/// 計測結果（変換器の名前 → 点/秒）
+using Results = std::map<std::string, double>;
+
+/**
+ * @brief 標準ライブラリの実装に依存しない決定的な乱数（SplitMix64）
+ */
+class SplitMix64 {
+ public:
+  explicit SplitMix64(std::uint64_t seed) : state_(seed) {}
+
+  /// [0, 1) の一様乱数
+  double uniform() {
+    std::uint64_t z = (state_ += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z ^= z >> 31;
+    return static_cast<double>(z >> 11) * 0x1.0p-53;
+  }
+
+ private:
+  std::uint64_t state_;
+};
+
+/**
+ * @brief 全球に分布する緯度・経度・楕円体高（-500 m〜10 km）を生成する
+ */
+PointBuffer makeGeoDataset() {
+  SplitMix64 random(kSeed);
+  PointBuffer geo(kPoints);
+  for (std::size_t i = 0; i < kPoints; ++i) {
+    geo.view().set(i, {-89.0 + 178.0 * random.uniform(),
+                       -180.0 + 360.0 * random.uniform(),
+                       -500.0 + 10500.0 * random.uniform()});
+  }
+  return geo;
+}
+
+/**
+ * @brief CPU の機種名を取得する
+ */
+std::string cpuModel() {
+#if defined(__APPLE__)
+  char name[256] = {};
+  std::size_t size = sizeof(name);
+  if (sysctlbyname("machdep.cpu.brand_string", name, &size, nullptr, 0) ==
+      0) {
+    return name;
+  }
+#else
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpuinfo, line)) {
+    if (line.rfind("model name", 0) == 0) {
+      std::size_t colon = line.find(':');
+      if (colon != std::string::npos) {
+        std::size_t begin = line.find_first_not_of(" \t", colon + 1);
+        return begin == std::string::npos ? "" : line.substr(begin);
+      }
+    }
+  }
+#endif
+  return "unknown";
+}
+
+/**
+ * @brief ベースラインのファイル名（CPU 機種と一括変換カーネルの版から作る）
+ */
+std::string baselineFileName(const std::string& cpu, const char* isa) {
+  std::string name;
+  for (char c : cpu + " " + isa) {
+    if (std::isalnum(static_cast<unsigned char>(c))) {
+      name += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    } else if (!name.empty() && name.back() != '-') {
+      name += '-';
+    }
+  }
+  while (!name.empty() && name.back() == '-') name.pop_back();
+  return name + ".json";
+}
+
+/**
+ * @brief 1 回の実行時間（秒）を計測する
+ */
+double seconds(const std::function<void()>& run) {
+  auto start = std::chrono::steady_clock::now();
+  run();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double>(elapsed).count();
+}
+
+/**
+ * @brief 各変換器の一括変換を計測する
+ */
+Results measure(int repetitions) {
+  PointBuffer geo = makeGeoDataset();
+  PointBuffer ecef(kPoints);
+  PointBuffer enu(kPoints);
+  PointBuffer out(kPoints);
+  GeoCoordinate origin(35.0, 139.0, 0.0);
+  GeoToECEFConverter(WGS84).convertBatch(geo.view(), ecef.view());
+  ECEFToENUConverter(WGS84, origin).convertBatch(ecef.view(), enu.view());
+
+  struct Case {
+    std::string name;
+    std::unique_ptr<ICoordinateConverter> converter;
+    const PointBuffer* input;
+  };
+  std::vector<Case> cases;
+  cases.push_back(
+      {"GeoToECEF", std::make_unique<GeoToECEFConverter>(WGS84), &geo});
+  for (auto [name, precision] :
+       {std::pair{"Reference", GeodeticPrecision::Reference},
+        std::pair{"Micrometre", GeodeticPrecision::Micrometre},
+        std::pair{"Millimetre", GeodeticPrecision::Millimetre},
+        std::pair{"Decimetre", GeodeticPrecision::Decimetre}}) {
+    cases.push_back({std::string("ECEFToGeo.") + name,
+                     std::make_unique<ECEFToGeoConverter>(WGS84, precision),
+                     &ecef});
+  }
+  cases.push_back({"ECEFToENU",
+                   std::make_unique<ECEFToENUConverter>(WGS84, origin),
+                   &ecef});
+  cases.push_back({"ENUToECEF",
+                   std::make_unique<ENUToECEFConverter>(WGS84, origin), &enu});
+  cases.push_back(
+      {"GeoToENU", std::make_unique<GeoToENUConverter>(WGS84, origin), &geo});
+  cases.push_back(
+      {"ENUToGeo", std::make_unique<ENUToGeoConverter>(WGS84, origin), &enu});
+
+  // 変換器を順に 1 回ずつ実行する周回を繰り返し、各変換器の最小時間を取る。
+  // 他のプロセスによる一時的な遅れが特定の変換器に偏らないようにする
+  std::vector<double> best(cases.size(), 1e300);
+  for (int rep = 0; rep <= repetitions; ++rep) {
+    for (std::size_t k = 0; k < cases.size(); ++k) {
+      const Case& c = cases[k];
+      double elapsed = seconds(
+          [&] { c.converter->convertBatch(c.input->view(), out.view()); });
+      // 1 周目はウォームアップとして捨てる
+      if (rep > 0) {
+        best[k] = std::min(best[k], elapsed);
+      }
+    }
+  }
+
+  Results results;
+  for (std::size_t k = 0; k < cases.size(); ++k) {
+    results[cases[k].name] = static_cast<double>(kPoints) / best[k];
+  }
+  return results;
+}
+
+/**
+ * @brief 計測結果をベースラインの JSON に変換する
+ */
+std::string toJson(const std::string& cpu, const char* isa,
+                   const Results& results) {
+  std::string escapedCpu;
+  for (char c : cpu) {
+    if (c == '"' || c == '\\') escapedCpu += '\\';
+    escapedCpu += c;
+  }
+  std::ostringstream json;
+  json << "{\n  \"cpu\": \"" << escapedCpu << "\",\n  \"isa\": \"" << isa
+       << "\",\n  \"points\": " << kPoints << ",\n  \"pointsPerSecond\": {";
+  const char* separator = "\n";
+  char value[32];
+  for (const auto& [name, pointsPerSecond] : results) {
+    std::snprintf(value, sizeof(value), "%.0f", pointsPerSecond);
+    json << separator << "    \"" << name << "\": " << value;
+    separator = ",\n";
+  }
+  json << "\n  }\n}\n";
+  return json.str();
+}
+
+/**
+ * @brief toJson() で書き出したベースラインから "pointsPerSecond" を読む
+ *
+ * @return bool 読み出せた場合は true
+ */
+bool parseBaseline(const std::string& json, Results& results) {
+  std::size_t pos = json.find("\"pointsPerSecond\"");
+  if (pos == std::string::npos) {
+    return false;
+  }
+  pos = json.find('{', pos);
+  std::size_t end = json.find('}', pos);
+  if (pos == std::string::npos || end == std::string::npos) {
+    return false;
+  }
+  while (true) {
+    std::size_t keyBegin = json.find('"', pos);
+    if (keyBegin == std::string::npos || keyBegin > end) {
+      return true;
+    }
+    std::size_t keyEnd = json.find('"', keyBegin + 1);
+    std::size_t colon = json.find(':', keyEnd);
+    if (keyEnd == std::string::npos || colon == std::string::npos ||
+        colon > end) {
+      return false;
+    }
+    char* valueEnd = nullptr;
+    double value = std::strtod(json.c_str() + colon + 1, &valueEnd);
+    if (valueEnd == json.c_str() + colon + 1) {
+      return false;
+    }
+    results[json.substr(keyBegin + 1, keyEnd - keyBegin - 1)] = value;
+    pos = static_cast<std::size_t>(valueEnd - json.c_str());
+  }
+}
+
+/**
+ * @brief 差分を表示し、しきい値を超えて低下した変換器の数を返す
+ */
+int compare(const Results& baseline, const Results& current,
+            double threshold) {
+  int regressions = 0;
+  std::printf("%-22s %12s %12s %9s\n", "converter", "baseline", "current",
+              "change");
+  std::printf("%-22s %12s %12s %9s\n", "", "(Mpts/s)", "(Mpts/s)", "");
+  for (const auto& [name, now] : current) {
+    auto it = baseline.find(name);
+    if (it == baseline.end()) {
+      std::printf("%-22s %12s %12.2f %9s\n", name.c_str(), "-", now / 1e6,
+                  "new");
+      continue;
+    }
+    double change = now / it->second - 1.0;
+    bool regressed = change < -threshold;
+    regressions += regressed ? 1 : 0;
+    std::printf("%-22s %12.2f %12.2f %+8.1f%%%s\n", name.c_str(),
+                it->second / 1e6, now / 1e6, 100.0 * change,
+                regressed ? "  << REGRESSION" : "");
+  }
+  for (const auto& [name, before] : baseline) {
+    if (current.find(name) == current.end()) {
+      std::printf("%-22s %12.2f %12s %9s\n", name.c_str(), before / 1e6, "-",
+                  "removed");
+    }
+  }
+  return regressions;
+}
+
+void usage() {
+  std::fprintf(stderr,
+               "usage: perf_regression [--baseline-dir DIR] "
+               "[--threshold FRACTION] [--repetitions N] "
+               "[--update-baseline]\n");
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::filesystem::path baselineDir = "bench/baselines";
+  double threshold = 0.10;
+  int repetitions = 15;
+  bool update = false;
+  for (int i = 1; i < argc; ++i) {
+    bool hasValue = i + 1 < argc;
+    if (std::strcmp(argv[i], "--baseline-dir") == 0 && hasValue) {
+      baselineDir = argv[++i];
+    } else if (std::strcmp(argv[i], "--threshold") == 0 && hasValue) {
+      threshold = std::strtod(argv[++i], nullptr);
+    } else if (std::strcmp(argv[i], "--repetitions") == 0 && hasValue) {
+      repetitions = std::max(1, std::atoi(argv[++i]));
+    } else if (std::strcmp(argv[i], "--update-baseline") == 0) {
+      update = true;
+    } else {
+      usage();
+      return 2;
+    }
+  }
+
+  std::string cpu = cpuModel();
+  const char* isa = trans_geo::kernel::isaName(
+      trans_geo::kernel::batchKernels().isa);
+  std::filesystem::path path = baselineDir / baselineFileName(cpu, isa);
+  std::printf("cpu: %s\nbatch kernels: %s\ndataset: %zu points, best of %d\n"
+              "baseline: %s\n\n",
+              cpu.c_str(), isa, kPoints, repetitions, path.c_str());
+
+  Results current = measure(repetitions);
+
+  Results baseline;
+  std::ifstream in(path);
+  bool haveBaseline = false;
+  if (in && !update) {
+    std::stringstream text;
+    text << in.rdbuf();
+    haveBaseline = parseBaseline(text.str(), baseline);
+    if (!haveBaseline) {
+      std::fprintf(stderr, "failed to parse %s\n", path.c_str());
+      return 2;
+    }
+  }
+
+  if (!haveBaseline) {
+    compare({}, current, threshold);
+    std::filesystem::create_directories(baselineDir);
+    std::ofstream(path) << toJson(cpu, isa, current);
+    std::printf("\nbaseline written to %s\n", path.c_str());
+    return 0;
+  }
+
+  int regressions = compare(baseline, current, threshold);
+  if (regressions > 0) {
+    std::printf("\n%d converter(s) slower than baseline by more than %.0f%%\n",
+                regressions, 100.0 * threshold);
+    return 1;
+  }
+  std::printf("\nno regression beyond %.0f%%\n", 100.0 * threshold);
+  return 0;
+}
@@ -0,0 +1,136 @@
+// ECEF → ENU の一括変換で、double で書き込む convertBatch()、変換後に別の
+// ループで int32 に量子化する手順、量子化を変換カーネルに融合した
+// convertBatchQuantized() を比較する。逆変換（ENU → ECEF）も同様に比較する
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "converter/ECEF_to_ENU_converter.hpp"  // ECEFToENUConverter の定義
+#include "converter/ENU_to_ECEF_converter.hpp"  // ENUToECEFConverter の定義
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "converter/quantized_batch.hpp"  // 量子化入出力の汎用の一括変換
+#include "coordinate/point_buffer.hpp"    // PointBuffer の定義
+#include "sample_points.hpp"              // ベンチマーク用の決定的な点列
+
+using namespace trans_geo::bench;
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+namespace {
+constexpr std::size_t kPoints = 4000000;
+
+/**
+ * @brief 最小処理時間（ナノ秒/点）を 5 回の計測から求める
+ */
+template <typename F>
+double bestNanosecondsPerPoint(F&& run) {
+  double best = 1e300;
+  for (int rep = 0; rep < 5; ++rep) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    best = std::min(
+        best,
+        std::chrono::duration<double, std::nano>(elapsed).count() / kPoints);
+  }
+  return best;
+}
+
+/**
+ * @brief 成分ごとの int32 配列（SoA）
+ */
+struct QuantizedColumns {
+  explicit QuantizedColumns(std::size_t size)
+      : x(size), y(size), z(size) {}
+
+  QuantizedPointView view() {
+    return QuantizedPointView::columns(x.data(), y.data(), z.data(),
+                                       x.size());
+  }
+
+  std::vector<std::int32_t> x, y, z;
+};
+
+void printRow(const char* name, double ns, double baseline,
+              std::size_t bytes) {
+  std::printf("%-28s %9.2f %8.2fx %12zu\n", name, ns, baseline / ns, bytes);
+}
+}  // namespace
+
+int main() {
+  // 原点の周囲 ±1 度（約 ±100 km）の決定的な点列
+  GeoCoordinate origin(35.0, 139.0, 0.0);
+  PointBuffer geo =
+      geoSamples(kPoints, {34.0, 36.0}, {138.0, 140.0}, {0.0, 3000.0});
+  PointBuffer ecef(kPoints);
+  GeoToECEFConverter(WGS84).convertBatch(geo.view(), ecef.view());
+
+  ECEFToENUConverter toEnu(WGS84, origin);
+  ENUToECEFConverter toEcef(WGS84, origin);
+  const Quantization& enuScale = kMillimetreQuantization;
+  PointBuffer enu(kPoints);
+  PointBuffer back(kPoints);
+  QuantizedColumns enuQuantized(kPoints);
+  bool saturated = false;
+
+  std::printf("%zu points, ENU はミリメートルで量子化\n\n", kPoints);
+  std::printf("%-28s %9s %9s %12s\n", "ECEF -> ENU", "ns/point", "speedup",
+              "bytes/point");
+  double dbl = bestNanosecondsPerPoint(
+      [&] { toEnu.convertBatch(ecef.view(), enu.view()); });
+  printRow("double", dbl, dbl, 48);
+  printRow("double + quantize pass",
+           bestNanosecondsPerPoint([&] {
+             toEnu.convertBatch(ecef.view(), enu.view());
+             QuantizedPointView out = enuQuantized.view();
+             for (std::size_t k = 0; k < 3; ++k) {
+               for (std::size_t i = 0; i < kPoints; ++i) {
+                 out(i, k) = quantize(enu.view()(i, k), enuScale.scale[k],
+                                      enuScale.offset[k], saturated);
+               }
+             }
+           }),
+           dbl, 24 + 24 + 24 + 12);
+  printRow("generic (256-point blocks)",
+           bestNanosecondsPerPoint([&] {
+             convertBatchQuantized(toEnu, ecef.view(), enuQuantized.view(),
+                                   enuScale);
+           }),
+           dbl, 36);
+  printRow("fused", bestNanosecondsPerPoint([&] {
+             toEnu.convertBatchQuantized(ecef.view(), enuQuantized.view(),
+                                         enuScale);
+           }),
+           dbl, 36);
+
+  std::printf("\n%-28s %9s %9s %12s\n", "ENU -> ECEF", "ns/point",
+              "speedup", "bytes/point");
+  dbl = bestNanosecondsPerPoint(
+      [&] { toEcef.convertBatch(enu.view(), back.view()); });
+  printRow("double", dbl, dbl, 48);
+  printRow("dequantize pass + double",
+           bestNanosecondsPerPoint([&] {
+             QuantizedPointView in = enuQuantized.view();
+             for (std::size_t k = 0; k < 3; ++k) {
+               for (std::size_t i = 0; i < kPoints; ++i) {
+                 enu.view()(i, k) = dequantize(in(i, k), enuScale.scale[k],
+                                               enuScale.offset[k]);
+               }
+             }
+             toEcef.convertBatch(enu.view(), back.view());
+           }),
+           dbl, 12 + 24 + 24 + 24);
+  printRow("fused", bestNanosecondsPerPoint([&] {
+             toEcef.convertBatchDequantized(enuQuantized.view(), enuScale,
+                                            back.view());
+           }),
+           dbl, 36);
+  std::printf("\n(bytes/point: 1 点あたりに読み書きする主記憶の量)\n");
+
+  double sink = back.component(0)[kPoints / 2] + enuQuantized.x[kPoints / 3] +
+                (saturated ? 1.0 : 0.0);
+  return sink == 0.123 ? 1 : 0;
+}
@@ -0,0 +1,110 @@
+// 1 点ごとの変換の遅延分布（平均・p99・p99.99・最大）を、既存の変換器と
+// RealtimeConverter で比較する
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "converter/ECEF_to_geo_converter.hpp"  // ECEFToGeoConverter の定義
+#include "converter/geo_to_ENU_converter.hpp"   // GeoToENUConverter の定義
+#include "coordinate/ECEF_coordinate.hpp"       // ECEFCoordinate の定義
+#include "coordinate/geo_coordinate.hpp"        // GeoCoordinate の定義
+#include "coordinate/point_buffer.hpp"          // PointBuffer の定義
+#include "realtime/realtime_converter.hpp"      // RealtimeConverter の定義
+#include "sample_points.hpp"                    // ベンチマーク用の決定的な点列
+
+using namespace trans_geo::bench;
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+using namespace trans_geo::realtime;
+
+namespace {
+constexpr std::size_t kSamples = 1000000;
+
+/**
+ * @brief 1 回ずつ計測した処理時間（ナノ秒）を返す
+ */
+template <typename F>
+std::vector<double> sampleNanoseconds(F&& call) {
+  std::vector<double> samples(kSamples);
+  for (std::size_t i = 0; i < kSamples; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    call(i);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    samples[i] = std::chrono::duration<double, std::nano>(elapsed).count();
+  }
+  return samples;
+}
+
+double percentile(const std::vector<double>& sorted, double q) {
+  return sorted[static_cast<std::size_t>(q * (sorted.size() - 1))];
+}
+
+/**
+ * @brief 時刻取得の処理時間（中央値）を差し引いて分布を表示する
+ */
+void report(const char* name, std::vector<double> samples, double overhead) {
+  double sum = 0.0;
+  for (double& sample : samples) {
+    sample = std::max(0.0, sample - overhead);
+    sum += sample;
+  }
+  std::sort(samples.begin(), samples.end());
+  std::printf("%-28s %9.1f %9.1f %9.1f %9.1f %10.1f\n", name,
+              sum / samples.size(), percentile(samples, 0.5),
+              percentile(samples, 0.99), percentile(samples, 0.9999),
+              samples.back());
+}
+}  // namespace
+
+int main() {
+  // 地表付近・極付近・高高度・地球中心を含む入力
+  PointBuffer samples =
+      geoSamples(kSamples, {-90.0, 90.0}, {-180.0, 180.0}, {0.0, 5000.0});
+  std::vector<GeoPoint> geo(kSamples);
+  for (std::size_t i = 0; i < kSamples; ++i) {
+    // 97 点に 1 点は高度 4 万 km までの高高度にする
+    double h = samples.component(2)[i] * (i % 97 == 0 ? 8000.0 : 1.0);
+    geo[i] = {samples.component(0)[i], samples.component(1)[i], h};
+  }
+  RealtimeConverter rt(WGS84, {35.0, 139.0, 0.0});
+  std::vector<ECEFPoint> ecef(kSamples);
+  for (std::size_t i = 0; i < kSamples; ++i) {
+    ecef[i] = (i % 1009 == 0) ? ECEFPoint{0.0, 0.0, 1.0} : rt.toECEF(geo[i]);
+  }
+
+  volatile double sink = 0.0;
+  std::vector<double> empty = sampleNanoseconds([](std::size_t) {});
+  std::sort(empty.begin(), empty.end());
+  double overhead = percentile(empty, 0.5);
+
+  ECEFToGeoConverter toGeo(WGS84);
+  std::vector<double> toGeoConvert = sampleNanoseconds([&](std::size_t i) {
+    auto out = toGeo.convert(ECEFCoordinate(ecef[i].x, ecef[i].y, ecef[i].z));
+    sink = sink + out->getValueArray()[0];
+  });
+  std::vector<double> toGeoRealtime = sampleNanoseconds([&](std::size_t i) {
+    sink = sink + rt.toGeo(ecef[i]).latitude;
+  });
+
+  GeoToENUConverter toEnu(WGS84, GeoCoordinate(35.0, 139.0, 0.0));
+  std::vector<double> toEnuConvert = sampleNanoseconds([&](std::size_t i) {
+    auto out = toEnu.convert(
+        GeoCoordinate(geo[i].latitude, geo[i].longitude, geo[i].altitude));
+    sink = sink + out->getValueArray()[0];
+  });
+  std::vector<double> toEnuRealtime = sampleNanoseconds([&](std::size_t i) {
+    sink = sink + rt.toENU(geo[i]).east;
+  });
+
+  std::printf("%zu samples, clock overhead %.1f ns subtracted\n\n", kSamples,
+              overhead);
+  std::printf("%-28s %9s %9s %9s %9s %10s\n", "latency (ns)", "mean", "p50",
+              "p99", "p99.99", "max");
+  report("ECEF->Geo convert()", toGeoConvert, overhead);
+  report("ECEF->Geo realtime", toGeoRealtime, overhead);
+  report("Geo->ENU convert()", toEnuConvert, overhead);
+  report("Geo->ENU realtime", toEnuRealtime, overhead);
+  return 0;
+}
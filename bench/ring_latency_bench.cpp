@@ -0,0 +1,173 @@
+// 受信スレッドから変換結果を受け取るまでの遅延を、ロックとヒープ確保を伴う
+// 従来の受け渡しとリングバッファ + ConversionWorker で比較する
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "coordinate/geo_coordinate.hpp"        // GeoCoordinate の定義
+#include "pipeline/conversion_worker.hpp"       // ConversionWorker の定義
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+using namespace trans_geo::pipeline;
+
+namespace {
+constexpr std::size_t kBursts = 2000;
+constexpr std::size_t kBurstSize = 32;
+constexpr std::size_t kFixes = kBursts * kBurstSize;
+constexpr auto kBurstInterval = std::chrono::microseconds(200);
+
+std::uint64_t nowNanoseconds() {
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+/**
+ * @brief 一定間隔で kBurstSize 件ずつ受信する I/O スレッドを模擬する
+ */
+template <typename Push>
+std::thread startReceiver(Push push) {
+  return std::thread([push] {
+    auto next = std::chrono::steady_clock::now();
+    for (std::size_t b = 0; b < kBursts; ++b) {
+      next += kBurstInterval;
+      std::this_thread::sleep_until(next);
+      for (std::size_t i = 0; i < kBurstSize; ++i) {
+        double u = static_cast<double>(b * kBurstSize + i) / kFixes;
+        push(35.0 + u, 139.0 + u, 10.0, nowNanoseconds());
+      }
+    }
+  });
+}
+
+void report(const char* name, std::vector<std::uint64_t>& latencies) {
+  std::sort(latencies.begin(), latencies.end());
+  auto at = [&](double q) {
+    auto index = static_cast<std::size_t>(q * (latencies.size() - 1));
+    return static_cast<double>(latencies[index]) / 1000.0;
+  };
+  std::printf("%-22s %10.1f %10.1f %10.1f %10.1f\n", name, at(0.5), at(0.99),
+              at(0.999), at(1.0));
+}
+
+/**
+ * @brief 従来の方法: 1 件ごとに GeoCoordinate をヒープ確保し、
+ *        ロック付きのキューで受け渡して convert() する
+ */
+std::vector<std::uint64_t> runLockedQueue(const GeoToECEFConverter& converter) {
+  struct Message {
+    std::unique_ptr<trans_geo::interface::ICoordinate> point;
+    std::uint64_t stamp;
+  };
+  std::mutex inputMutex, outputMutex;
+  std::condition_variable inputReady, outputReady;
+  std::deque<Message> input, output;
+  bool done = false;
+
+  std::thread worker([&] {
+    for (;;) {
+      std::unique_lock<std::mutex> lock(inputMutex);
+      inputReady.wait(lock, [&] { return done || !input.empty(); });
+      if (input.empty()) {
+        return;
+      }
+      Message message = std::move(input.front());
+      input.pop_front();
+      lock.unlock();
+      Message result{converter.convert(*message.point), message.stamp};
+      {
+        std::lock_guard<std::mutex> outputLock(outputMutex);
+        output.push_back(std::move(result));
+      }
+      outputReady.notify_one();
+    }
+  });
+  std::thread receiver =
+      startReceiver([&](double lat, double lon, double h, std::uint64_t t) {
+        {
+          std::lock_guard<std::mutex> lock(inputMutex);
+          input.push_back({std::make_unique<GeoCoordinate>(lat, lon, h), t});
+        }
+        inputReady.notify_one();
+      });
+
+  std::vector<std::uint64_t> latencies;
+  latencies.reserve(kFixes);
+  while (latencies.size() < kFixes) {
+    std::unique_lock<std::mutex> lock(outputMutex);
+    outputReady.wait(lock, [&] { return !output.empty(); });
+    while (!output.empty()) {
+      latencies.push_back(nowNanoseconds() - output.front().stamp);
+      output.pop_front();
+    }
+  }
+  receiver.join();
+  {
+    std::lock_guard<std::mutex> lock(inputMutex);
+    done = true;
+  }
+  inputReady.notify_one();
+  worker.join();
+  return latencies;
+}
+
+/**
+ * @brief リングバッファ: 値型の点をロックフリーで受け渡し、一括変換する
+ */
+std::vector<std::uint64_t> runRing(const GeoToECEFConverter& converter) {
+  MpscRing<TaggedPoint> input(4096);
+  SpscRing<TaggedPoint> output(4096);
+  ConversionWorker worker(converter, input, output);
+  worker.start();
+  std::thread receiver =
+      startReceiver([&](double lat, double lon, double h, std::uint64_t t) {
+        while (!input.tryPush({{lat, lon, h}, t})) {
+          std::this_thread::yield();
+        }
+      });
+
+  std::vector<std::uint64_t> latencies;
+  latencies.reserve(kFixes);
+  std::vector<TaggedPoint> results(kDefaultBatchSize);
+  while (latencies.size() < kFixes) {
+    std::size_t n = output.popBatch(results.data(), results.size());
+    if (n == 0) {
+      std::this_thread::yield();
+      continue;
+    }
+    std::uint64_t now = nowNanoseconds();
+    for (std::size_t i = 0; i < n; ++i) {
+      latencies.push_back(now - results[i].tag);
+    }
+  }
+  receiver.join();
+  worker.stop();
+  return latencies;
+}
+}  // namespace
+
+int main() {
+  GeoToECEFConverter converter(WGS84);
+  std::printf("%zu fixes in bursts of %zu every %lld us, %u hw threads\n\n",
+              kFixes, kBurstSize,
+              static_cast<long long>(kBurstInterval.count()),
+              std::thread::hardware_concurrency());
+  std::printf("%-22s %10s %10s %10s %10s\n", "end-to-end latency (us)", "p50",
+              "p99", "p99.9", "max");
+  std::vector<std::uint64_t> locked = runLockedQueue(converter);
+  report("mutex + unique_ptr", locked);
+  std::vector<std::uint64_t> ring = runRing(converter);
+  report("ring + worker", ring);
+  return 0;
+}
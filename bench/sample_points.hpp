@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+
+#include "coordinate/point_buffer.hpp"  // PointBuffer の定義
+
+namespace trans_geo::bench {
+
+/// 点列の成分の範囲 [min, max)
+struct SampleRange {
+  double min;
+  double max;
+};
+
+/**
+ * @brief 緯度・経度・高度の決定的な点列
+ *
+ * 緯度と経度は別々の整数ハッシュ列から、高度は両者の積から求めるため、
+ * 点は範囲内に 2 次元的に散らばる。
+ * @param size 点数
+ * @param lat 緯度の範囲 [度]
+ * @param lon 経度の範囲 [度]
+ * @param h 高度の範囲 [m]
+ * @return trans_geo::coordinate::PointBuffer 緯度・経度・高度の点列
+ */
+inline trans_geo::coordinate::PointBuffer geoSamples(std::size_t size,
+                                                     SampleRange lat,
+                                                     SampleRange lon,
+                                                     SampleRange h) {
+  trans_geo::coordinate::PointBuffer geo(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    double u = static_cast<double>((i * 2654435761u) % 1000003) / 1000003.0;
+    double v = static_cast<double>((i * 40503u) % 65537) / 65537.0;
+    geo.view().set(i, {lat.min + (lat.max - lat.min) * u,
+                       lon.min + (lon.max - lon.min) * v,
+                       h.min + (h.max - h.min) * u * v});
+  }
+  return geo;
+}
+}  // namespace trans_geo::bench
@@ -0,0 +1,84 @@
+// 座標列のテキスト出力（toString() と formatPoints()）の処理時間を比較する
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "coordinate/ECEF_coordinate.hpp"       // ECEFCoordinate の定義
+#include "coordinate/point_buffer.hpp"          // PointBuffer の定義
+#include "io/text_format.hpp"                   // formatPoints の定義
+#include "sample_points.hpp"                    // ベンチマーク用の決定的な点列
+
+using namespace trans_geo::bench;
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+using namespace trans_geo::io;
+
+namespace {
+constexpr std::size_t kPoints = 1000000;
+constexpr std::size_t kBufferSize = 1 << 20;
+
+/**
+ * @brief 最小処理時間（ナノ秒/点）を 3 回の計測から求める
+ */
+template <typename F>
+double bestNanosecondsPerPoint(F&& run) {
+  double best = 1e300;
+  for (int rep = 0; rep < 3; ++rep) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    best = std::min(
+        best,
+        std::chrono::duration<double, std::nano>(elapsed).count() / kPoints);
+  }
+  return best;
+}
+}  // namespace
+
+int main() {
+  // 地表付近の決定的な ECEF 座標（点ごとに x, y, z を並べる）
+  PointBuffer geo =
+      geoSamples(kPoints, {-90.0, 90.0}, {-180.0, 180.0}, {0.0, 1000.0});
+  std::vector<double> aos(kPoints * 3);
+  GeoToECEFConverter(WGS84).convertBatch(
+      geo.view(), PointView::interleaved(aos.data(), kPoints));
+
+  std::size_t sink = 0;
+  double ostream = bestNanosecondsPerPoint([&] {
+    std::string out;
+    for (std::size_t i = 0; i < kPoints; ++i) {
+      out += ECEFCoordinate(aos[3 * i], aos[3 * i + 1], aos[3 * i + 2])
+                 .toString();
+      out += '\n';
+      if (out.size() > kBufferSize) {
+        sink += out.size();
+        out.clear();
+      }
+    }
+    sink += out.size();
+  });
+
+  std::vector<char> buffer(kBufferSize);
+  double toChars = bestNanosecondsPerPoint([&] {
+    ConstPointView points = ConstPointView::interleaved(aos.data(), kPoints);
+    std::size_t done = 0;
+    while (done < kPoints) {
+      FormatResult result =
+          formatPoints(points.subview(done, kPoints - done), buffer);
+      sink += result.bytes;
+      done += result.points;
+    }
+  });
+
+  std::printf("%zu points, precision 6\n\n", kPoints);
+  std::printf("%-24s %10s %9s\n", "method", "ns/point", "speedup");
+  std::printf("%-24s %10.1f %8.2fx\n", "toString (ostringstream)", ostream,
+              1.0);
+  std::printf("%-24s %10.1f %8.2fx\n", "formatPoints (to_chars)", toChars,
+              ostream / toChars);
+  return sink == 0 ? 1 : 0;
+}
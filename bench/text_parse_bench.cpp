@@ -0,0 +1,77 @@
+// 区切りテキストの解析（std::stod と parsePoints()）の処理時間を比較する
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "coordinate/geo_coordinate.hpp"  // GeoCoordinate の定義
+#include "coordinate/point_buffer.hpp"    // PointBuffer の定義
+#include "io/text_format.hpp"             // formatPoints の定義
+#include "io/text_parse.hpp"              // parsePoints の定義
+#include "sample_points.hpp"              // ベンチマーク用の決定的な点列
+
+using namespace trans_geo::bench;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::io;
+
+namespace {
+constexpr std::size_t kPoints = 1000000;
+
+/**
+ * @brief 最小処理時間（ナノ秒/点）を 3 回の計測から求める
+ */
+template <typename F>
+double bestNanosecondsPerPoint(F&& run) {
+  double best = 1e300;
+  for (int rep = 0; rep < 3; ++rep) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    best = std::min(
+        best,
+        std::chrono::duration<double, std::nano>(elapsed).count() / kPoints);
+  }
+  return best;
+}
+}  // namespace
+
+int main() {
+  // 決定的な緯度・経度・高度の CSV を生成
+  PointBuffer source =
+      geoSamples(kPoints, {-90.0, 90.0}, {-180.0, 180.0}, {0.0, 1000.0});
+  std::string text(kPoints * 64, '\0');
+  FormatResult formatted =
+      formatPoints(source.view(), {text.data(), text.size()}, {9, ',', '\n'});
+  text.resize(formatted.bytes);
+
+  double sink = 0.0;
+  double stod = bestNanosecondsPerPoint([&] {
+    std::vector<GeoCoordinate> points;
+    points.reserve(kPoints);
+    std::istringstream in(text);
+    std::string line;
+    while (std::getline(in, line)) {
+      std::size_t first = line.find(',');
+      std::size_t second = line.find(',', first + 1);
+      points.emplace_back(std::stod(line.substr(0, first)),
+                          std::stod(line.substr(first + 1, second - first)),
+                          std::stod(line.substr(second + 1)));
+    }
+    sink += points.back().getLatitude();
+  });
+
+  double fromChars = bestNanosecondsPerPoint([&] {
+    PointBuffer points;
+    ParseReport report = parsePoints(text, points);
+    sink += points.component(0)[report.points - 1];
+  });
+
+  std::printf("%zu points, %zu bytes\n\n", kPoints, text.size());
+  std::printf("%-28s %10s %9s\n", "method", "ns/point", "speedup");
+  std::printf("%-28s %10.1f %8.2fx\n", "getline + stod", stod, 1.0);
+  std::printf("%-28s %10.1f %8.2fx\n", "parsePoints (from_chars)", fromChars,
+              stod / fromChars);
+  return sink == 0.123 ? 1 : 0;
+}
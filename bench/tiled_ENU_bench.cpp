@@ -0,0 +1,84 @@
+// 大陸規模の点列を float の ENU で保持したときの誤差と変換時間を、
+// 単一原点とタイルごとの原点（TiledENUFrames）で比較する
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+#include "converter/ENU_frame.hpp"              // ENUFrame の定義
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "converter/tiled_ENU_frames.hpp"       // TiledENUFrames の定義
+#include "coordinate/point_buffer.hpp"          // PointBuffer の定義
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+namespace {
+constexpr std::size_t kPoints = 1000000;
+
+double distance(const std::array<double, 3>& a,
+                const std::array<double, 3>& b) {
+  return std::sqrt((a[0] - b[0]) * (a[0] - b[0]) +
+                   (a[1] - b[1]) * (a[1] - b[1]) +
+                   (a[2] - b[2]) * (a[2] - b[2]));
+}
+
+double nanosecondsPerPoint(std::chrono::steady_clock::duration elapsed) {
+  return std::chrono::duration<double, std::nano>(elapsed).count() / kPoints;
+}
+}  // namespace
+
+int main() {
+  // ユーラシア大陸程度の範囲（緯度 20〜70°、経度 0〜140°）
+  std::mt19937_64 rng(1);
+  std::uniform_real_distribution<double> lat(20.0, 70.0);
+  std::uniform_real_distribution<double> lon(0.0, 140.0);
+  std::uniform_real_distribution<double> h(0.0, 3000.0);
+  PointBuffer geo(kPoints);
+  for (std::size_t i = 0; i < kPoints; ++i) {
+    geo.view().set(i, {lat(rng), lon(rng), h(rng)});
+  }
+  PointBuffer ecef(kPoints);
+  GeoToECEFConverter(WGS84).convertBatch(geo.view(), ecef.view());
+
+  // 単一原点: ENU を float に丸めてから ECEF に戻す
+  ENUFrame single(WGS84, GeoCoordinate(45.0, 70.0, 0.0));
+  double singleError = 0.0;
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < kPoints; ++i) {
+    std::array<double, 3> enu = single.toENU(ecef.view().get(i));
+    std::array<double, 3> rounded = {static_cast<float>(enu[0]),
+                                     static_cast<float>(enu[1]),
+                                     static_cast<float>(enu[2])};
+    singleError = std::max(
+        singleError, distance(single.toECEF(rounded), ecef.view().get(i)));
+  }
+  double singleTime =
+      nanosecondsPerPoint(std::chrono::steady_clock::now() - start);
+
+  // タイルごとの原点
+  TiledENUFrames frames(WGS84);
+  TiledENUBatch batch;
+  start = std::chrono::steady_clock::now();
+  frames.fromECEF(ecef.view(), batch);
+  double tiledTime =
+      nanosecondsPerPoint(std::chrono::steady_clock::now() - start);
+  PointBuffer back(kPoints);
+  frames.toECEF(batch, back.view());
+  double tiledError = 0.0;
+  for (std::size_t i = 0; i < kPoints; ++i) {
+    tiledError = std::max(tiledError,
+                          distance(back.view().get(i), ecef.view().get(i)));
+  }
+
+  std::printf("%zu points, %zu tiles of %.1f deg\n\n", kPoints,
+              batch.groupCount(), frames.getTileSize());
+  std::printf("%-24s %14s %10s\n", "float ENU", "max error (m)", "ns/point");
+  std::printf("%-24s %14.4f %10.1f\n", "single origin", singleError,
+              singleTime);
+  std::printf("%-24s %14.4f %10.1f\n", "tiled (fromECEF)", tiledError,
+              tiledTime);
+  return 0;
+}
@@ -0,0 +1,200 @@
+#ifndef TRANSGEO_CAPI_TRANSGEO_H_
+#define TRANSGEO_CAPI_TRANSGEO_H_
+
+/**
+ * @file transgeo.h
+ * @brief TransGeo の C API（共有ライブラリ transgeo_c）
+ *
+ * Python（ctypes / cffi）・Go（cgo）・Rust などから FFI で利用するための
+ * 安定した C ABI です。変換器は不透明なハンドルとして扱い、座標列は
+ * double 配列と間隔（stride）で受け渡すため、境界の通過は一括変換 1 回に
+ * つき 1 度で済みます。関数は例外を送出せず、結果を tg_status で返します。
+ *
+ * 構造体と列挙子の値は ABI の一部です。互換性のない変更を行う場合は
+ * TG_ABI_VERSION を更新します。
+ */
+
+#include <stddef.h>
+
+#if defined(_WIN32)
+#if defined(TRANSGEO_C_BUILD)
+#define TG_API __declspec(dllexport)
+#else
+#define TG_API __declspec(dllimport)
+#endif
+#else
+#define TG_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ABI のバージョン。tg_abi_version() と照合してください */
+#define TG_ABI_VERSION 1
+
+/**
+ * @brief 結果コード
+ */
+typedef enum tg_status {
+  TG_OK = 0,                /**< 成功 */
+  TG_NULL_BUFFER = 1,       /**< 入出力の先頭ポインタが NULL */
+  TG_INVALID_STRIDE = 2,    /**< 点の間隔が 0 */
+  TG_INVALID_ARGUMENT = 3,  /**< 引数が不正（未知の変換種別、原点の欠落など） */
+  TG_OUT_OF_MEMORY = 4,     /**< メモリを確保できない */
+  TG_INTERNAL_ERROR = 5     /**< その他の内部エラー */
+} tg_status;
+
+/**
+ * @brief 変換の種類
+ *
+ * Geo は [緯度（度）, 経度（度）, 楕円体高（m）]、ECEF は [X, Y, Z]（m）、
+ * ENU は [east, north, up]（m）です。
+ */
+typedef enum tg_conversion {
+  TG_GEO_TO_ECEF = 1,
+  TG_ECEF_TO_GEO = 2,
+  TG_ECEF_TO_ENU = 3,
+  TG_ENU_TO_ECEF = 4,
+  TG_GEO_TO_ENU = 5,
+  TG_ENU_TO_GEO = 6
+} tg_conversion;
+
+/**
+ * @brief ECEF → Geo の精度プリセット（GeodeticPrecision に対応）
+ */
+typedef enum tg_geodetic_precision {
+  TG_PRECISION_REFERENCE = 0,   /**< 従来の反復法（既定） */
+  TG_PRECISION_MICROMETRE = 1,  /**< 1 µm 以下 */
+  TG_PRECISION_MILLIMETRE = 2,  /**< 1 mm 以下 */
+  TG_PRECISION_DECIMETRE = 3    /**< 10 cm 以下 */
+} tg_geodetic_precision;
+
+/**
+ * @brief 楕円体モデル
+ */
+typedef struct tg_ellipsoid {
+  double a; /**< 長半径（m） */
+  double f; /**< 扁平率 */
+} tg_ellipsoid;
+
+/** 変換器の不透明なハンドル */
+typedef struct tg_converter tg_converter;
+
+/**
+ * @brief ライブラリの ABI バージョンを取得する
+ * @return int TG_ABI_VERSION
+ */
+TG_API int tg_abi_version(void);
+
+/**
+ * @brief 結果コードを名前に変換する
+ * @param status 結果コード
+ * @return const char* 名前（例: "TG_NULL_BUFFER"）。解放不要
+ */
+TG_API const char* tg_status_string(tg_status status);
+
+/**
+ * @brief WGS84 楕円体を取得する
+ * @return tg_ellipsoid WGS84
+ */
+TG_API tg_ellipsoid tg_ellipsoid_wgs84(void);
+
+/**
+ * @brief GRS80 楕円体を取得する
+ * @return tg_ellipsoid GRS80
+ */
+TG_API tg_ellipsoid tg_ellipsoid_grs80(void);
+
+/**
+ * @brief EPSG コード（楕円体または測地座標系）から楕円体を取得する
+ * @param epsg_code EPSG コード（例: 7030, 4326, 6668）
+ * @param out       楕円体の出力先
+ * @return tg_status 未登録のコードの場合は TG_INVALID_ARGUMENT
+ */
+TG_API tg_status tg_ellipsoid_from_epsg(int epsg_code, tg_ellipsoid* out);
+
+/**
+ * @brief 変換器を作成する
+ *
+ * ENU を含む変換では origin に原点 [緯度, 経度, 高度] を指定します。
+ * それ以外の変換では origin は無視されます（NULL 可）。
+ *
+ * @param conversion 変換の種類
+ * @param ellipsoid  楕円体モデル
+ * @param origin     ENU の原点（3 要素）
+ * @param out        作成したハンドルの出力先
+ * @return tg_status 成功時は TG_OK。失敗時 *out は変更しない
+ */
+TG_API tg_status tg_converter_create(tg_conversion conversion,
+                                     const tg_ellipsoid* ellipsoid,
+                                     const double* origin,
+                                     tg_converter** out);
+
+/**
+ * @brief 精度プリセットを指定して ECEF → Geo の変換器を作成する
+ *
+ * @param ellipsoid 楕円体モデル
+ * @param precision 精度プリセット
+ * @param out       作成したハンドルの出力先
+ * @return tg_status 成功時は TG_OK
+ */
+TG_API tg_status tg_ecef_to_geo_create(const tg_ellipsoid* ellipsoid,
+                                       tg_geodetic_precision precision,
+                                       tg_converter** out);
+
+/**
+ * @brief 変換器を破棄する
+ * @param converter 破棄するハンドル（NULL 可）
+ */
+TG_API void tg_converter_destroy(tg_converter* converter);
+
+/**
+ * @brief 成分ごとの先頭ポインタと間隔を指定して一括変換する
+ *
+ * 第 i 点の成分 k は in_k[i * in_stride] にあるものとします。間隔の単位は
+ * バイトではなく double の要素数です。構造体配列（AoS）は
+ * (p, p + 1, p + 2, 3)、成分ごとの配列（SoA）は (x, y, z, 1) を指定します。
+ * 入力と出力が同じ領域を指す上書き変換が可能です。
+ * 同じハンドルを複数のスレッドから同時に使用できます。
+ *
+ * @param converter  変換器
+ * @param count      点数
+ * @param in_x       入力の第 0 成分の先頭
+ * @param in_y       入力の第 1 成分の先頭
+ * @param in_z       入力の第 2 成分の先頭
+ * @param in_stride  入力の点の間隔（要素数）
+ * @param out_x      出力の第 0 成分の先頭
+ * @param out_y      出力の第 1 成分の先頭
+ * @param out_z      出力の第 2 成分の先頭
+ * @param out_stride 出力の点の間隔（要素数）
+ * @return tg_status 成功時は TG_OK。失敗時は出力を変更しない
+ */
+TG_API tg_status tg_convert_strided(const tg_converter* converter,
+                                    size_t count, const double* in_x,
+                                    const double* in_y, const double* in_z,
+                                    size_t in_stride, double* out_x,
+                                    double* out_y, double* out_z,
+                                    size_t out_stride);
+
+/**
+ * @brief [c0, c1, c2] を連続して並べた配列を一括変換する
+ *
+ * tg_convert_strided(converter, count, in, in + 1, in + 2, 3,
+ * out, out + 1, out + 2, 3) と同じです。
+ *
+ * @param converter 変換器
+ * @param count     点数
+ * @param in        入力（3 × count 要素）
+ * @param out       出力（3 × count 要素）
+ * @return tg_status 成功時は TG_OK
+ */
+TG_API tg_status tg_convert_interleaved(const tg_converter* converter,
+                                        size_t count, const double* in,
+                                        double* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // TRANSGEO_CAPI_TRANSGEO_H_
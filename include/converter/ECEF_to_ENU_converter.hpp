@@ -1,9 +1,13 @@
 #pragma once
 
+#include <array>
 #include <memory>
+#include <span>
 
+#include "converter/ENU_frame.hpp"  // ENUFrame の定義
 #include "converter/i_coordiante_converter.hpp"  // ICoordinateConverter インターフェースの定義
 #include "coordinate/geo_coordinate.hpp"  // GeoCoordinate の定義
+#include "coordinate/origin_handle.hpp"   // OriginHandle の定義
 #include "ellipsoid/ellipsoid.hpp"        // Ellipsoid 構造体の定義
 
 namespace trans_geo::conversion {
@@ -15,6 +19,8 @@ namespace trans_geo::conversion {
  * 座標（地球中心・地球固定座標）を、指定された原点（GeoCoordinate 型）を基準に
  * ローカルな ENU 座標に変換します。
  * 楕円体モデルはコンストラクタインジェクションで渡されます。
+ * 原点の ECEF 座標と回転行列はコンストラクタで一度だけ計算し、
+ * 位置・速度・加速度の変換で共有します。
  */
 class ECEFToENUConverter : public ICoordinateConverter {
  public:
@@ -39,9 +45,109 @@ class ECEFToENUConverter : public ICoordinateConverter {
   std::unique_ptr<trans_geo::interface::ICoordinate> convert(
       const trans_geo::interface::ICoordinate& input) const override;
 
+  /**
+   * @brief 座標列を一括変換する（例外を送出しない）
+   *
+   * @param input  [X, Y, Z]（メートル）の座標列
+   * @param output [east, north, up]（メートル）の座標列（input と同じ点数）
+   * @return ConversionStatus 成功時は ConversionStatus::Ok
+   */
+  ConversionStatus convertBatch(
+      trans_geo::coordinate::ConstPointView input,
+      trans_geo::coordinate::PointView output) const noexcept override;
+
+  /**
+   * @brief 座標列を一括変換し、結果を int32 固定小数点で書き込む
+   *
+   * 量子化は変換カーネルの書き込みに融合しており、double の中間配列を
+   * 経由しません。値は convertBatch() の結果を quantize() したものと
+   * 一致します。
+   *
+   * @param input        [X, Y, Z]（メートル）の座標列
+   * @param output       [east, north, up]（メートル）を量子化した出力先
+   *                     （input と同じ点数）
+   * @param quantization 出力の換算
+   * @return ConversionStatus 成功時は ConversionStatus::Ok、int32 の範囲を
+   * 超えた成分があった場合は ConversionStatus::Saturated
+   */
+  ConversionStatus convertBatchQuantized(
+      trans_geo::coordinate::ConstPointView input,
+      trans_geo::coordinate::QuantizedPointView output,
+      const trans_geo::coordinate::Quantization& quantization) const noexcept;
+
+  /**
+   * @brief int32 固定小数点の座標列を元の単位に戻しながら一括変換する
+   *
+   * 逆量子化は変換カーネルの読み込みに融合しています。値は入力を
+   * dequantize() してから convertBatch() した結果と一致します。
+   *
+   * @param input        [X, Y, Z]（メートル）を量子化した座標列
+   * @param quantization 入力の換算
+   * @param output       [east, north, up]（メートル）の出力先
+   *                     （input と同じ点数）
+   * @return ConversionStatus 成功時は ConversionStatus::Ok
+   */
+  ConversionStatus convertBatchDequantized(
+      trans_geo::coordinate::ConstQuantizedPointView input,
+      const trans_geo::coordinate::Quantization& quantization,
+      trans_geo::coordinate::PointView output) const noexcept;
+
+  /**
+   * @brief ECEF 軸の速度を ENU 軸の速度に変換する
+   *
+   * 速度は原点オフセットを含まない純粋な回転で変換されます。
+   *
+   * @param ecefVelocity [vX, vY, vZ]（メートル毎秒）
+   * @return std::array<double, 3> [vE, vN, vU]（メートル毎秒）
+   */
+  std::array<double, 3> convertVelocity(
+      const std::array<double, 3>& ecefVelocity) const noexcept;
+
+  /**
+   * @brief ECEF 軸の加速度を ENU 軸の加速度に変換する
+   *
+   * 加速度は原点オフセットを含まない純粋な回転で変換されます。
+   *
+   * @param ecefAcceleration [aX, aY, aZ]（メートル毎秒毎秒）
+   * @return std::array<double, 3> [aE, aN, aU]（メートル毎秒毎秒）
+   */
+  std::array<double, 3> convertAcceleration(
+      const std::array<double, 3>& ecefAcceleration) const noexcept;
+
+  /**
+   * @brief ECEF 状態ベクトル列を ENU 状態ベクトル列に一括変換する
+   *
+   * 入力は点ごとに [X, Y, Z, vX, vY, vZ] を連続して並べた配列です。
+   * 位置と速度を 1 回の走査でまとめて変換し、出力にも同じ並びで
+   * [E, N, U, vE, vN, vU] を書き込みます。入力と出力に同じ領域を
+   * 渡して上書き変換することもできます。
+   *
+   * @param ecefStates ECEF 状態ベクトル列（要素数は kStateVectorSize の倍数）
+   * @param enuStates  出力先の ENU 状態ベクトル列（ecefStates と同じ要素数）
+   * @throw std::invalid_argument 要素数が kStateVectorSize
+   * の倍数でない場合、または入出力の要素数が一致しない場合
+   */
+  void convertStates(std::span<const double> ecefStates,
+                     std::span<double> enuStates) const;
+
+  /**
+   * @brief キャッシュ済みの ENU フレームを取得する
+   * @return const ENUFrame& 原点の ECEF 座標と回転行列
+   */
+  const ENUFrame& getFrame() const noexcept;
+
+  /**
+   * @brief 出力する ENU 座標が共有する原点のハンドルを取得する
+   * @return const trans_geo::coordinate::OriginHandle& 原点のハンドル
+   */
+  const trans_geo::coordinate::OriginHandle& getOriginHandle() const noexcept;
+
  private:
   trans_geo::ellipsoid::Ellipsoid ellipsoid_;
   trans_geo::coordinate::GeoCoordinate origin_;
+  /// 出力する ENU 座標で共有する原点（インターン済み）
+  trans_geo::coordinate::OriginHandle originHandle_;
+  ENUFrame frame_;  ///< 原点から計算した ENU フレーム
 };
 
 }  // namespace trans_geo::conversion
\ No newline at end of file
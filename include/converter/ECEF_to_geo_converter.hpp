@@ -1,17 +1,46 @@
 #pragma once
 
+#include <array>
 #include <memory>
 
 #include "converter/i_coordiante_converter.hpp"
 #include "ellipsoid/ellipsoid.hpp"
+#include "geoid/geoid_grid.hpp"  // GeoidGrid の定義
 
 namespace trans_geo::conversion {
+
+/**
+ * @brief ECEF→Geo 変換の精度プリセット
+ *
+ * 各プリセットは、目標精度を満たす中で最も安価なアルゴリズムと反復回数を
+ * 選びます。誤差は緯度方向の位置誤差と高度誤差の大きい方（メートル）で、
+ * WGS84・緯度 -90°〜90°・高度 -1 km〜40,000 km の格子で倍精度の
+ * 厳密解と比較した最悪値です（bench/ECEF_to_geo_bench.cpp で再計測可能）。
+ *
+ * - Reference  : 固定点反復（tol 1e-12 rad, 最大 100 回）。最悪誤差 5e-8 m
+ * - Micrometre : Bowring 法 2 ステップ。最悪誤差 3e-8 m
+ * - Millimetre : Bowring 法 1 ステップ（地心距離が b + 100 km
+ *                を超える点のみ 2 ステップ）。最悪誤差 1e-4 m
+ * - Decimetre  : Bowring 法 1 ステップ（地心距離が b + 1000 km
+ *                を超える点のみ 2 ステップ）。最悪誤差 7e-3 m
+ *
+ * Bowring 法は三角関数を用いず、atan2 を 2 回と平方根のみで計算します。
+ */
+enum class GeodeticPrecision {
+  Reference,   ///< 従来の反復法（既定）
+  Micrometre,  ///< 1 µm 以下
+  Millimetre,  ///< 1 mm 以下
+  Decimetre    ///< 10 cm 以下
+};
+
 /**
  * @brief ECEFCoordinate から GeoCoordinate への変換クラス
  *
  * このクラスは、ECEF 座標を地理座標 (GeoCoordinate)
  * に変換する戦略クラスです。
  * 楕円体モデルはコンストラクタインジェクションにより渡されます。
+ * 収束判定の許容誤差と最大反復回数、または精度プリセットを
+ * コンストラクタで指定できます。
  */
 class ECEFToGeoConverter : public ICoordinateConverter {
  public:
@@ -21,6 +50,48 @@ class ECEFToGeoConverter : public ICoordinateConverter {
    */
   explicit ECEFToGeoConverter(const trans_geo::ellipsoid::Ellipsoid& ellipsoid);
 
+  /**
+   * @brief コンストラクタ（精度プリセット指定）
+   * @param ellipsoid 変換に利用する楕円体モデル（例: WGS84）
+   * @param precision 精度プリセット
+   */
+  ECEFToGeoConverter(const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
+                     GeodeticPrecision precision);
+
+  /**
+   * @brief コンストラクタ（反復法の収束条件を指定）
+   *
+   * 緯度の更新量が tolerance 以下になるか、maxIterations
+   * 回反復した時点で打ち切ります。緯度の許容誤差 δ [rad] は、
+   * 地表でおよそ δ × 6.4e6 m の位置誤差に相当します。
+   *
+   * @param ellipsoid     変換に利用する楕円体モデル（例: WGS84）
+   * @param tolerance     緯度の収束判定の許容誤差（ラジアン）
+   * @param maxIterations 最大反復回数
+   * @throw std::invalid_argument tolerance が負、または maxIterations が 1
+   * 未満の場合
+   */
+  ECEFToGeoConverter(const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
+                     double tolerance, int maxIterations);
+
+  /**
+   * @brief コンストラクタ（出力の高さを標高にする）
+   *
+   * 楕円体高 h を求めたあと、ジオイド高 N を補間して標高 H = h - N を
+   * 出力します。格子の範囲外の点の高さは NaN になります。geoid が空の
+   * 場合は楕円体高を出力します。
+   *
+   * @param ellipsoid     変換に利用する楕円体モデル（例: WGS84）
+   * @param precision     精度プリセット
+   * @param geoid         ジオイド高の格子（複数の変換器で共有できる）
+   * @param interpolation ジオイド高の補間方法
+   */
+  ECEFToGeoConverter(const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
+                     GeodeticPrecision precision,
+                     std::shared_ptr<const trans_geo::geoid::GeoidGrid> geoid,
+                     trans_geo::geoid::GeoidInterpolation interpolation =
+                         trans_geo::geoid::GeoidInterpolation::Bilinear);
+
   /**
    * @brief 入力の ECEFCoordinate を GeoCoordinate に変換する
    *
@@ -33,8 +104,58 @@ class ECEFToGeoConverter : public ICoordinateConverter {
   std::unique_ptr<trans_geo::interface::ICoordinate> convert(
       const trans_geo::interface::ICoordinate& input) const override;
 
+  /**
+   * @brief 座標列を一括変換する（例外を送出しない）
+   *
+   * @param input  [X, Y, Z]（メートル）の座標列
+   * @param output [緯度（度）, 経度（度）, 楕円体高（メートル）] の座標列
+   *               （input と同じ点数。ジオイドを指定した場合は標高）
+   * @return ConversionStatus 成功時は ConversionStatus::Ok
+   */
+  ConversionStatus convertBatch(
+      trans_geo::coordinate::ConstPointView input,
+      trans_geo::coordinate::PointView output) const noexcept override;
+
+  /**
+   * @brief int32 固定小数点の座標列を元の単位に戻しながら一括変換する
+   *
+   * 逆量子化は変換カーネルの読み込みに融合しています。値は入力を
+   * dequantize() してから convertBatch() した結果と一致します。
+   * Reference 精度・ジオイド指定時は 256 点ごとに逆量子化してから
+   * convertBatch() します。
+   *
+   * @param input        [X, Y, Z]（メートル）を量子化した座標列
+   * @param quantization 入力の換算
+   * @param output       [緯度（度）, 経度（度）, 楕円体高（メートル）] の出力先
+   *                     （input と同じ点数）
+   * @return ConversionStatus 成功時は ConversionStatus::Ok
+   */
+  ConversionStatus convertBatchDequantized(
+      trans_geo::coordinate::ConstQuantizedPointView input,
+      const trans_geo::coordinate::Quantization& quantization,
+      trans_geo::coordinate::PointView output) const noexcept;
+
+  /**
+   * @brief 精度プリセットを取得する
+   * @return GeodeticPrecision 精度プリセット
+   */
+  GeodeticPrecision getPrecision() const noexcept;
+
  private:
+  /**
+   * @brief 1 点の ECEF 座標を地理座標に変換する
+   * @return std::array<double, 3> [緯度（度）, 経度（度）, 楕円体高（メートル）]
+   */
+  std::array<double, 3> toGeodetic(double X, double Y,
+                                   double Z) const noexcept;
+
   trans_geo::ellipsoid::Ellipsoid ellipsoid_;
+  GeodeticPrecision precision_;  ///< 精度プリセット
+  double tolerance_;             ///< 反復法の許容誤差（ラジアン）
+  int maxIterations_;            ///< 反復法の最大反復回数
+  std::shared_ptr<const trans_geo::geoid::GeoidGrid> geoid_;  ///< 空なら不使用
+  trans_geo::geoid::GeoidInterpolation interpolation_ =
+      trans_geo::geoid::GeoidInterpolation::Bilinear;
 };
 
 }  // namespace trans_geo::conversion
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "coordinate/geo_coordinate.hpp"  // GeoCoordinate の定義
+#include "ellipsoid/ellipsoid.hpp"        // Ellipsoid 構造体の定義
+
+namespace trans_geo::conversion {
+
+/**
+ * @brief 状態ベクトル 1 点あたりの要素数
+ *
+ * 状態ベクトルは位置と速度を交互に並べた [p0, p1, p2, v0, v1, v2]
+ * の形式で、バッチ変換では点ごとにこの 6 要素が連続して格納されます。
+ */
+constexpr std::size_t kStateVectorSize = 6;
+
+/**
+ * @brief ENU 局所座標系の基底（原点の ECEF 座標と回転行列）
+ *
+ * 原点 (GeoCoordinate) から原点の ECEF 座標と ECEF→ENU 回転行列 R
+ * を一度だけ計算して保持します。ECEF⇔ENU の各変換器はこのフレームを
+ * キャッシュし、変換ごとに三角関数を再計算しません。
+ *
+ * 位置は原点オフセットを含めて変換し、速度・加速度などのベクトル量は
+ * 原点オフセットを含まない純粋な回転として変換します。
+ */
+class ENUFrame {
+ public:
+  /**
+   * @brief コンストラクタ
+   *
+   * @param ellipsoid 変換に利用する楕円体モデル（例: WGS84）
+   * @param origin    ENU 座標系の原点（高度省略時は 0 m とみなす）
+   */
+  ENUFrame(const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
+           const trans_geo::coordinate::GeoCoordinate& origin);
+
+  /**
+   * @brief 原点の ECEF 座標を取得する
+   * @return const std::array<double, 3>& [X0, Y0, Z0]（メートル単位）
+   */
+  const std::array<double, 3>& getOriginECEF() const noexcept;
+
+  /**
+   * @brief ECEF→ENU 回転行列を取得する
+   *
+   * 行優先で [R00, R01, R02, R10, ..., R22] の順に格納されています。
+   *
+   * @return const std::array<double, 9>& 回転行列 R
+   */
+  const std::array<double, 9>& getRotation() const noexcept;
+
+  /**
+   * @brief ECEF 位置を ENU 位置に変換する（R * (p - p0)）
+   * @param ecef [X, Y, Z]（メートル単位）
+   * @return std::array<double, 3> [east, north, up]（メートル単位）
+   */
+  std::array<double, 3> toENU(const std::array<double, 3>& ecef) const noexcept;
+
+  /**
+   * @brief ENU 位置を ECEF 位置に変換する（p0 + R^T * e）
+   * @param enu [east, north, up]（メートル単位）
+   * @return std::array<double, 3> [X, Y, Z]（メートル単位）
+   */
+  std::array<double, 3> toECEF(const std::array<double, 3>& enu) const noexcept;
+
+  /**
+   * @brief ECEF 軸のベクトルを ENU 軸に回転する（R * v）
+   *
+   * 速度・加速度など、原点オフセットを伴わないベクトル量に用います。
+   *
+   * @param v ECEF 軸で表したベクトル
+   * @return std::array<double, 3> ENU 軸で表したベクトル
+   */
+  std::array<double, 3> rotateToENU(
+      const std::array<double, 3>& v) const noexcept;
+
+  /**
+   * @brief ENU 軸のベクトルを ECEF 軸に回転する（R^T * v）
+   * @param v ENU 軸で表したベクトル
+   * @return std::array<double, 3> ECEF 軸で表したベクトル
+   */
+  std::array<double, 3> rotateToECEF(
+      const std::array<double, 3>& v) const noexcept;
+
+ private:
+  std::array<double, 3> originEcef_;  ///< 原点の ECEF 座標
+  std::array<double, 9> rotation_;    ///< ECEF→ENU 回転行列（行優先）
+};
+
+}  // namespace trans_geo::conversion
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "coordinate/point_view.hpp"    // PointView / ConstPointView の定義
+#include "coordinate/quantization.hpp"  // Quantization の定義
+
+namespace trans_geo::conversion {
+
+/**
+ * @brief 例外を送出しない変換 API の結果コード
+ *
+ * convertBatch() などの noexcept な API は、入力の検証結果をこの値で返します。
+ * 検証は一括変換の入口で一度だけ行い、点ごとの変換ループには
+ * 失敗する経路を持たせません。
+ */
+enum class ConversionStatus {
+  Ok,                   ///< 成功
+  SizeMismatch,         ///< 入力と出力の点数が一致しない
+  NullBuffer,           ///< 成分の先頭ポインタが nullptr
+  InvalidStride,        ///< 点の間隔が 0
+  InvalidQuantization,  ///< 量子化の scale が正の有限値でない、など
+  /// int32 の範囲を超えた成分を最小値・最大値に飽和した（全点は書き込み済み）
+  Saturated
+};
+
+/**
+ * @brief 結果コードを名前に変換する
+ * @param status 結果コード
+ * @return const char* 名前（例: "SizeMismatch"）
+ */
+const char* toString(ConversionStatus status) noexcept;
+
+/**
+ * @brief 一括変換の入出力ビューを検証する
+ *
+ * 点数の一致・ポインタの有効性・間隔を確認します。入力と出力が同じ領域を
+ * 指す上書き変換は許可されますが、部分的に重なる領域は未定義です。
+ *
+ * @param input  入力ビュー
+ * @param output 出力ビュー
+ * @return ConversionStatus 問題がなければ ConversionStatus::Ok
+ */
+ConversionStatus validateBatch(
+    trans_geo::coordinate::ConstPointView input,
+    trans_geo::coordinate::PointView output) noexcept;
+
+/**
+ * @brief 量子化して出力する一括変換の入出力を検証する
+ *
+ * @param input        入力ビュー
+ * @param output       int32 固定小数点の出力ビュー
+ * @param quantization 出力の換算
+ * @return ConversionStatus 問題がなければ ConversionStatus::Ok
+ */
+ConversionStatus validateBatch(
+    trans_geo::coordinate::ConstPointView input,
+    trans_geo::coordinate::QuantizedPointView output,
+    const trans_geo::coordinate::Quantization& quantization) noexcept;
+
+/**
+ * @brief 量子化した入力を読む一括変換の入出力を検証する
+ *
+ * @param input        int32 固定小数点の入力ビュー
+ * @param quantization 入力の換算
+ * @param output       出力ビュー
+ * @return ConversionStatus 問題がなければ ConversionStatus::Ok
+ */
+ConversionStatus validateBatch(
+    trans_geo::coordinate::ConstQuantizedPointView input,
+    const trans_geo::coordinate::Quantization& quantization,
+    trans_geo::coordinate::PointView output) noexcept;
+
+}  // namespace trans_geo::conversion
@@ -4,6 +4,7 @@
 
 #include "converter/i_coordiante_converter.hpp"
 #include "ellipsoid/ellipsoid.hpp"  // Ellipsoid 構造体の定義
+#include "geoid/geoid_grid.hpp"     // GeoidGrid の定義
 
 namespace trans_geo::conversion {
 
@@ -23,6 +24,22 @@ class GeoToECEFConverter : public ICoordinateConverter {
    */
   explicit GeoToECEFConverter(const trans_geo::ellipsoid::Ellipsoid& ellipsoid);
 
+  /**
+   * @brief コンストラクタ（入力の高さを標高として扱う）
+   *
+   * 入力の高さをジオイド面からの高さ（標高 H）とみなし、ジオイド高 N を
+   * 補間して楕円体高 h = H + N に直してから変換します。格子の範囲外の
+   * 点は NaN になります。geoid が空の場合は楕円体高として扱います。
+   *
+   * @param ellipsoid     変換に利用する楕円体モデル
+   * @param geoid         ジオイド高の格子（複数の変換器で共有できる）
+   * @param interpolation ジオイド高の補間方法
+   */
+  GeoToECEFConverter(const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
+                     std::shared_ptr<const trans_geo::geoid::GeoidGrid> geoid,
+                     trans_geo::geoid::GeoidInterpolation interpolation =
+                         trans_geo::geoid::GeoidInterpolation::Bilinear);
+
   /**
    * @brief GeoCoordinate を ECEFCoordinate に変換する
    *
@@ -34,8 +51,43 @@ class GeoToECEFConverter : public ICoordinateConverter {
   std::unique_ptr<trans_geo::interface::ICoordinate> convert(
       const trans_geo::interface::ICoordinate& input) const override;
 
+  /**
+   * @brief 座標列を一括変換する（例外を送出しない）
+   *
+   * @param input  [緯度（度）, 経度（度）, 楕円体高（メートル）] の座標列
+   *               （ジオイドを指定した場合は標高）
+   * @param output [X, Y, Z]（メートル）の座標列（input と同じ点数）
+   * @return ConversionStatus 成功時は ConversionStatus::Ok
+   */
+  ConversionStatus convertBatch(
+      trans_geo::coordinate::ConstPointView input,
+      trans_geo::coordinate::PointView output) const noexcept override;
+
+  /**
+   * @brief 座標列を一括変換し、結果を int32 固定小数点で書き込む
+   *
+   * 量子化は変換カーネルの書き込みに融合しており、double の中間配列を
+   * 経由しません。値は convertBatch() の結果を quantize() したものと
+   * 一致します。
+   * ジオイドを指定した場合は 256 点ごとに convertBatch() してから量子化します。
+   *
+   * @param input        [緯度（度）, 経度（度）, 楕円体高（メートル）] の座標列
+   * @param output       [X, Y, Z]（メートル）を量子化した出力先
+   *                     （input と同じ点数）
+   * @param quantization 出力の換算
+   * @return ConversionStatus 成功時は ConversionStatus::Ok、int32 の範囲を
+   * 超えた成分があった場合は ConversionStatus::Saturated
+   */
+  ConversionStatus convertBatchQuantized(
+      trans_geo::coordinate::ConstPointView input,
+      trans_geo::coordinate::QuantizedPointView output,
+      const trans_geo::coordinate::Quantization& quantization) const noexcept;
+
  private:
   trans_geo::ellipsoid::Ellipsoid ellipsoid_;
+  std::shared_ptr<const trans_geo::geoid::GeoidGrid> geoid_;  ///< 空なら不使用
+  trans_geo::geoid::GeoidInterpolation interpolation_ =
+      trans_geo::geoid::GeoidInterpolation::Bilinear;
 };
 
 }  // namespace trans_geo::conversion
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "converter/i_coordiante_converter.hpp"  // ICoordinateConverter インターフェースの定義
 #include "coordinate/geo_coordinate.hpp"  // GeoCoordinate の定義
 #include "ellipsoid/ellipsoid.hpp"        // Ellipsoid 構造体の定義
+#include "geoid/geoid_grid.hpp"           // GeoidGrid の定義
 
 namespace trans_geo::conversion {
 
@@ -28,6 +29,23 @@ class GeoToENUConverter : public ICoordinateConverter {
   GeoToENUConverter(const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
                     const trans_geo::coordinate::GeoCoordinate& origin);
 
+  /**
+   * @brief コンストラクタ（入力の高さを標高として扱う）
+   *
+   * 入力の高さを標高とみなし、ジオイド高を加えた楕円体高で変換します
+   * （GeoToECEFConverter を参照）。原点の高度は楕円体高のままです。
+   *
+   * @param ellipsoid     変換に利用する楕円体モデル（例: WGS84）
+   * @param origin        変換の基準となる原点 (GeoCoordinate 型)
+   * @param geoid         ジオイド高の格子
+   * @param interpolation ジオイド高の補間方法
+   */
+  GeoToENUConverter(const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
+                    const trans_geo::coordinate::GeoCoordinate& origin,
+                    std::shared_ptr<const trans_geo::geoid::GeoidGrid> geoid,
+                    trans_geo::geoid::GeoidInterpolation interpolation =
+                        trans_geo::geoid::GeoidInterpolation::Bilinear);
+
   /**
    * @brief 入力の GeoCoordinate を ENUCoordinate に変換する
    *
@@ -39,6 +57,17 @@ class GeoToENUConverter : public ICoordinateConverter {
   std::unique_ptr<trans_geo::interface::ICoordinate> convert(
       const trans_geo::interface::ICoordinate& input) const override;
 
+  /**
+   * @brief 座標列を一括変換する（例外を送出しない）
+   *
+   * @param input  [緯度（度）, 経度（度）, 楕円体高（メートル）] の座標列
+   * @param output [east, north, up]（メートル）の座標列（input と同じ点数）
+   * @return ConversionStatus 成功時は ConversionStatus::Ok
+   */
+  ConversionStatus convertBatch(
+      trans_geo::coordinate::ConstPointView input,
+      trans_geo::coordinate::PointView output) const noexcept override;
+
  private:
   trans_geo::ellipsoid::Ellipsoid ellipsoid_;
   trans_geo::coordinate::GeoCoordinate origin_;
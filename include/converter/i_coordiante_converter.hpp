@@ -1,15 +1,21 @@
 #pragma once
 
+#include <array>
 #include <memory>
 
+#include "converter/conversion_status.hpp"  // ConversionStatus の定義
 #include "coordinate/interface.hpp"  // trans_geo::interface::ICoordinate の定義
+#include "coordinate/point_view.hpp"  // PointView / ConstPointView の定義
 
 namespace trans_geo::conversion {
 
 /**
  * @brief 座標変換器の抽象インターフェース
  *
- * すべての変換戦略は、このインターフェースの convert() を実装します。
+ * すべての変換戦略は、このインターフェースの convert() と convertBatch()
+ * を実装します。convert() は座標オブジェクト単位の API で、入力の型が
+ * 異なる場合は例外を送出します。convertBatch() は例外を送出しない
+ * 一括変換 API で、リアルタイム処理のループから利用できます。
  */
 class ICoordinateConverter {
  public:
@@ -23,6 +29,39 @@ class ICoordinateConverter {
   virtual std::unique_ptr<trans_geo::interface::ICoordinate> convert(
       const trans_geo::interface::ICoordinate& input) const = 0;
 
+  /**
+   * @brief 座標列を一括変換する（例外を送出しない）
+   *
+   * 入力ビューの各点を変換し、出力ビューの同じ位置に書き込みます。
+   * 入出力の成分の並びは変換元・変換先の座標系の getValues() と同じです
+   * （PointView を参照）。検証は呼び出しの入口で一度だけ行い、失敗した
+   * 場合は出力に何も書き込みません。入力と出力に同じ領域を渡して上書き
+   * 変換することもできます。
+   *
+   * @param input  変換対象の座標列
+   * @param output 出力先の座標列（input と同じ点数）
+   * @return ConversionStatus 成功時は ConversionStatus::Ok
+   */
+  virtual ConversionStatus convertBatch(
+      trans_geo::coordinate::ConstPointView input,
+      trans_geo::coordinate::PointView output) const noexcept = 0;
+
+  /**
+   * @brief 1 点を変換する（例外を送出しない）
+   *
+   * ヒープ確保を伴わない convertBatch() の 1 点版です。
+   *
+   * @param input  変換対象の 3 成分
+   * @param output 出力先の 3 成分
+   * @return ConversionStatus 成功時は ConversionStatus::Ok
+   */
+  ConversionStatus convertPoint(const std::array<double, 3>& input,
+                                std::array<double, 3>& output) const noexcept {
+    return convertBatch(
+        trans_geo::coordinate::ConstPointView::interleaved(input.data(), 1),
+        trans_geo::coordinate::PointView::interleaved(output.data(), 1));
+  }
+
   virtual ~ICoordinateConverter() = default;
 };
 }  // namespace trans_geo::conversion
\ No newline at end of file
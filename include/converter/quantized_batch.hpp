@@ -0,0 +1,50 @@
+#pragma once
+
+#include "converter/conversion_status.hpp"  // ConversionStatus の定義
+#include "converter/i_coordiante_converter.hpp"  // ICoordinateConverter インターフェースの定義
+#include "coordinate/point_view.hpp"    // PointView / ConstPointView の定義
+#include "coordinate/quantization.hpp"  // Quantization の定義
+
+namespace trans_geo::conversion {
+
+/**
+ * @brief 任意の変換器で一括変換し、結果を int32 固定小数点で書き込む
+ *
+ * 256 点ごとに convertBatch() で double の局所配列へ変換してから
+ * quantize() で書き込みます。GeoToENU のように融合した版を持たない変換器や、
+ * ジオイドを使う変換器にも使えます。Geo → ECEF・ECEF ⇔ ENU の変換器は
+ * 量子化を変換カーネルに融合したメンバ関数 convertBatchQuantized() を
+ * 持ち、そちらは中間の double 配列を経由しません。
+ *
+ * @param converter    変換器
+ * @param input        入力の座標列
+ * @param output       int32 固定小数点の出力先（input と同じ点数）
+ * @param quantization 出力の換算
+ * @return ConversionStatus 成功時は ConversionStatus::Ok、int32 の範囲を
+ * 超えた成分があった場合は ConversionStatus::Saturated
+ */
+ConversionStatus convertBatchQuantized(
+    const ICoordinateConverter& converter,
+    trans_geo::coordinate::ConstPointView input,
+    trans_geo::coordinate::QuantizedPointView output,
+    const trans_geo::coordinate::Quantization& quantization) noexcept;
+
+/**
+ * @brief int32 固定小数点の入力を元の単位に戻しながら一括変換する
+ *
+ * 256 点ごとに dequantize() で double の局所配列へ戻してから
+ * convertBatch() で変換します。
+ *
+ * @param converter    変換器
+ * @param input        int32 固定小数点の入力
+ * @param quantization 入力の換算
+ * @param output       出力先の座標列（input と同じ点数）
+ * @return ConversionStatus 成功時は ConversionStatus::Ok
+ */
+ConversionStatus convertBatchDequantized(
+    const ICoordinateConverter& converter,
+    trans_geo::coordinate::ConstQuantizedPointView input,
+    const trans_geo::coordinate::Quantization& quantization,
+    trans_geo::coordinate::PointView output) noexcept;
+
+}  // namespace trans_geo::conversion
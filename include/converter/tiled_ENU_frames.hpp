@@ -0,0 +1,191 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "converter/conversion_status.hpp"  // ConversionStatus の定義
+#include "coordinate/geo_coordinate.hpp"    // GeoCoordinate の定義
+#include "coordinate/point_view.hpp"        // PointView の定義
+#include "ellipsoid/ellipsoid.hpp"          // Ellipsoid 構造体の定義
+
+namespace trans_geo::conversion {
+
+/// 既定のタイルの大きさ（度）。タイル中心から約 28 km 以内に収まり、
+/// float の ENU 座標の分解能は 2 mm 程度になる
+constexpr double kDefaultTileSizeDeg = 0.5;
+
+/**
+ * @brief タイルの ENU 座標系（原点の ECEF 座標と ECEF→ENU 回転行列）
+ *
+ * ENUFrame(ellipsoid, タイル中心（高度 0 m）) と同じ値です。
+ */
+struct TileFrame {
+  std::array<double, 3> originEcef;  ///< 原点の ECEF 座標
+  std::array<double, 9> rotation;    ///< ECEF→ENU 回転行列（行優先）
+};
+
+/**
+ * @brief タイルごとにまとめた float の ENU 座標列
+ *
+ * 点はタイル番号の昇順に並べ替えて格納します。第 g グループの点は
+ * [offsets[g], offsets[g + 1]) の範囲にあり、すべて tiles[g] の ENU
+ * 座標系で表します。order は並べ替え後の位置から入力の番号への対応です。
+ */
+struct TiledENUBatch {
+  std::vector<std::uint32_t> tiles;     ///< グループのタイル番号
+  std::vector<std::size_t> offsets;     ///< グループの先頭（末尾に点数）
+  std::vector<std::uint32_t> order;     ///< 並べ替え後の位置 → 入力の番号
+  std::array<std::vector<float>, 3> enu;  ///< [east, north, up]（メートル）
+
+  /**
+   * @brief 点数を取得する
+   * @return std::size_t 点数
+   */
+  std::size_t size() const noexcept { return order.size(); }
+
+  /**
+   * @brief グループ数を取得する
+   * @return std::size_t グループ数
+   */
+  std::size_t groupCount() const noexcept { return tiles.size(); }
+};
+
+/**
+ * @brief 地球全体を緯度・経度のタイルに分け、タイルごとの ENU 座標系で
+ *        座標列を変換する
+ *
+ * 単一の原点の ENU 座標は原点から離れるほど値が大きくなり、float では
+ * 精度が落ちます。このクラスは各点を最寄りのタイル中心を原点とする
+ * ENU 座標系で表すため、大陸規模のデータでも float で一様な精度が
+ * 得られます。
+ *
+ * タイルは南西端 (-90°, -180°) から tileSizeDeg 刻みで区切り、番号は
+ * row * getColumnCount() + column です（北端・東端のタイルは小さくなる
+ * ことがあります）。回転行列と原点は行（緯度）・列（経度）ごとの三角関数を
+ * 構築時に計算しておき、タイル数に比例するメモリは使いません。
+ *
+ * 一括変換は点をタイル順に並べ替え、同じ座標系を共有する連続した点の
+ * グループごとに変換します。変換自体は double で行い、結果を float で
+ * 格納します。構築後は変更できず、複数のスレッドから同時に使えます。
+ */
+class TiledENUFrames {
+ public:
+  /**
+   * @brief コンストラクタ
+   *
+   * @param ellipsoid   変換に利用する楕円体モデル（例: WGS84）
+   * @param tileSizeDeg タイルの大きさ（度）
+   * @throw std::invalid_argument tileSizeDeg が (0, 90] の範囲外の場合、
+   * またはタイル数が 2^32 を超える場合
+   */
+  explicit TiledENUFrames(const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
+                          double tileSizeDeg = kDefaultTileSizeDeg);
+
+  /**
+   * @brief タイルの大きさを取得する
+   * @return double タイルの大きさ（度）
+   */
+  double getTileSize() const noexcept;
+
+  /**
+   * @brief 行（緯度方向）の数を取得する
+   * @return std::size_t 行数
+   */
+  std::size_t getRowCount() const noexcept;
+
+  /**
+   * @brief 列（経度方向）の数を取得する
+   * @return std::size_t 列数
+   */
+  std::size_t getColumnCount() const noexcept;
+
+  /**
+   * @brief 緯度・経度が属するタイルの番号を求める
+   *
+   * 緯度は [-90, 90] に丸め、経度は [-180, 180) に正規化します。
+   * NaN・無限大を含む場合はタイル 0 を返します。
+   *
+   * @param latDeg 緯度（度）
+   * @param lonDeg 経度（度）
+   * @return std::uint32_t タイル番号
+   */
+  std::uint32_t tileOf(double latDeg, double lonDeg) const noexcept;
+
+  /**
+   * @brief タイルの中心（ENU 座標系の原点）を取得する
+   *
+   * @param tile タイル番号
+   * @return trans_geo::coordinate::GeoCoordinate 中心（高度 0 m）
+   * @throw std::out_of_range タイル番号が範囲外の場合
+   */
+  trans_geo::coordinate::GeoCoordinate getTileOrigin(std::uint32_t tile) const;
+
+  /**
+   * @brief タイルの ENU 座標系を取得する
+   *
+   * @param tile タイル番号（範囲外の場合は未定義）
+   * @return TileFrame 原点の ECEF 座標と回転行列
+   */
+  TileFrame getTileFrame(std::uint32_t tile) const noexcept;
+
+  /**
+   * @brief Geo 座標列をタイルごとの ENU 座標に変換する
+   *
+   * @param geo    [緯度（度）, 経度（度）, 楕円体高（メートル）] の座標列
+   * @param output 出力先（内容は置き換える）
+   * @return ConversionStatus 成功時は ConversionStatus::Ok（失敗時は
+   * output を変更しない）
+   */
+  ConversionStatus fromGeo(trans_geo::coordinate::ConstPointView geo,
+                           TiledENUBatch& output) const;
+
+  /**
+   * @brief ECEF 座標列をタイルごとの ENU 座標に変換する
+   *
+   * タイルの判定には、点を楕円体面上にあるとみなした緯度を使います
+   * （高度による差はタイルの境界付近の割り当てにしか影響しません）。
+   *
+   * @param ecef   [X, Y, Z]（メートル）の座標列
+   * @param output 出力先（内容は置き換える）
+   * @return ConversionStatus 成功時は ConversionStatus::Ok（失敗時は
+   * output を変更しない）
+   */
+  ConversionStatus fromECEF(trans_geo::coordinate::ConstPointView ecef,
+                            TiledENUBatch& output) const;
+
+  /**
+   * @brief タイルごとの ENU 座標を入力と同じ順の ECEF 座標に戻す
+   *
+   * @param batch  fromGeo() / fromECEF() の結果
+   * @param output 出力先の座標列（batch.size() 点）
+   * @return ConversionStatus 成功時は ConversionStatus::Ok
+   */
+  ConversionStatus toECEF(const TiledENUBatch& batch,
+                          trans_geo::coordinate::PointView output) const
+      noexcept;
+
+ private:
+  /**
+   * @brief 座標列をタイル順に並べ替え、グループごとに ENU へ変換する
+   */
+  template <typename ToEcef>
+  void convertGrouped(trans_geo::coordinate::ConstPointView input,
+                      const std::vector<std::uint32_t>& tileIds,
+                      ToEcef toEcef, TiledENUBatch& output) const;
+
+  trans_geo::ellipsoid::Ellipsoid ellipsoid_;
+  double tileSize_;
+  double inverseTileSize_;  ///< 1 / tileSize_（タイル判定の除算を避ける）
+  std::size_t rows_;
+  std::size_t columns_;
+  std::vector<double> rowCenter_;  ///< 行の中心緯度（度）
+  std::vector<double> columnCenter_;  ///< 列の中心経度（度）
+  /// 行ごとの [sin(lat), cos(lat), N]（N は卯酉線曲率半径）
+  std::vector<std::array<double, 3>> rowTerms_;
+  /// 列ごとの [sin(lon), cos(lon)]
+  std::vector<std::array<double, 2>> columnTerms_;
+};
+
+}  // namespace trans_geo::conversion
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -43,6 +45,18 @@ class ECEFCoordinate : public trans_geo::interface::ICoordinate {
    */
   void setValues(const std::vector<double>& values) override;
 
+  /**
+   * @brief 座標値の要素数を取得する
+   * @return std::size_t 常に 3
+   */
+  std::size_t valueCount() const noexcept override;
+
+  /**
+   * @brief 座標値を固定長配列で取得する
+   * @return std::array<double, kMaxValues> [x, y, z]
+   */
+  std::array<double, kMaxValues> getValueArray() const noexcept override;
+
   /**
    * @brief 座標情報の文字列表現を返す
    *
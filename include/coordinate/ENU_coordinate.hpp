@@ -1,10 +1,13 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "coordinate/interface.hpp"  // trans_geo::interface::ICoordinate, ICoordinateWithOrigin の定義
+#include "coordinate/origin_handle.hpp"  // OriginHandle の定義
 
 namespace trans_geo::coordinate {
 /**
@@ -15,6 +18,9 @@ namespace trans_geo::coordinate {
  * 原点は trans_geo::interface::ICoordinate
  * 型のオブジェクトで表現され、GeoCoordinate などを利用可能です。 本クラスは
  * trans_geo::interface::ICoordinateWithOrigin インターフェースを実装します。
+ *
+ * 原点は不変な共有ハンドル（OriginHandle）で保持され、clone()
+ * やハンドル指定のコンストラクタでは原点を複製せずに共有します。
  */
 class ENUCoordinate : public trans_geo::interface::ICoordinateWithOrigin {
  public:
@@ -25,13 +31,28 @@ class ENUCoordinate : public trans_geo::interface::ICoordinateWithOrigin {
    * @param north 北方向の座標値（メートル単位）
    * @param up 上方向の座標値（メートル単位）
    * @param origin 原点座標オブジェクト。原点の座標は、ICoordinate の
-   * getValues() により 2 もしくは 3 要素で表現される必要があります。
-   * @throw std::invalid_argument origin の getValues() のサイズが 2 または 3
+   * valueCount() が 2 もしくは 3 である必要があります。
+   * @throw std::invalid_argument origin の valueCount() が 2 または 3
    * でない場合
    */
   ENUCoordinate(double east, double north, double up,
                 const trans_geo::interface::ICoordinate& origin);
 
+  /**
+   * @brief コンストラクタ（原点ハンドルを共有）
+   *
+   * 原点は複製されず、ハンドルのコピーのみが行われます。
+   *
+   * @param east 東方向の座標値（メートル単位）
+   * @param north 北方向の座標値（メートル単位）
+   * @param up 上方向の座標値（メートル単位）
+   * @param origin 原点のハンドル（makeOriginHandle() または internOrigin()
+   * で作成したもの）
+   * @throw std::invalid_argument origin が空の場合、または原点の
+   * valueCount() が 2 または 3 でない場合
+   */
+  ENUCoordinate(double east, double north, double up, OriginHandle origin);
+
   /**
    * @brief ENU 座標値を取得する
    *
@@ -52,6 +73,18 @@ class ENUCoordinate : public trans_geo::interface::ICoordinateWithOrigin {
    */
   void setValues(const std::vector<double>& values) override;
 
+  /**
+   * @brief 座標値の要素数を取得する
+   * @return std::size_t 常に 3
+   */
+  std::size_t valueCount() const noexcept override;
+
+  /**
+   * @brief 座標値を固定長配列で取得する
+   * @return std::array<double, kMaxValues> [east, north, up]
+   */
+  std::array<double, kMaxValues> getValueArray() const noexcept override;
+
   /**
    * @brief 座標情報の文字列表現を返す
    *
@@ -66,12 +99,20 @@ class ENUCoordinate : public trans_geo::interface::ICoordinateWithOrigin {
    * @brief 原点座標を取得する
    *
    * 原点は trans_geo::interface::ICoordinate 型のオブジェクトで表現されます。
+   * 呼び出しごとに複製を確保するため、参照のみが目的の場合は
+   * getOriginHandle() を利用してください。
    *
-   * @return std::shared_ptr<trans_geo::interface::ICoordinate>
-   * 原点座標オブジェクト
+   * @return std::unique_ptr<trans_geo::interface::ICoordinate>
+   * 原点座標オブジェクトのコピー
    */
   std::unique_ptr<trans_geo::interface::ICoordinate> getOrigin() const override;
 
+  /**
+   * @brief 共有している原点のハンドルを取得する
+   * @return const OriginHandle& 原点のハンドル
+   */
+  const OriginHandle& getOriginHandle() const noexcept;
+
   /**
    * @brief 原点座標を設定する
    *
@@ -79,11 +120,20 @@ class ENUCoordinate : public trans_geo::interface::ICoordinateWithOrigin {
    * 型のオブジェクトで表現されなければなりません。
    *
    * @param origin 原点座標オブジェクト
-   * @throw std::invalid_argument origin の getValues() のサイズが 2 または 3
+   * @throw std::invalid_argument origin の valueCount() が 2 または 3
    * でない場合
    */
   void setOrigin(const trans_geo::interface::ICoordinate& origin) override;
 
+  /**
+   * @brief 原点のハンドルを設定する（原点は複製されません）
+   *
+   * @param origin 原点のハンドル
+   * @throw std::invalid_argument origin が空の場合、または原点の
+   * valueCount() が 2 または 3 でない場合
+   */
+  void setOriginHandle(OriginHandle origin);
+
   /**
    * @brief 東方向の座標値を取得する
    * @return double 東方向の座標値（メートル単位）
@@ -124,6 +174,7 @@ class ENUCoordinate : public trans_geo::interface::ICoordinateWithOrigin {
    * @brief 仮想クローン
    *
    * この ENUCoordinate オブジェクトのコピーを生成します。
+   * 原点は複製せず、ハンドルを共有します。
    *
    * @return std::unique_ptr<trans_geo::interface::ICoordinate>
    * このオブジェクトのコピー
@@ -134,7 +185,6 @@ class ENUCoordinate : public trans_geo::interface::ICoordinateWithOrigin {
   double east_;   ///< 東方向の座標値（メートル単位）
   double north_;  ///< 北方向の座標値（メートル単位）
   double up_;     ///< 上方向の座標値（メートル単位）
-  std::shared_ptr<trans_geo::interface::ICoordinate>
-      origin_;  ///< 原点座標オブジェクト
+  OriginHandle origin_;  ///< 共有された不変の原点座標
 };
 }  // namespace trans_geo::coordinate
\ No newline at end of file
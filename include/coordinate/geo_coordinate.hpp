@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <vector>
@@ -53,6 +55,18 @@ class GeoCoordinate : public trans_geo::interface::ICoordinate {
    */
   void setValues(const std::vector<double>& values) override;
 
+  /**
+   * @brief 座標値の要素数を取得する
+   * @return std::size_t 高度ありなら 3、なしなら 2
+   */
+  std::size_t valueCount() const noexcept override;
+
+  /**
+   * @brief 座標値を固定長配列で取得する
+   * @return std::array<double, kMaxValues> [緯度, 経度, 高度]（高度なしは 0）
+   */
+  std::array<double, kMaxValues> getValueArray() const noexcept override;
+
   /**
    * @brief 座標情報の文字列表現を返す
    *
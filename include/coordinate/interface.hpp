@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <iomanip>
 #include <memory>
 #include <sstream>
@@ -15,12 +17,17 @@ namespace trans_geo::interface {
  */
 class ICoordinate {
  public:
+  /// 座標値の最大要素数
+  static constexpr std::size_t kMaxValues = 3;
+
   virtual ~ICoordinate() = default;
 
   /**
    * @brief 座標値を取得する
    *
    * 例: [x, y, z] または [緯度, 経度, 高度] の形式で返します。
+   * 呼び出しごとにベクトルを確保するため、頻繁に読み出す場合は
+   * getValueArray() と valueCount() を利用してください。
    *
    * @return std::vector<double> 座標値のベクトル
    */
@@ -35,6 +42,25 @@ class ICoordinate {
    */
   virtual void setValues(const std::vector<double>& values) = 0;
 
+  /**
+   * @brief 座標値の要素数を取得する
+   *
+   * getValues().size() と同じ値を、ヒープ確保なしで返します。
+   *
+   * @return std::size_t 要素数（kMaxValues 以下）
+   */
+  virtual std::size_t valueCount() const noexcept = 0;
+
+  /**
+   * @brief 座標値を固定長配列で取得する
+   *
+   * getValues() と同じ並びの値を、ヒープ確保なしで返します。
+   * valueCount() 以降の要素は 0 です。
+   *
+   * @return std::array<double, kMaxValues> 座標値
+   */
+  virtual std::array<double, kMaxValues> getValueArray() const noexcept = 0;
+
   /**
    * @brief 座標情報の文字列表現を返す
    *
@@ -43,12 +69,13 @@ class ICoordinate {
    * @return std::string 座標の文字列表現
    */
   virtual std::string toString() const {
-    auto values = getValues();
+    auto values = getValueArray();
+    std::size_t count = valueCount();
     std::ostringstream oss;
     oss << std::fixed << std::setprecision(6) << "[";
-    for (size_t i = 0; i < values.size(); ++i) {
+    for (size_t i = 0; i < count; ++i) {
       oss << values[i];
-      if (i != values.size() - 1) {
+      if (i != count - 1) {
         oss << ", ";
       }
     }
@@ -86,7 +113,7 @@ class ICoordinateWithOrigin : public ICoordinate {
    * @brief 原点座標を設定する
    *
    * @param origin 原点座標オブジェクト（コピー渡し）
-   * @throw std::invalid_argument origin の getValues() のサイズが 2 または 3
+   * @throw std::invalid_argument origin の valueCount() が 2 または 3
    * でない場合
    */
   virtual void setOrigin(const ICoordinate& origin) = 0;
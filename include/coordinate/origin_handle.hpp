@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+
+#include "coordinate/interface.hpp"  // trans_geo::interface::ICoordinate の定義
+
+namespace trans_geo::coordinate {
+
+/**
+ * @brief 不変な原点座標への共有ハンドル
+ *
+ * ENUCoordinate は原点をこのハンドルで保持し、複製時にはハンドルのみを
+ * コピーします。同じ変換器が出力する ENU 座標はすべて 1 つの原点を
+ * 共有するため、点ごとの原点の確保が発生しません。
+ */
+using OriginHandle = std::shared_ptr<const trans_geo::interface::ICoordinate>;
+
+/**
+ * @brief 原点座標を複製してハンドルを作成する
+ *
+ * @param origin 原点座標オブジェクト
+ * @return OriginHandle 原点の複製を指すハンドル
+ * @throw std::invalid_argument origin の valueCount() が 2 または 3
+ * でない場合
+ */
+OriginHandle makeOriginHandle(const trans_geo::interface::ICoordinate& origin);
+
+/**
+ * @brief 原点座標をインターンしてハンドルを取得する
+ *
+ * 型と座標値が等しい原点がすでに登録されていれば同じハンドルを返し、
+ * なければ複製して登録します。登録表は弱参照のみを保持するため、
+ * どこからも参照されなくなった原点は解放されます。スレッドセーフです。
+ *
+ * @param origin 原点座標オブジェクト
+ * @return OriginHandle 共有された原点のハンドル
+ * @throw std::invalid_argument origin の valueCount() が 2 または 3
+ * でない場合
+ */
+OriginHandle internOrigin(const trans_geo::interface::ICoordinate& origin);
+
+}  // namespace trans_geo::coordinate
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "coordinate/point_view.hpp"  // PointView / ConstPointView の定義
+
+namespace trans_geo::coordinate {
+
+/**
+ * @brief 成分ごとの配列（SoA）で座標列を保持するコンテナ
+ *
+ * view() で一括変換にそのまま渡せるビューを取得できます。
+ * 要素の追加やサイズ変更で配列が再確保されると、以前に取得した
+ * ビューは無効になります。
+ */
+class PointBuffer {
+ public:
+  PointBuffer() = default;
+
+  /**
+   * @brief 0 で初期化した size 点分の領域を確保する
+   * @param size 点数
+   */
+  explicit PointBuffer(std::size_t size)
+      : components_{std::vector<double>(size), std::vector<double>(size),
+                    std::vector<double>(size)} {}
+
+  /**
+   * @brief 点数を取得する
+   * @return std::size_t 点数
+   */
+  std::size_t size() const noexcept { return components_[0].size(); }
+
+  /**
+   * @brief 点数を変更する（追加分は 0 で初期化）
+   * @param size 点数
+   */
+  void resize(std::size_t size) {
+    for (auto& component : components_) component.resize(size);
+  }
+
+  /**
+   * @brief size 点分の容量を予約する
+   * @param size 点数
+   */
+  void reserve(std::size_t size) {
+    for (auto& component : components_) component.reserve(size);
+  }
+
+  /**
+   * @brief すべての点を削除する
+   */
+  void clear() noexcept {
+    for (auto& component : components_) component.clear();
+  }
+
+  /**
+   * @brief 末尾に 1 点追加する
+   * @param values 3 成分
+   */
+  void push_back(const std::array<double, 3>& values) {
+    for (std::size_t k = 0; k < 3; ++k) components_[k].push_back(values[k]);
+  }
+
+  /**
+   * @brief 成分の配列を取得する
+   * @param k 成分番号（0〜2）
+   * @return const std::vector<double>& 第 k 成分の配列
+   */
+  const std::vector<double>& component(std::size_t k) const noexcept {
+    return components_[k];
+  }
+
+  /**
+   * @brief 書き込み可能なビューを取得する
+   * @return PointView 全点を指すビュー
+   */
+  PointView view() noexcept {
+    return PointView::columns(components_[0].data(), components_[1].data(),
+                              components_[2].data(), size());
+  }
+
+  /**
+   * @brief 読み取り専用のビューを取得する
+   * @return ConstPointView 全点を指すビュー
+   */
+  ConstPointView view() const noexcept {
+    return ConstPointView::columns(components_[0].data(),
+                                   components_[1].data(),
+                                   components_[2].data(), size());
+  }
+
+ private:
+  std::array<std::vector<double>, 3> components_;
+};
+
+}  // namespace trans_geo::coordinate
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace trans_geo::coordinate {
+
+/**
+ * @brief 3 成分の座標列を指す非所有ビュー
+ *
+ * 一括変換の入出力に用いる、ヒープ確保を伴わない軽量なビューです。
+ * 第 i 点の第 k 成分は component(k)[i * stride()] に格納されます。
+ * 成分の並びは各座標クラスの getValues() と同じです。
+ *
+ * - Geo  : [緯度（度）, 経度（度）, 楕円体高（メートル）]
+ * - ECEF : [X, Y, Z]（メートル）
+ * - ENU  : [east, north, up]（メートル）
+ *
+ * 点ごとに成分を連続して並べた配列（AoS）は interleaved()、成分ごとの
+ * 配列（SoA）は columns() で作成します。状態ベクトルのように点ごとに
+ * 余分な要素を含む配列も、stride を指定すれば位置成分だけを指せます。
+ *
+ * @tparam T double または const double（int32 固定小数点の座標列は
+ *           std::int32_t、quantization.hpp を参照）
+ */
+template <typename T>
+class BasicPointView {
+ public:
+  using value_type = std::remove_const_t<T>;
+
+  constexpr BasicPointView() noexcept = default;
+
+  /**
+   * @brief コンストラクタ
+   *
+   * @param c0     第 0 成分の先頭
+   * @param c1     第 1 成分の先頭
+   * @param c2     第 2 成分の先頭
+   * @param size   点数
+   * @param stride 点と点の間隔（要素数）
+   */
+  constexpr BasicPointView(T* c0, T* c1, T* c2, std::size_t size,
+                           std::size_t stride) noexcept
+      : components_{c0, c1, c2}, size_(size), stride_(stride) {}
+
+  /**
+   * @brief 点ごとに成分を連続して並べた配列（AoS）からビューを作成する
+   *
+   * @param data   先頭点の第 0 成分
+   * @param size   点数
+   * @param stride 点と点の間隔（要素数、既定は 3）
+   * @return BasicPointView ビュー
+   */
+  static constexpr BasicPointView interleaved(T* data, std::size_t size,
+                                              std::size_t stride = 3) noexcept {
+    if (data == nullptr) {
+      return BasicPointView(nullptr, nullptr, nullptr, size, stride);
+    }
+    return BasicPointView(data, data + 1, data + 2, size, stride);
+  }
+
+  /**
+   * @brief 成分ごとの配列（SoA）からビューを作成する
+   *
+   * @param c0   第 0 成分の配列
+   * @param c1   第 1 成分の配列
+   * @param c2   第 2 成分の配列
+   * @param size 点数
+   * @return BasicPointView ビュー
+   */
+  static constexpr BasicPointView columns(T* c0, T* c1, T* c2,
+                                          std::size_t size) noexcept {
+    return BasicPointView(c0, c1, c2, size, 1);
+  }
+
+  /**
+   * @brief 可変ビューから読み取り専用ビューへの変換
+   */
+  template <typename U = T,
+            typename = std::enable_if_t<std::is_same_v<U, T> &&
+                                        !std::is_const_v<U>>>
+  constexpr operator BasicPointView<const U>() const noexcept {
+    return BasicPointView<const U>(components_[0], components_[1],
+                                   components_[2], size_, stride_);
+  }
+
+  /**
+   * @brief 点数を取得する
+   * @return std::size_t 点数
+   */
+  constexpr std::size_t size() const noexcept { return size_; }
+
+  /**
+   * @brief 点と点の間隔（要素数）を取得する
+   * @return std::size_t 間隔
+   */
+  constexpr std::size_t stride() const noexcept { return stride_; }
+
+  /**
+   * @brief 成分の先頭ポインタを取得する
+   * @param k 成分番号（0〜2）
+   * @return T* 第 k 成分の先頭
+   */
+  constexpr T* component(std::size_t k) const noexcept {
+    return components_[k];
+  }
+
+  /**
+   * @brief 第 i 点の第 k 成分を参照する
+   * @param i 点番号
+   * @param k 成分番号（0〜2）
+   * @return T& 成分への参照
+   */
+  constexpr T& operator()(std::size_t i, std::size_t k) const noexcept {
+    return components_[k][i * stride_];
+  }
+
+  /**
+   * @brief 第 i 点の 3 成分を取得する
+   * @param i 点番号
+   * @return std::array<value_type, 3> 3 成分
+   */
+  constexpr std::array<value_type, 3> get(std::size_t i) const noexcept {
+    std::size_t offset = i * stride_;
+    return {components_[0][offset], components_[1][offset],
+            components_[2][offset]};
+  }
+
+  /**
+   * @brief 第 i 点の 3 成分を設定する
+   * @param i      点番号
+   * @param values 3 成分
+   */
+  template <typename U = T,
+            typename = std::enable_if_t<std::is_same_v<U, T> &&
+                                        !std::is_const_v<U>>>
+  constexpr void set(std::size_t i,
+                     const std::array<value_type, 3>& values) const noexcept {
+    std::size_t offset = i * stride_;
+    components_[0][offset] = values[0];
+    components_[1][offset] = values[1];
+    components_[2][offset] = values[2];
+  }
+
+  /**
+   * @brief 部分ビューを取得する
+   * @param offset 先頭の点番号
+   * @param count  点数
+   * @return BasicPointView [offset, offset + count) の点を指すビュー
+   */
+  constexpr BasicPointView subview(std::size_t offset,
+                                   std::size_t count) const noexcept {
+    std::size_t shift = offset * stride_;
+    return BasicPointView(components_[0] + shift, components_[1] + shift,
+                          components_[2] + shift, count, stride_);
+  }
+
+  /**
+   * @brief すべての成分の先頭が有効か（size が 0 の場合は常に真）
+   * @return bool 有効なら true
+   */
+  constexpr bool hasData() const noexcept {
+    return size_ == 0 || (components_[0] != nullptr &&
+                          components_[1] != nullptr &&
+                          components_[2] != nullptr);
+  }
+
+ private:
+  std::array<T*, 3> components_{nullptr, nullptr, nullptr};
+  std::size_t size_ = 0;
+  std::size_t stride_ = 3;
+};
+
+/// 書き込み可能な座標列ビュー
+using PointView = BasicPointView<double>;
+
+/// 読み取り専用の座標列ビュー
+using ConstPointView = BasicPointView<const double>;
+
+}  // namespace trans_geo::coordinate
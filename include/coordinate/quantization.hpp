@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "coordinate/point_view.hpp"  // BasicPointView の定義
+
+namespace trans_geo::coordinate {
+
+/// 書き込み可能な int32 固定小数点の座標列ビュー
+using QuantizedPointView = BasicPointView<std::int32_t>;
+
+/// 読み取り専用の int32 固定小数点の座標列ビュー
+using ConstQuantizedPointView = BasicPointView<const std::int32_t>;
+
+/**
+ * @brief int32 固定小数点の座標の換算
+ *
+ * 第 k 成分の値 v を q = round((v - offset[k]) / scale[k]) として格納し、
+ * q * scale[k] + offset[k] で元の単位に戻します。丸めは最近接偶数丸めです。
+ * double の 3 成分（24 バイト）が 12 バイトになり、帯域で律速する処理の
+ * 転送量が半分になります。
+ *
+ * 表せる範囲は offset[k] ± 2^31 * scale[k] です。ミリメートル単位では
+ * ±2147 km のため、原点からの ENU にはそのまま使えますが、ECEF では
+ * 地域の中心を offset にするか、センチメートル単位（±21474 km）にします。
+ */
+struct Quantization {
+  std::array<double, 3> scale;   ///< 1 単位の大きさ（正の有限値）
+  std::array<double, 3> offset;  ///< q = 0 に対応する値
+
+  /**
+   * @brief 3 成分に同じ scale を使う換算を作る
+   * @param scale  1 単位の大きさ（例: ミリメートルなら 0.001）
+   * @param offset q = 0 に対応する値
+   * @return Quantization 換算
+   */
+  static constexpr Quantization uniform(
+      double scale, const std::array<double, 3>& offset = {0.0, 0.0, 0.0}) {
+    return {{scale, scale, scale}, offset};
+  }
+
+  /**
+   * @brief 換算が有効かを判定する
+   * @return bool scale が正の有限値で offset が有限の場合は true
+   */
+  bool isValid() const noexcept {
+    for (std::size_t k = 0; k < 3; ++k) {
+      if (!(std::isfinite(scale[k]) && scale[k] > 0.0 &&
+            std::isfinite(offset[k]))) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+/// ミリメートル単位（原点 0）の換算
+inline constexpr Quantization kMillimetreQuantization =
+    Quantization::uniform(1e-3);
+
+/**
+ * @brief 値を int32 固定小数点に量子化する
+ *
+ * int32 の範囲を超える値は最小値または最大値に飽和します。NaN は最小値に
+ * なります。一括変換の量子化出力はこの関数と同じ値を書き込みます。
+ *
+ * @param value     値
+ * @param scale     1 単位の大きさ
+ * @param offset    q = 0 に対応する値
+ * @param saturated 飽和した場合に true を設定する（それ以外は変更しない）
+ * @return std::int32_t 量子化した値
+ */
+inline std::int32_t quantize(double value, double scale, double offset,
+                             bool& saturated) noexcept {
+  constexpr double kMin = -2147483648.0;
+  constexpr double kMax = 2147483647.0;
+  double rounded = std::nearbyint((value - offset) / scale);
+  if (rounded >= kMin && rounded <= kMax) {
+    return static_cast<std::int32_t>(rounded);
+  }
+  saturated = true;
+  return static_cast<std::int32_t>(rounded > kMax ? kMax : kMin);
+}
+
+/**
+ * @brief int32 固定小数点の値を元の単位に戻す
+ *
+ * @param quantized 量子化した値
+ * @param scale     1 単位の大きさ
+ * @param offset    q = 0 に対応する値
+ * @return double 値
+ */
+constexpr double dequantize(std::int32_t quantized, double scale,
+                            double offset) noexcept {
+  return static_cast<double>(quantized) * scale + offset;
+}
+
+}  // namespace trans_geo::coordinate
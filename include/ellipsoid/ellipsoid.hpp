@@ -1,40 +1,67 @@
 #pragma once
 
 namespace trans_geo::ellipsoid {
+// 楕円体モデル
+//
+// 長半径 a と扁平率 f から、変換の計算で使う派生定数を構築時に
+// 一度だけ計算して保持する（点ごとに 1 - e2 や b を計算し直さない）。
+// 平方根を使わずに求まる量だけなので、すべて constexpr で計算できる。
+// 派生定数は構築時にしか計算しないため、a や f を変えたい場合は
+// メンバを書き換えず、新しい Ellipsoid を構築して代入する。
 struct Ellipsoid {
   double a;   // 長半径
   double f;   // 扁平率
   double e2;  // 離心率²
 
+  // 派生定数
+  double b;           // 短半径 a(1 - f)
+  double oneMinusE2;  // 1 - e2（= (b / a)²）
+  double ep2;         // 第二離心率² e2 / (1 - e2)
+  double a2;          // a²
+  double b2;          // b²
+  double invA;        // 1 / a
+  double aE2;         // a e2
+  double bEp2;        // b e'²
+
   constexpr Ellipsoid(double a_, double f_)
-      : a(a_), f(f_), e2(eccentricitySquared()) {}
+      : a(a_),
+        f(f_),
+        e2(eccentricitySquared()),
+        b(a_ * (1.0 - f_)),
+        oneMinusE2(1.0 - e2),
+        ep2(e2 / oneMinusE2),
+        a2(a_ * a_),
+        b2(b * b),
+        invA(1.0 / a_),
+        aE2(a_ * e2),
+        bEp2(b * ep2) {}
 
   constexpr double eccentricitySquared() const { return 2 * f - f * f; }
 };
 
 // WGS84
-constinit const Ellipsoid WGS84{6378137.0, 1.0 / 298.257223563};
+constexpr Ellipsoid WGS84{6378137.0, 1.0 / 298.257223563};
 
 // GRS80
-constinit const Ellipsoid GRS80{6378137.0, 1.0 / 298.257222101};
+constexpr Ellipsoid GRS80{6378137.0, 1.0 / 298.257222101};
 
 // 以下おまけ
 // IERS2003
-constinit const Ellipsoid IERS2003{6378136.6, 1.0 / 298.25642};
+constexpr Ellipsoid IERS2003{6378136.6, 1.0 / 298.25642};
 
 // GRS67
-constinit const Ellipsoid GRS67{6378160.0, 1.0 / 298.247167427};
+constexpr Ellipsoid GRS67{6378160.0, 1.0 / 298.247167427};
 
 // Airy 1830
-constinit const Ellipsoid Airy1830{6377563.396, 1.0 / 299.3249646};
+constexpr Ellipsoid Airy1830{6377563.396, 1.0 / 299.3249646};
 
 // Bessel 1841
-constinit const Ellipsoid Bessel1841{6377397.155, 1.0 / 299.1528128};
+constexpr Ellipsoid Bessel1841{6377397.155, 1.0 / 299.1528128};
 
 // Clarke 1866
-constinit const Ellipsoid Clarke1866{6378206.4, 1.0 / 294.9786982};
+constexpr Ellipsoid Clarke1866{6378206.4, 1.0 / 294.9786982};
 
 // International 1924 (Hayford 1909)
-constinit const Ellipsoid International1924{6378388.0, 1.0 / 297.0};
+constexpr Ellipsoid International1924{6378388.0, 1.0 / 297.0};
 
 }  // namespace trans_geo::ellipsoid
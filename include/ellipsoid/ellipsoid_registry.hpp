@@ -0,0 +1,91 @@
+#pragma once
+
+#include <span>
+#include <stdexcept>
+#include <string>
+
+#include "ellipsoid/ellipsoid.hpp"  // Ellipsoid 構造体の定義
+
+namespace trans_geo::ellipsoid {
+
+/**
+ * @brief EPSG コードと楕円体の対応
+ */
+struct EllipsoidDefinition {
+  int epsgCode;         ///< EPSG コード（楕円体または測地座標系）
+  const char* name;     ///< 名称
+  Ellipsoid ellipsoid;  ///< 派生定数を含む楕円体モデル
+};
+
+/**
+ * @brief EPSG コードから楕円体を引くための表
+ *
+ * 楕円体のコード（7xxx）に加えて、よく使う測地座標系のコードも
+ * その座標系が用いる楕円体に対応付けています。楕円体は派生定数を含めて
+ * コンパイル時に計算済みのため、実行時に選択しても点ごとの費用は
+ * 変わりません。
+ */
+inline constexpr EllipsoidDefinition kEllipsoidRegistry[] = {
+    // 楕円体
+    {7030, "WGS 84", WGS84},
+    {7019, "GRS 1980", GRS80},
+    {7036, "GRS 1967", GRS67},
+    {7001, "Airy 1830", Airy1830},
+    {7004, "Bessel 1841", Bessel1841},
+    {7008, "Clarke 1866", Clarke1866},
+    {7022, "International 1924", International1924},
+    // 測地座標系
+    {4326, "WGS 84", WGS84},
+    {4978, "WGS 84 (geocentric)", WGS84},
+    {4979, "WGS 84 (3D)", WGS84},
+    {6668, "JGD2011", GRS80},
+    {4612, "JGD2000", GRS80},
+    {4258, "ETRS89", GRS80},
+    {4269, "NAD83", GRS80},
+    {4267, "NAD27", Clarke1866},
+    {4301, "Tokyo", Bessel1841},
+    {4277, "OSGB36", Airy1830},
+};
+
+/**
+ * @brief 登録されているすべての対応を取得する
+ * @return std::span<const EllipsoidDefinition> 登録内容
+ */
+constexpr std::span<const EllipsoidDefinition> registeredEllipsoids() noexcept {
+  return kEllipsoidRegistry;
+}
+
+/**
+ * @brief EPSG コードに対応する楕円体を探す
+ *
+ * 返すポインタは登録表の要素を指し、プログラムの終了まで有効です。
+ *
+ * @param epsgCode EPSG コード
+ * @return const Ellipsoid* 楕円体。未登録の場合は nullptr
+ */
+constexpr const Ellipsoid* findEllipsoid(int epsgCode) noexcept {
+  for (const EllipsoidDefinition& definition : kEllipsoidRegistry) {
+    if (definition.epsgCode == epsgCode) {
+      return &definition.ellipsoid;
+    }
+  }
+  return nullptr;
+}
+
+/**
+ * @brief EPSG コードに対応する楕円体を取得する
+ *
+ * @param epsgCode EPSG コード
+ * @return const Ellipsoid& 楕円体
+ * @throw std::out_of_range 未登録のコードの場合
+ */
+inline const Ellipsoid& ellipsoidFromEpsg(int epsgCode) {
+  const Ellipsoid* ellipsoid = findEllipsoid(epsgCode);
+  if (ellipsoid == nullptr) {
+    throw std::out_of_range("ellipsoidFromEpsg: unknown EPSG code " +
+                            std::to_string(epsgCode));
+  }
+  return *ellipsoid;
+}
+
+}  // namespace trans_geo::ellipsoid
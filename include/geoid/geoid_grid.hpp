@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "coordinate/point_view.hpp"  // ConstPointView の定義
+#include "io/mapped_file.hpp"         // MappedFile の定義
+
+namespace trans_geo::geoid {
+
+/// GTX ファイルのヘッダのバイト数
+constexpr std::size_t kGtxHeaderSize = 40;
+
+/// GTX ファイルで値がないことを表すジオイド高
+constexpr float kGtxNoData = -88.8888f;
+
+/**
+ * @brief ジオイド高の補間方法
+ */
+enum class GeoidInterpolation : std::uint8_t {
+  Bilinear,  ///< 周囲 2×2 点の双線形補間
+  Bicubic    ///< 周囲 4×4 点の双 3 次補間（Catmull-Rom）
+};
+
+/**
+ * @brief ジオイド高の格子の配置
+ *
+ * 格子点 (row, column) の位置は
+ * (south + row * latitudeSpacing, west + column * longitudeSpacing) です。
+ */
+struct GeoidGridLayout {
+  double south;             ///< 南端の緯度（度）
+  double west;              ///< 西端の経度（度）
+  double latitudeSpacing;   ///< 緯度方向の間隔（度）
+  double longitudeSpacing;  ///< 経度方向の間隔（度）
+  std::uint32_t rows;       ///< 緯度方向の格子点数
+  std::uint32_t columns;    ///< 経度方向の格子点数
+};
+
+/**
+ * @brief 格子のジオイド高を GTX 形式にシリアライズする
+ *
+ * GTX は PROJ などで使われる NOAA の格子形式で、ビッグエンディアンの
+ * ヘッダ（南端・西端・間隔の double 4 個と行数・列数の int32 2 個）に
+ * 続いて、南の行から順に float のジオイド高を格納します。
+ *
+ * @param layout 格子の配置
+ * @param values ジオイド高（メートル、rows * columns 個、南の行から順）
+ * @return std::vector<std::byte> シリアライズしたバイト列
+ * @throw std::invalid_argument values の個数が一致しない場合
+ */
+std::vector<std::byte> serializeGtx(const GeoidGridLayout& layout,
+                                    std::span<const float> values);
+
+/**
+ * @brief GTX 形式のジオイド高の格子（EGM96 / EGM2008 の格子など）
+ *
+ * ファイルはメモリマップし、構築時にはヘッダだけを読みます。格子の値は
+ * 補間で参照したページだけがその時点で読み込まれるため、全球の細かい
+ * 格子でも起動は速く、メモリも参照した範囲の分しか使いません。
+ *
+ * 経度方向に 360° を覆う格子は経度を周期的に扱います。それ以外の格子、
+ * および緯度が格子の範囲外の点のジオイド高は NaN です。
+ *
+ * 一括補間は点を小さなブロックに分け、格子の番号と重みの計算・格子点の
+ * 読み出し・重み付き和をそれぞれ分岐のないループで処理するため、
+ * 番号の計算と和はコンパイラがベクトル化できます。
+ *
+ * 構築後は変更できず、複数のスレッドから同時に使えます。ムーブのみ可能です。
+ */
+class GeoidGrid {
+ public:
+  /**
+   * @brief GTX ファイルをメモリマップする
+   *
+   * @param path GTX ファイルのパス
+   * @throw std::system_error ファイルを開けない、またはマップできない場合
+   * @throw std::invalid_argument ヘッダまたはファイルサイズが不正な場合
+   */
+  explicit GeoidGrid(const std::string& path);
+
+  /**
+   * @brief メモリ上の GTX 形式のバイト列を参照する（コピーしない）
+   *
+   * @param buffer GTX 形式のバイト列（寿命は呼び出し側が保証する）
+   * @throw std::invalid_argument ヘッダまたはサイズが不正な場合
+   */
+  explicit GeoidGrid(std::span<const std::byte> buffer);
+
+  GeoidGrid(GeoidGrid&&) noexcept = default;
+  GeoidGrid& operator=(GeoidGrid&&) noexcept = default;
+
+  /**
+   * @brief 格子の配置を取得する
+   * @return const GeoidGridLayout& 格子の配置
+   */
+  const GeoidGridLayout& getLayout() const noexcept;
+
+  /**
+   * @brief 1 点のジオイド高を補間する
+   *
+   * @param latDeg 緯度（度）
+   * @param lonDeg 経度（度）
+   * @param method 補間方法
+   * @return double ジオイド高（メートル）。範囲外・値のない格子点を
+   * 含む場合は NaN
+   */
+  double undulation(
+      double latDeg, double lonDeg,
+      GeoidInterpolation method = GeoidInterpolation::Bilinear) const noexcept;
+
+  /**
+   * @brief 緯度・経度の配列のジオイド高を一括補間する
+   *
+   * @param latDeg 緯度（度）の配列
+   * @param lonDeg 経度（度）の配列（latDeg と同じ長さ）
+   * @param output 出力先（先頭から min(latDeg.size(), output.size()) 点）
+   * @param method 補間方法
+   */
+  void undulations(
+      std::span<const double> latDeg, std::span<const double> lonDeg,
+      std::span<double> output,
+      GeoidInterpolation method = GeoidInterpolation::Bilinear) const noexcept;
+
+  /**
+   * @brief Geo 座標列のジオイド高を一括補間する
+   *
+   * @param geo    [緯度（度）, 経度（度）, 高さ] の座標列（高さは参照しない）
+   * @param output 出力先（先頭から min(geo.size(), output.size()) 点）
+   * @param method 補間方法
+   */
+  void undulations(
+      trans_geo::coordinate::ConstPointView geo, std::span<double> output,
+      GeoidInterpolation method = GeoidInterpolation::Bilinear) const noexcept;
+
+ private:
+  void parseHeader(std::span<const std::byte> buffer);
+
+  double value(std::int64_t row, std::int64_t column) const noexcept;
+  double node(std::int64_t row, std::int64_t column) const noexcept;
+
+  void interpolate(const double* lat, const double* lon, std::size_t stride,
+                   std::size_t count, double* output,
+                   GeoidInterpolation method) const noexcept;
+
+  std::optional<trans_geo::io::MappedFile> file_;  ///< 所有するマップ
+  const std::byte* values_ = nullptr;  ///< 格子値の先頭（ビッグエンディアン）
+  GeoidGridLayout layout_{};
+  /// 経度方向の周期（列数）。360° を覆わない格子では 0
+  std::uint32_t period_ = 0;
+};
+
+}  // namespace trans_geo::geoid
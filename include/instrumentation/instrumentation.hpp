@@ -0,0 +1,229 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace trans_geo::instrumentation {
+
+/**
+ * @brief 計測対象の変換器の識別子
+ */
+enum class ConverterId : std::size_t {
+  GeoToECEF,
+  ECEFToGeo,
+  ECEFToENU,
+  ENUToECEF,
+  GeoToENU,
+  ENUToGeo,
+  Count
+};
+
+/**
+ * @brief 計測対象の操作の種類
+ */
+enum class Operation : std::size_t {
+  Convert,  ///< 単点の convert()
+  Batch,    ///< 一括変換（convertBatch()・convertStates()）
+  Count
+};
+
+constexpr std::size_t kConverterCount =
+    static_cast<std::size_t>(ConverterId::Count);
+constexpr std::size_t kOperationCount =
+    static_cast<std::size_t>(Operation::Count);
+
+/**
+ * @brief レイテンシヒストグラムのバケット数
+ *
+ * バケット 0 は 0 ns、バケット i (i >= 1) は [2^(i-1), 2^i) ns
+ * の呼び出しを数えます。最後のバケットはそれ以上をすべて含みます。
+ */
+constexpr std::size_t kLatencyBuckets = 40;
+
+/**
+ * @brief 緯度反復回数ヒストグラムのバケット数
+ *
+ * バケット i は反復回数 i の呼び出しを数え、最後のバケットは
+ * それ以上をすべて含みます。
+ */
+constexpr std::size_t kIterationBuckets = 16;
+
+/**
+ * @brief 計測がコンパイル時に有効かどうか
+ *
+ * CMake オプション TRANSGEO_ENABLE_INSTRUMENTATION を ON
+ * にすると有効になります。
+ * 無効時は計測マクロが空に展開され、変換処理に一切のコストを加えません。
+ */
+#ifdef TRANSGEO_ENABLE_INSTRUMENTATION
+constexpr bool kEnabled = true;
+#else
+constexpr bool kEnabled = false;
+#endif
+
+/**
+ * @brief 1 種類の操作に関する集計値
+ */
+struct OperationStats {
+  std::uint64_t calls = 0;             ///< 呼び出し回数
+  std::uint64_t points = 0;            ///< 変換した点数
+  std::uint64_t totalNanoseconds = 0;  ///< 合計所要時間（ナノ秒）
+  std::array<std::uint64_t, kLatencyBuckets> latency{};  ///< レイテンシ分布
+};
+
+/**
+ * @brief 1 つの変換器に関する集計値
+ */
+struct ConverterStats {
+  std::array<OperationStats, kOperationCount> operations{};
+  /// 緯度の反復回数の分布（ECEFToGeoConverter のみ）
+  std::array<std::uint64_t, kIterationBuckets> latitudeIterations{};
+
+  /**
+   * @brief 操作ごとの集計値を取得する
+   * @param op 操作の種類
+   * @return const OperationStats& 集計値
+   */
+  const OperationStats& operator[](Operation op) const noexcept {
+    return operations[static_cast<std::size_t>(op)];
+  }
+};
+
+/**
+ * @brief 全スレッド分を合算した計測値のスナップショット
+ */
+struct Snapshot {
+  bool enabled = kEnabled;  ///< 計測が有効なビルドかどうか
+  std::array<ConverterStats, kConverterCount> converters{};
+
+  /**
+   * @brief 変換器ごとの集計値を取得する
+   * @param id 変換器の識別子
+   * @return const ConverterStats& 集計値
+   */
+  const ConverterStats& operator[](ConverterId id) const noexcept {
+    return converters[static_cast<std::size_t>(id)];
+  }
+};
+
+/**
+ * @brief 現時点の計測値を取得する
+ *
+ * 各スレッドのカウンタを合算します。終了済みスレッドの値も含まれます。
+ * 計測が無効なビルドでは enabled が false で、すべての値が 0 です。
+ *
+ * @return Snapshot 計測値のスナップショット
+ */
+Snapshot snapshot();
+
+/**
+ * @brief すべての計測値を 0 に戻す
+ */
+void reset();
+
+/**
+ * @brief 変換器の識別子を名前に変換する
+ * @param id 変換器の識別子
+ * @return const char* 変換器名（例: "GeoToECEF"）
+ */
+const char* toString(ConverterId id) noexcept;
+
+/**
+ * @brief 操作の種類を名前に変換する
+ * @param op 操作の種類
+ * @return const char* 操作名（"convert" または "batch"）
+ */
+const char* toString(Operation op) noexcept;
+
+/**
+ * @brief スナップショットを Prometheus のテキスト形式で出力する
+ *
+ * 監視システムからのスクレイプにそのまま返せる形式です。
+ *
+ * @param snapshot 出力するスナップショット
+ * @return std::string テキスト表現
+ */
+std::string toPrometheusText(const Snapshot& snapshot);
+
+/**
+ * @brief 1 回の呼び出しを記録する
+ *
+ * 呼び出し元スレッド専用のカウンタに書き込むため、ロックや
+ * アトミックな読み書き変更命令を使いません。
+ *
+ * @param id         変換器の識別子
+ * @param op         操作の種類
+ * @param points     変換した点数
+ * @param nanoseconds 所要時間（ナノ秒）
+ */
+void recordCall(ConverterId id, Operation op, std::uint64_t points,
+                std::uint64_t nanoseconds) noexcept;
+
+/**
+ * @brief 緯度の反復回数を記録する
+ * @param id         変換器の識別子
+ * @param iterations 反復回数
+ * @param points     その反復回数で解いた点数（一括変換でまとめて記録する）
+ */
+void recordLatitudeIterations(ConverterId id, int iterations,
+                              std::uint64_t points = 1) noexcept;
+
+/**
+ * @brief スコープの所要時間を記録する RAII ヘルパー
+ *
+ * 通常は TRANSGEO_INSTRUMENT_SCOPE マクロ経由で利用します。
+ */
+class ScopedTimer {
+ public:
+  ScopedTimer(ConverterId id, Operation op, std::uint64_t points) noexcept
+      : id_(id),
+        op_(op),
+        points_(points),
+        start_(std::chrono::steady_clock::now()) {}
+
+  ~ScopedTimer() {
+    auto elapsed = std::chrono::steady_clock::now() - start_;
+    recordCall(
+        id_, op_, points_,
+        static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                .count()));
+  }
+
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+ private:
+  ConverterId id_;
+  Operation op_;
+  std::uint64_t points_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace trans_geo::instrumentation
+
+#ifdef TRANSGEO_ENABLE_INSTRUMENTATION
+/// スコープ終了時に呼び出し回数・点数・所要時間を記録する
+#define TRANSGEO_INSTRUMENT_SCOPE(id, op, points)                     \
+  ::trans_geo::instrumentation::ScopedTimer transgeoInstrumentScope_( \
+      ::trans_geo::instrumentation::ConverterId::id,                  \
+      ::trans_geo::instrumentation::Operation::op, (points))
+/// 緯度の反復回数を記録する
+#define TRANSGEO_RECORD_LATITUDE_ITERATIONS(id, iterations) \
+  ::trans_geo::instrumentation::recordLatitudeIterations(   \
+      ::trans_geo::instrumentation::ConverterId::id, (iterations))
+/// 同じ反復回数で解いた点数をまとめて記録する
+#define TRANSGEO_RECORD_LATITUDE_ITERATIONS_N(id, iterations, points) \
+  ::trans_geo::instrumentation::recordLatitudeIterations(             \
+      ::trans_geo::instrumentation::ConverterId::id, (iterations), (points))
+#else
+#define TRANSGEO_INSTRUMENT_SCOPE(id, op, points) static_cast<void>(0)
+// 反復回数を記録するためだけの変数が未使用の警告にならないよう評価する
+#define TRANSGEO_RECORD_LATITUDE_ITERATIONS(id, iterations) \
+  static_cast<void>(iterations)
+#define TRANSGEO_RECORD_LATITUDE_ITERATIONS_N(id, iterations, points) \
+  static_cast<void>(0)
+#endif
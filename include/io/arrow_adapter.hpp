@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+#include "coordinate/point_buffer.hpp"  // PointBuffer の定義
+#include "coordinate/point_view.hpp"    // PointView / ConstPointView の定義
+#include "io/arrow_c_data.hpp"          // ArrowSchema / ArrowArray の定義
+#include "io/columnar_format.hpp"       // CoordinateFrame の定義
+
+namespace trans_geo::io {
+
+/**
+ * @brief レコードバッチ（struct 型）の子列を名前で検索する
+ *
+ * @param schema レコードバッチのスキーマ
+ * @param name   列名
+ * @return std::size_t 子列の番号
+ * @throw std::invalid_argument 該当する列がない場合
+ */
+std::size_t findArrowColumn(const ArrowSchema& schema, std::string_view name);
+
+/**
+ * @brief Arrow のレコードバッチの 3 列を読み取り専用のビューとして参照する
+ *
+ * schema は struct 型（"+s"）で、columns で指定した子列が float64（"g"）
+ * である必要があります。親と子のオフセットを反映した列の先頭を指す
+ * ビューを返し、値はコピーしません。null を含む列は変換できないため
+ * 受け付けません。array を解放するまでビューは有効です。
+ *
+ * @param schema  レコードバッチのスキーマ
+ * @param array   レコードバッチのデータ
+ * @param columns 各成分に対応する子列の番号
+ * @return ConstPointView 列のバッファを指すビュー
+ * @throw std::invalid_argument 解放済み・型が float64 でない・null を含む
+ * など、ビューとして参照できない場合
+ */
+trans_geo::coordinate::ConstPointView arrowPoints(
+    const ArrowSchema& schema, const ArrowArray& array,
+    const std::array<std::size_t, 3>& columns = {0, 1, 2});
+
+/**
+ * @brief Arrow のレコードバッチの 3 列を書き込み可能なビューとして参照する
+ *
+ * arrowPoints() と同じ検証を行います。convertBatch(view, view) で列の
+ * バッファをその場で変換できます。バッファを書き換えてよいのは、
+ * 他の利用者と共有していない配列を受け取った場合に限ります。
+ *
+ * @param schema  レコードバッチのスキーマ
+ * @param array   レコードバッチのデータ
+ * @param columns 各成分に対応する子列の番号
+ * @return PointView 列のバッファを指すビュー
+ * @throw std::invalid_argument arrowPoints() と同じ条件
+ */
+trans_geo::coordinate::PointView arrowMutablePoints(
+    const ArrowSchema& schema, ArrowArray& array,
+    const std::array<std::size_t, 3>& columns = {0, 1, 2});
+
+/**
+ * @brief 座標列を Arrow のレコードバッチとして公開する
+ *
+ * points を受け取ったまま 3 本の float64 列として公開し、値はコピー
+ * しません。列名は frame に応じて lat/lon/h、x/y/z、e/n/u とします。
+ * 出力した構造体は受け取り側が release コールバックで解放します。
+ * 子列は親から独立して解放できます（子列の移動に対応）。
+ *
+ * @param points 公開する座標列（所有権を移す）
+ * @param frame  座標系（列名の決定に使用）
+ * @param schema 出力先のスキーマ
+ * @param array  出力先のデータ
+ */
+void exportArrowPoints(trans_geo::coordinate::PointBuffer&& points,
+                       CoordinateFrame frame, ArrowSchema* schema,
+                       ArrowArray* array);
+
+}  // namespace trans_geo::io
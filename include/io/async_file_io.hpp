@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace trans_geo::io {
+
+/**
+ * @brief 非同期ファイル入出力の実装
+ */
+enum class AsyncIoBackend : std::uint8_t {
+  Auto,     ///< io_uring が使えれば IoUring、使えなければ Threads
+  IoUring,  ///< Linux の io_uring（システムコールを直接呼ぶ）
+  Threads   ///< 入出力スレッドが pread / pwrite を呼ぶ
+};
+
+/**
+ * @brief 実装の名前を取得する
+ * @param backend 実装
+ * @return const char* "auto" / "io_uring" / "threads"
+ */
+const char* asyncIoBackendName(AsyncIoBackend backend) noexcept;
+
+/**
+ * @brief 実装が実行中の環境で使えるかを判定する
+ *
+ * io_uring はビルド時にヘッダがあり、実行時にカーネルが io_uring_setup を
+ * 受け付ける場合にのみ使えます（コンテナなどで無効にされている場合がある）。
+ *
+ * @param backend 実装
+ * @return bool 使える場合は true（Auto と Threads は常に true）
+ */
+bool asyncIoBackendAvailable(AsyncIoBackend backend) noexcept;
+
+/**
+ * @brief 位置を指定した読み書きを非同期に行うキュー
+ *
+ * read() / write() で要求を登録するとすぐに戻り、完了は wait() で 1 件ずつ
+ * 受け取ります（完了の順序は登録順とは限りません）。短い読み書きは内部で
+ * 残りを再発行するため、wait() が返した要求は指定したバイト数をすべて
+ * 転送しています。
+ *
+ * 要求のバッファとファイル記述子は、その完了を受け取るまで有効である
+ * 必要があります。デストラクタは未完了の要求の終了を待ちます。
+ * 1 つのスレッドから使ってください。
+ */
+class IAsyncFileIo {
+ public:
+  virtual ~IAsyncFileIo() = default;
+
+  /**
+   * @brief 実装を取得する
+   * @return AsyncIoBackend IoUring または Threads
+   */
+  virtual AsyncIoBackend getBackend() const noexcept = 0;
+
+  /**
+   * @brief 同時に登録できる要求数を取得する
+   * @return std::size_t 要求数
+   */
+  virtual std::size_t getCapacity() const noexcept = 0;
+
+  /**
+   * @brief 未完了の要求数を取得する
+   * @return std::size_t 登録して、まだ wait() で受け取っていない要求数
+   */
+  virtual std::size_t pending() const noexcept = 0;
+
+  /**
+   * @brief ファイルの offset から bytes バイトを data に読み込む要求を登録する
+   *
+   * @param fd     ファイル記述子
+   * @param data   読み込み先
+   * @param bytes  バイト数
+   * @param offset ファイル上の位置
+   * @param tag    wait() が返す識別子
+   * @throw std::length_error 未完了の要求が getCapacity() に達している場合
+   * @throw std::system_error 要求を登録できない場合
+   */
+  virtual void read(int fd, void* data, std::size_t bytes,
+                    std::uint64_t offset, std::uint64_t tag) = 0;
+
+  /**
+   * @brief data の bytes バイトをファイルの offset に書き込む要求を登録する
+   *
+   * @param fd     ファイル記述子
+   * @param data   書き込む内容
+   * @param bytes  バイト数
+   * @param offset ファイル上の位置
+   * @param tag    wait() が返す識別子
+   * @throw std::length_error 未完了の要求が getCapacity() に達している場合
+   * @throw std::system_error 要求を登録できない場合
+   */
+  virtual void write(int fd, const void* data, std::size_t bytes,
+                     std::uint64_t offset, std::uint64_t tag) = 0;
+
+  /**
+   * @brief 要求が 1 件完了するまで待つ
+   *
+   * @return std::uint64_t 完了した要求の tag
+   * @throw std::logic_error 未完了の要求がない場合
+   * @throw std::system_error 読み書きに失敗した場合（ファイル末尾を超えた
+   * 読み込みは EIO）
+   */
+  virtual std::uint64_t wait() = 0;
+};
+
+/**
+ * @brief 非同期ファイル入出力のキューを作成する
+ *
+ * @param backend  実装（Auto の場合は使える実装を選ぶ）
+ * @param capacity 同時に登録できる要求数
+ * @return std::unique_ptr<IAsyncFileIo> キュー
+ * @throw std::invalid_argument capacity が 0 の場合
+ * @throw std::system_error IoUring を指定して使えない場合
+ */
+std::unique_ptr<IAsyncFileIo> makeAsyncFileIo(AsyncIoBackend backend,
+                                              std::size_t capacity);
+
+}  // namespace trans_geo::io
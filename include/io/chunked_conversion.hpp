@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "converter/i_coordiante_converter.hpp"  // ICoordinateConverter の定義
+#include "io/async_file_io.hpp"                  // AsyncIoBackend の定義
+#include "io/columnar_format.hpp"  // ColumnarMetadata の定義
+
+namespace trans_geo::io {
+
+/**
+ * @brief convertColumnarFile() の設定
+ */
+struct ChunkedConversionOptions {
+  /// 1 チャンクの点数（バッファは queueDepth * chunkPoints * 48 バイト）
+  std::size_t chunkPoints = std::size_t{1} << 18;
+  /// 同時に扱うチャンク数（2: ダブルバッファ、3: トリプルバッファ）
+  std::size_t queueDepth = 3;
+  /// 非同期入出力の実装
+  AsyncIoBackend backend = AsyncIoBackend::Auto;
+};
+
+/**
+ * @brief convertColumnarFile() の結果
+ */
+struct ChunkedConversionReport {
+  std::size_t points = 0;                          ///< 変換した点数
+  std::size_t chunks = 0;                          ///< チャンク数
+  AsyncIoBackend backend = AsyncIoBackend::Auto;   ///< 使った実装
+  double seconds = 0.0;                            ///< 全体の所要時間
+  double convertSeconds = 0.0;                     ///< 変換に使った時間
+  double ioWaitSeconds = 0.0;  ///< 変換を止めて入出力を待った時間
+};
+
+/**
+ * @brief 列指向バイナリフォーマットのファイルをチャンクごとに変換して書き出す
+ *
+ * メモリに収まらない大きさのファイルを、チャンク単位の読み込み・変換・
+ * 書き込みに分けて処理します。queueDepth 個のチャンクのバッファを
+ * 順に使い回し、チャンク N を変換している間にチャンク N+1 以降の読み込みと
+ * チャンク N-1 以前の書き込みを非同期に進めるため、ディスクと CPU が
+ * 同時に働きます（変換は呼び出し側のスレッドで行います）。
+ *
+ * 出力のヘッダ（座標系・楕円体・原点）は outputMetadata から作成します。
+ * converter は入力ファイルの座標系・楕円体に合ったものを渡してください
+ * （ヘッダは MappedFile と ColumnarReader で読めます）。
+ *
+ * @param inputPath      入力ファイルパス
+ * @param outputPath     出力ファイルパス（既存のファイルは上書き）
+ * @param converter      変換器
+ * @param outputMetadata 出力の座標系・楕円体・原点
+ * @param options        設定
+ * @return ChunkedConversionReport 点数と所要時間の内訳
+ * @throw std::invalid_argument chunkPoints または queueDepth が 0 の場合、
+ * 入力のヘッダが不正な場合、出力が ENU で原点がない場合、または入力と
+ * 出力が同じファイルの場合
+ * @throw std::system_error ファイルを開けない、または読み書きできない場合
+ * @throw std::runtime_error ホストがリトルエンディアンでない場合、または
+ * 変換器が Ok 以外を返した場合
+ */
+ChunkedConversionReport convertColumnarFile(
+    const std::string& inputPath, const std::string& outputPath,
+    const trans_geo::conversion::ICoordinateConverter& converter,
+    const ColumnarMetadata& outputMetadata,
+    const ChunkedConversionOptions& options = {});
+
+}  // namespace trans_geo::io
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "coordinate/geo_coordinate.hpp"  // GeoCoordinate の定義
+#include "coordinate/point_view.hpp"  // PointView / ConstPointView の定義
+#include "ellipsoid/ellipsoid.hpp"    // Ellipsoid 構造体の定義
+
+namespace trans_geo::io {
+
+/**
+ * @brief 列に格納された座標の座標系
+ */
+enum class CoordinateFrame : std::uint8_t {
+  Geo = 1,   ///< [緯度（度）, 経度（度）, 楕円体高（メートル）]
+  ECEF = 2,  ///< [X, Y, Z]（メートル）
+  ENU = 3    ///< [east, north, up]（メートル）。原点が必須
+};
+
+/**
+ * @brief 列の要素型
+ */
+enum class ColumnType : std::uint8_t {
+  Float64 = 1  ///< IEEE 754 倍精度
+};
+
+/// ファイル先頭の識別子
+constexpr char kColumnarMagic[8] = {'T', 'G', 'E', 'O', 'C', 'O', 'L', '\0'};
+/// 現在のフォーマットバージョン
+constexpr std::uint16_t kColumnarVersion = 1;
+/// バイト順の判定値（リトルエンディアンで書き込まれる）
+constexpr std::uint32_t kColumnarByteOrderMark = 0x01020304u;
+/// 各列の先頭オフセットの整列（バイト）
+constexpr std::size_t kColumnAlignment = 64;
+/// 列数（座標の成分数）
+constexpr std::size_t kColumnCount = 3;
+
+/**
+ * @brief 座標列の列指向バイナリフォーマットのヘッダ（128 バイト）
+ *
+ * ファイルはヘッダと 3 本の列で構成されます。各列は point count 個の
+ * 要素を連続して格納し、先頭は kColumnAlignment バイトに整列します。
+ * 楕円体と ENU 原点はヘッダに一度だけ記録します。
+ *
+ * | オフセット | 内容 |
+ * |---|---|
+ * | 0   | magic "TGEOCOL\0" |
+ * | 8   | version, headerSize |
+ * | 12  | byteOrderMark |
+ * | 16  | frame, columnType, columnCount, originFlags |
+ * | 24  | pointCount |
+ * | 32  | 楕円体の長半径 a・扁平率 f |
+ * | 48  | 原点 [緯度, 経度, 高度]（ENU のみ） |
+ * | 72  | 各列の先頭オフセット（ファイル先頭からのバイト数） |
+ * | 96  | 予約（0） |
+ */
+struct ColumnarHeader {
+  char magic[8];
+  std::uint16_t version;
+  std::uint16_t headerSize;
+  std::uint32_t byteOrderMark;
+  std::uint8_t frame;
+  std::uint8_t columnType;
+  std::uint8_t columnCount;
+  std::uint8_t originFlags;  ///< bit0: 原点あり, bit1: 原点の高度あり
+  std::uint32_t reserved0;
+  std::uint64_t pointCount;
+  double ellipsoidA;
+  double ellipsoidF;
+  double origin[3];
+  std::uint64_t columnOffsets[kColumnCount];
+  std::uint8_t reserved1[32];
+};
+static_assert(sizeof(ColumnarHeader) == 128,
+              "ColumnarHeader must be exactly 128 bytes");
+
+/**
+ * @brief 座標列に付随するメタデータ
+ */
+struct ColumnarMetadata {
+  CoordinateFrame frame;                      ///< 座標系
+  trans_geo::ellipsoid::Ellipsoid ellipsoid;  ///< 楕円体モデル
+  /// ENU の原点（frame が ENU の場合は必須、それ以外では無視）
+  std::optional<trans_geo::coordinate::GeoCoordinate> origin;
+};
+
+/**
+ * @brief ヘッダから読み取った座標列の配置
+ */
+struct ColumnarLayout {
+  ColumnarMetadata metadata;  ///< 座標系・楕円体・原点
+  std::size_t pointCount;     ///< 点数
+  /// 各列の先頭オフセット（ファイル先頭からのバイト数）
+  std::uint64_t columnOffsets[kColumnCount];
+};
+
+/**
+ * @brief pointCount 点の座標列を書き込むためのヘッダを作成する
+ *
+ * 列を分けて書き込む場合（ファイルに収まりきらない点列など）に使います。
+ * 列の位置は serializeColumnar() と同じです。
+ *
+ * @param metadata   座標系・楕円体・原点
+ * @param pointCount 点数
+ * @return ColumnarHeader ヘッダ
+ * @throw std::invalid_argument frame が ENU で原点がない場合
+ */
+ColumnarHeader makeColumnarHeader(const ColumnarMetadata& metadata,
+                                  std::size_t pointCount);
+
+/**
+ * @brief pointCount 点の座標列をシリアライズしたバイト数を求める
+ * @param pointCount 点数
+ * @return std::size_t ヘッダと 3 本の列（末尾の整列を含む）のバイト数
+ */
+std::size_t columnarByteSize(std::size_t pointCount) noexcept;
+
+/**
+ * @brief ヘッダを検証し、座標列の配置を読み取る
+ *
+ * @param header    ファイル先頭のバイト列（ColumnarHeader 以上の長さ）
+ * @param totalSize ファイル全体のバイト数（列の範囲の検証に使う）
+ * @return ColumnarLayout 座標列の配置
+ * @throw std::invalid_argument ColumnarReader と同じ条件（整列を除く）
+ */
+ColumnarLayout parseColumnarHeader(std::span<const std::byte> header,
+                                   std::uint64_t totalSize);
+
+/**
+ * @brief 座標列を列指向バイナリフォーマットにシリアライズする
+ *
+ * @param metadata 座標系・楕円体・原点
+ * @param points   書き込む座標列
+ * @return std::vector<std::byte> シリアライズしたバイト列
+ * @throw std::invalid_argument frame が ENU で原点がない場合、
+ * または points が不正なポインタを含む場合
+ */
+std::vector<std::byte> serializeColumnar(
+    const ColumnarMetadata& metadata,
+    trans_geo::coordinate::ConstPointView points);
+
+/**
+ * @brief 座標列を列指向バイナリフォーマットでファイルに書き込む
+ *
+ * @param path     出力ファイルパス
+ * @param metadata 座標系・楕円体・原点
+ * @param points   書き込む座標列
+ * @throw std::invalid_argument serializeColumnar() と同じ条件
+ * @throw std::runtime_error ファイルに書き込めない場合
+ */
+void writeColumnarFile(const std::string& path,
+                       const ColumnarMetadata& metadata,
+                       trans_geo::coordinate::ConstPointView points);
+
+/**
+ * @brief 列指向バイナリフォーマットのゼロコピー読み取りビュー
+ *
+ * コンストラクタでヘッダと列の範囲を一度だけ検証し、以降は
+ * バッファ上の列をコピーせずに参照します。MappedFile と組み合わせると、
+ * ファイルの内容を解析せずにそのまま一括変換へ渡せます。
+ * バッファの寿命は呼び出し側が保証してください。
+ *
+ * @code
+ * MappedFile file("points.tgeo");
+ * ColumnarReader reader(file.bytes());
+ * converter.convertBatch(reader.getPoints(), output);
+ * @endcode
+ */
+class ColumnarReader {
+ public:
+  /**
+   * @brief バッファを検証してビューを作成する
+   *
+   * @param buffer シリアライズ済みのバイト列
+   * @throw std::invalid_argument 識別子・バージョン・バイト順・列の範囲・
+   * 整列のいずれかが不正な場合
+   */
+  explicit ColumnarReader(std::span<const std::byte> buffer);
+
+  /**
+   * @brief 座標系を取得する
+   * @return CoordinateFrame 座標系
+   */
+  CoordinateFrame getFrame() const noexcept;
+
+  /**
+   * @brief 楕円体モデルを取得する
+   * @return trans_geo::ellipsoid::Ellipsoid 楕円体モデル
+   */
+  trans_geo::ellipsoid::Ellipsoid getEllipsoid() const noexcept;
+
+  /**
+   * @brief ENU の原点を取得する
+   * @return const std::optional<GeoCoordinate>& 原点（ENU 以外では空）
+   */
+  const std::optional<trans_geo::coordinate::GeoCoordinate>& getOrigin()
+      const noexcept;
+
+  /**
+   * @brief 点数を取得する
+   * @return std::size_t 点数
+   */
+  std::size_t size() const noexcept;
+
+  /**
+   * @brief 1 本の列を取得する
+   * @param k 列番号（0〜2）
+   * @return std::span<const double> バッファ上の列
+   */
+  std::span<const double> getColumn(std::size_t k) const noexcept;
+
+  /**
+   * @brief 座標列のビューを取得する
+   * @return trans_geo::coordinate::ConstPointView バッファ上の 3 列を指すビュー
+   */
+  trans_geo::coordinate::ConstPointView getPoints() const noexcept;
+
+ private:
+  CoordinateFrame frame_;
+  trans_geo::ellipsoid::Ellipsoid ellipsoid_;
+  std::optional<trans_geo::coordinate::GeoCoordinate> origin_;
+  std::size_t size_;
+  const double* columns_[kColumnCount];
+};
+
+}  // namespace trans_geo::io
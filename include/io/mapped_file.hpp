@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+namespace trans_geo::io {
+
+/**
+ * @brief 読み取り専用でメモリマップしたファイル
+ *
+ * ファイル全体を mmap し、破棄時にアンマップします。
+ * マップした領域はページ境界に整列しているため、先頭からの
+ * オフセットが整列していれば double 列として直接参照できます。
+ * ムーブのみ可能です。
+ */
+class MappedFile {
+ public:
+  /**
+   * @brief ファイルをマップする
+   *
+   * @param path ファイルパス
+   * @throw std::system_error ファイルを開けない、またはマップできない場合
+   */
+  explicit MappedFile(const std::string& path);
+
+  ~MappedFile();
+
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /**
+   * @brief マップした領域を取得する
+   * @return std::span<const std::byte> ファイル全体（空ファイルの場合は空）
+   */
+  std::span<const std::byte> bytes() const noexcept;
+
+  /**
+   * @brief ファイルサイズを取得する
+   * @return std::size_t バイト数
+   */
+  std::size_t size() const noexcept;
+
+  /**
+   * @brief ランダムアクセスすることをカーネルに伝える（先読みを抑える）
+   *
+   * 大きなファイルの一部だけを参照する場合（格子の補間など）に、
+   * 参照したページだけを読み込ませます。失敗しても動作に影響しません。
+   */
+  void adviseRandomAccess() const noexcept;
+
+ private:
+  void release() noexcept;
+
+  const std::byte* data_ = nullptr;  ///< マップ先頭
+  std::size_t size_ = 0;             ///< マップしたバイト数
+};
+
+}  // namespace trans_geo::io
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+#include "coordinate/point_view.hpp"  // ConstPointView の定義
+
+namespace trans_geo::io {
+
+/// 最短の往復可能表現で出力することを表す精度指定
+constexpr int kShortestRoundTrip = -1;
+
+/**
+ * @brief テキスト出力の書式
+ */
+struct TextFormatOptions {
+  /// 小数点以下の桁数（固定小数点）。kShortestRoundTrip の場合は最短表現
+  int precision = 6;
+  char delimiter = ',';   ///< 成分の区切り文字
+  char terminator = '\n';  ///< 点（行）の終端文字
+};
+
+/**
+ * @brief formatPoints() の結果
+ */
+struct FormatResult {
+  std::size_t points = 0;  ///< 書き込んだ点数
+  std::size_t bytes = 0;   ///< 書き込んだバイト数
+};
+
+/**
+ * @brief 座標列をテキストとして呼び出し側のバッファに書き込む
+ *
+ * 各点を "c0<delimiter>c1<delimiter>c2<terminator>" の形式で書き込みます。
+ * 数値は std::to_chars で変換するため、ロケールに依存せず、ヒープ確保も
+ * 行いません。精度 6 の出力は toString() の各成分と同じ表記です。
+ *
+ * バッファに収まる点まで書き込み、途中の点は書き込みません。
+ * 残りは points.subview(result.points, ...) で続けて書き込めます。
+ * 1 点も収まらない場合は result.points が 0 となります。
+ *
+ * @param points  出力する座標列
+ * @param buffer  出力先のバッファ
+ * @param options 書式
+ * @return FormatResult 書き込んだ点数とバイト数
+ */
+FormatResult formatPoints(trans_geo::coordinate::ConstPointView points,
+                          std::span<char> buffer,
+                          const TextFormatOptions& options = {}) noexcept;
+
+}  // namespace trans_geo::io
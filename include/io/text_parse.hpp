@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+#include "coordinate/point_buffer.hpp"  // PointBuffer の定義
+#include "coordinate/point_view.hpp"    // PointView の定義
+
+namespace trans_geo::io {
+
+/// 成分に対応する列がないことを表す列番号（成分は fillValue で埋める）
+constexpr std::size_t kNoColumn = std::numeric_limits<std::size_t>::max();
+
+/**
+ * @brief 区切りテキストの解析設定
+ */
+struct TextParseOptions {
+  /// 列の区切り文字。空白・タブの場合は連続した空白・タブを 1 つの区切りと
+  /// みなす（桁揃えした XYZ など。空の列は表せない）
+  char delimiter = ',';
+  char comment = '#';    ///< この文字で始まる行は無視する（'\0' で無効）
+  std::size_t skipLines = 0;  ///< 先頭で読み飛ばす行数（見出し行など）
+  /// 各成分を読み出す列番号（0 始まり）。既定は [0, 1, 2]
+  std::array<std::size_t, 3> columns{0, 1, 2};
+  /// 列番号が kNoColumn の成分に設定する値（高度を省略したデータなど）
+  double fillValue = 0.0;
+  /// ParseReport::errors に記録するエラーの最大件数
+  std::size_t maxReportedErrors = 100;
+};
+
+/**
+ * @brief 不正な行の種類
+ */
+enum class ParseErrorKind : std::uint8_t {
+  MissingField,  ///< 列が足りない
+  InvalidNumber  ///< 数値として解釈できない
+};
+
+/**
+ * @brief 不正な行の情報
+ */
+struct ParseError {
+  std::size_t line;       ///< 行番号（1 始まり）
+  std::size_t component;  ///< 問題のあった成分番号（0〜2）
+  ParseErrorKind kind;    ///< 種類
+};
+
+/**
+ * @brief 解析結果
+ */
+struct ParseReport {
+  std::size_t points = 0;         ///< 出力した点数
+  std::size_t linesRead = 0;      ///< 読んだ行数（空行・注釈行を含む）
+  std::size_t malformedRows = 0;  ///< 読み飛ばした不正な行数
+  /// 読み終えたバイト数。出力が満杯で中断した場合は、ここから再開できる
+  std::size_t consumedBytes = 0;
+  /// 不正な行の詳細（先頭から maxReportedErrors 件まで）
+  std::vector<ParseError> errors;
+};
+
+/**
+ * @brief 区切りテキストを座標列に解析する
+ *
+ * 1 行を 1 点として、options.columns で指定した列を std::from_chars
+ * で解析し、output の先頭から書き込みます。ロケールに依存せず、
+ * 列の前後の空白・タブと行末の '\r' は無視します。
+ *
+ * 不正な行は例外を送出せずに読み飛ばし、ParseReport に記録します。
+ * output が満杯になった時点で中断し、consumedBytes までを読み終えた
+ * 位置として返します。
+ * 続きは text.substr(consumedBytes) を skipLines = 0 で解析してください
+ * （行番号は text の先頭から数えます）。
+ *
+ * @param text    解析するテキスト（メモリマップしたファイルなど）
+ * @param output  出力先の座標列
+ * @param options 解析設定
+ * @return ParseReport 解析結果
+ */
+ParseReport parsePoints(std::string_view text,
+                        trans_geo::coordinate::PointView output,
+                        const TextParseOptions& options = {});
+
+/**
+ * @brief 区切りテキストを解析して PointBuffer の末尾に追加する
+ *
+ * 改行を数えて必要な領域を一度に確保してから parsePoints() を適用します。
+ *
+ * @param text    解析するテキスト
+ * @param output  追加先のバッファ
+ * @param options 解析設定
+ * @return ParseReport 解析結果
+ */
+ParseReport parsePoints(std::string_view text,
+                        trans_geo::coordinate::PointBuffer& output,
+                        const TextParseOptions& options = {});
+
+}  // namespace trans_geo::io
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "coordinate/point_view.hpp"  // ConstPointView / PointView の定義
+#include "coordinate/quantization.hpp"  // Quantization の定義
+#include "ellipsoid/ellipsoid.hpp"    // Ellipsoid 構造体の定義
+
+namespace trans_geo::kernel {
+
+/**
+ * @brief 一括変換カーネルの命令セット
+ */
+enum class Isa : std::uint8_t {
+  Generic,  ///< ビルド時の既定（x86-64 では SSE2）
+  Avx2,     ///< AVX2（Haswell 以降、Zen 以降）
+  Avx512    ///< AVX-512 F/DQ/VL（Skylake-SP 以降、Zen 4 以降）
+};
+
+/**
+ * @brief 一括変換カーネルに渡す入出力の配置
+ *
+ * 第 i 点の第 k 成分は input[k][i * inputStride] にあり、結果を
+ * output[k][i * outputStride] に書き込みます。入力と出力は同じ領域でも
+ * 構いません（上書き変換）。
+ *
+ * @tparam In  入力の要素型（double または int32 固定小数点）
+ * @tparam Out 出力の要素型（double または int32 固定小数点）
+ */
+template <typename In, typename Out>
+struct BasicBatchSpan {
+  const In* input[3];
+  std::size_t inputStride;
+  Out* output[3];
+  std::size_t outputStride;
+  std::size_t size;
+};
+
+/// double の入出力
+using BatchSpan = BasicBatchSpan<double, double>;
+/// double の入力と int32 固定小数点の出力
+using QuantizingBatchSpan = BasicBatchSpan<double, std::int32_t>;
+/// int32 固定小数点の入力と double の出力
+using DequantizingBatchSpan = BasicBatchSpan<std::int32_t, double>;
+
+/**
+ * @brief カーネルに渡す固定小数点の換算（Quantization と同じ意味）
+ *
+ * 命令セットごとの翻訳単位から std::array のメンバ関数を呼ばないよう、
+ * 組み込みの配列で渡します。
+ */
+struct FixedPointScale {
+  double scale[3];
+  double offset[3];
+};
+
+/**
+ * @brief 命令セットごとにビルドした一括変換カーネルの表
+ *
+ * 各関数は点ごとのカーネル（geoToEcef() など）と同じ式を同じ順序で
+ * 計算します。FMA への縮約を行わないため、どの版の結果も点ごとの
+ * カーネルとビット単位で一致し、実行するマシンによって変わりません。
+ */
+struct BatchKernels {
+  Isa isa;  ///< この表の命令セット
+
+  /// Geo（度・度・m）→ ECEF
+  void (*geoToEcef)(const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
+                    const BatchSpan& span) noexcept;
+
+  /**
+   * ECEF → Geo（Bowring 法）。p² + Z² が singleStepRadiusSquared 以下の点は
+   * 1 ステップ、それ以外は 2 ステップ適用します（負の値なら常に 2 ステップ）
+   */
+  void (*ecefToGeo)(const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
+                    double singleStepRadiusSquared,
+                    const BatchSpan& span) noexcept;
+
+  /// ECEF → ENU（R * (p - p0)、R は行優先の 9 要素）
+  void (*ecefToEnu)(const double* rotation, const double* origin,
+                    const BatchSpan& span) noexcept;
+
+  /// ENU → ECEF（p0 + R^T * e）
+  void (*enuToEcef)(const double* rotation, const double* origin,
+                    const BatchSpan& span) noexcept;
+
+  // 以下は量子化・逆量子化を読み書きに融合した版です。double の結果は
+  // 上の版と同じで、量子化は coordinate::quantize() と同じ値を書き込みます。
+  // 量子化する版は飽和した成分の数を返します。
+
+  /// Geo → int32 固定小数点の ECEF
+  std::size_t (*geoToEcefQuantized)(
+      const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
+      const FixedPointScale& fixed, const QuantizingBatchSpan& span) noexcept;
+
+  /// int32 固定小数点の ECEF → Geo（Bowring 法）
+  void (*ecefToGeoDequantized)(
+      const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
+      double singleStepRadiusSquared, const FixedPointScale& fixed,
+      const DequantizingBatchSpan& span) noexcept;
+
+  /// ECEF → int32 固定小数点の ENU
+  std::size_t (*ecefToEnuQuantized)(const double* rotation,
+                                    const double* origin,
+                                    const FixedPointScale& fixed,
+                                    const QuantizingBatchSpan& span) noexcept;
+
+  /// int32 固定小数点の ECEF → ENU
+  void (*ecefToEnuDequantized)(const double* rotation, const double* origin,
+                               const FixedPointScale& fixed,
+                               const DequantizingBatchSpan& span) noexcept;
+
+  /// ENU → int32 固定小数点の ECEF
+  std::size_t (*enuToEcefQuantized)(const double* rotation,
+                                    const double* origin,
+                                    const FixedPointScale& fixed,
+                                    const QuantizingBatchSpan& span) noexcept;
+
+  /// int32 固定小数点の ENU → ECEF
+  void (*enuToEcefDequantized)(const double* rotation, const double* origin,
+                               const FixedPointScale& fixed,
+                               const DequantizingBatchSpan& span) noexcept;
+};
+
+/**
+ * @brief 命令セットの名前を取得する
+ * @param isa 命令セット
+ * @return const char* "generic" / "avx2" / "avx512"
+ */
+const char* isaName(Isa isa) noexcept;
+
+/**
+ * @brief 実行中の CPU（と OS）が命令セットを使えるかを調べる
+ *
+ * ビルド時にその版を生成していない場合（x86-64 以外など）も false です。
+ *
+ * @param isa 命令セット
+ * @return bool 使える場合は true
+ */
+bool isaSupported(Isa isa) noexcept;
+
+/**
+ * @brief 指定した命令セットのカーネル表を取得する
+ *
+ * 性能比較のために特定の版を直接呼ぶ場合に使います。
+ *
+ * @param isa 命令セット
+ * @return const BatchKernels* カーネル表。使えない場合は nullptr
+ */
+const BatchKernels* batchKernelsFor(Isa isa) noexcept;
+
+/**
+ * @brief 変換器が使うカーネル表を取得する
+ *
+ * 初回の呼び出しで CPUID により使える最も新しい命令セットを選び、以後は
+ * 同じ表を返します。環境変数 TRANSGEO_FORCE_ISA に "generic" / "avx2" /
+ * "avx512" を設定すると、その版を優先します（CPU が対応していない場合は
+ * 自動選択に戻ります）。
+ *
+ * @return const BatchKernels& 選択したカーネル表
+ */
+const BatchKernels& batchKernels() noexcept;
+
+/**
+ * @brief 入出力のビューから BatchSpan を作る
+ * @param input  入力の座標列
+ * @param output 出力先の座標列（input と同じ点数）
+ * @return BatchSpan 入出力の配置
+ */
+inline BatchSpan makeBatchSpan(
+    trans_geo::coordinate::ConstPointView input,
+    trans_geo::coordinate::PointView output) noexcept {
+  return {{input.component(0), input.component(1), input.component(2)},
+          input.stride(),
+          {output.component(0), output.component(1), output.component(2)},
+          output.stride(),
+          input.size()};
+}
+
+/**
+ * @brief 入力と int32 固定小数点の出力のビューから QuantizingBatchSpan を作る
+ * @param input  入力の座標列
+ * @param output 出力先の座標列（input と同じ点数）
+ * @return QuantizingBatchSpan 入出力の配置
+ */
+inline QuantizingBatchSpan makeBatchSpan(
+    trans_geo::coordinate::ConstPointView input,
+    trans_geo::coordinate::QuantizedPointView output) noexcept {
+  return {{input.component(0), input.component(1), input.component(2)},
+          input.stride(),
+          {output.component(0), output.component(1), output.component(2)},
+          output.stride(),
+          input.size()};
+}
+
+/**
+ * @brief int32 固定小数点の入力と出力のビューから DequantizingBatchSpan を作る
+ * @param input  入力の座標列
+ * @param output 出力先の座標列（input と同じ点数）
+ * @return DequantizingBatchSpan 入出力の配置
+ */
+inline DequantizingBatchSpan makeBatchSpan(
+    trans_geo::coordinate::ConstQuantizedPointView input,
+    trans_geo::coordinate::PointView output) noexcept {
+  return {{input.component(0), input.component(1), input.component(2)},
+          input.stride(),
+          {output.component(0), output.component(1), output.component(2)},
+          output.stride(),
+          input.size()};
+}
+
+/**
+ * @brief Quantization から FixedPointScale を作る
+ * @param quantization 換算
+ * @return FixedPointScale カーネルに渡す換算
+ */
+inline FixedPointScale makeFixedPointScale(
+    const trans_geo::coordinate::Quantization& quantization) noexcept {
+  return {{quantization.scale[0], quantization.scale[1],
+           quantization.scale[2]},
+          {quantization.offset[0], quantization.offset[1],
+           quantization.offset[2]}};
+}
+
+}  // namespace trans_geo::kernel
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+
+#include "kernel/inline.hpp"
+#include "utils/utils.hpp"  // degToRad
+
+/**
+ * @file enu.hpp
+ * @brief ECEF ⇔ ENU 変換の計算カーネル（ヘッダオンリー）
+ *
+ * 回転行列 R は行優先で [R00, R01, R02, R10, ..., R22] の順に格納します
+ * （ENUFrame::getRotation() と同じ形式）。回転の適用は constexpr です。
+ */
+namespace trans_geo::kernel {
+
+/**
+ * @brief 原点の緯度・経度から ECEF→ENU 回転行列を計算する
+ *
+ * @param latDeg 原点の緯度（度）
+ * @param lonDeg 原点の経度（度）
+ * @return std::array<double, 9> 回転行列 R（行優先）
+ */
+inline std::array<double, 9> enuRotation(double latDeg,
+                                         double lonDeg) noexcept {
+  double lat = trans_geo::utils::degToRad(latDeg);
+  double lon = trans_geo::utils::degToRad(lonDeg);
+  double sinLat = std::sin(lat);
+  double cosLat = std::cos(lat);
+  double sinLon = std::sin(lon);
+  double cosLon = std::cos(lon);
+
+  // R =
+  // [ -sin(lon),              cos(lon),             0 ]
+  // [ -sin(lat)*cos(lon),   -sin(lat)*sin(lon),   cos(lat) ]
+  // [  cos(lat)*cos(lon),    cos(lat)*sin(lon),   sin(lat) ]
+  return {-sinLon,          cosLon,           0.0,
+          -sinLat * cosLon, -sinLat * sinLon, cosLat,
+          cosLat * cosLon,  cosLat * sinLon,  sinLat};
+}
+
+/**
+ * @brief ECEF 軸のベクトルを ENU 軸に回転する（R * v）
+ *
+ * @param R 回転行列（行優先）
+ * @param v ECEF 軸で表したベクトル
+ * @return std::array<double, 3> ENU 軸で表したベクトル
+ */
+TRANSGEO_FORCE_INLINE constexpr std::array<double, 3> rotateToENU(
+    const std::array<double, 9>& R, const std::array<double, 3>& v) noexcept {
+  return {R[0] * v[0] + R[1] * v[1] + R[2] * v[2],
+          R[3] * v[0] + R[4] * v[1] + R[5] * v[2],
+          R[6] * v[0] + R[7] * v[1] + R[8] * v[2]};
+}
+
+/**
+ * @brief ENU 軸のベクトルを ECEF 軸に回転する（R^T * v）
+ *
+ * @param R 回転行列（行優先）
+ * @param v ENU 軸で表したベクトル
+ * @return std::array<double, 3> ECEF 軸で表したベクトル
+ */
+TRANSGEO_FORCE_INLINE constexpr std::array<double, 3> rotateToECEF(
+    const std::array<double, 9>& R, const std::array<double, 3>& v) noexcept {
+  return {R[0] * v[0] + R[3] * v[1] + R[6] * v[2],
+          R[1] * v[0] + R[4] * v[1] + R[7] * v[2],
+          R[2] * v[0] + R[5] * v[1] + R[8] * v[2]};
+}
+
+/**
+ * @brief ECEF 位置を ENU 位置に変換する（R * (p - p0)）
+ *
+ * @param R      回転行列（行優先）
+ * @param origin 原点の ECEF 座標
+ * @param ecef   [X, Y, Z]（メートル）
+ * @return std::array<double, 3> [east, north, up]（メートル）
+ */
+TRANSGEO_FORCE_INLINE constexpr std::array<double, 3> ecefToEnu(
+    const std::array<double, 9>& R, const std::array<double, 3>& origin,
+    const std::array<double, 3>& ecef) noexcept {
+  return rotateToENU(R, {ecef[0] - origin[0], ecef[1] - origin[1],
+                         ecef[2] - origin[2]});
+}
+
+/**
+ * @brief ENU 位置を ECEF 位置に変換する（p0 + R^T * e）
+ *
+ * @param R      回転行列（行優先）
+ * @param origin 原点の ECEF 座標
+ * @param enu    [east, north, up]（メートル）
+ * @return std::array<double, 3> [X, Y, Z]（メートル）
+ */
+TRANSGEO_FORCE_INLINE constexpr std::array<double, 3> enuToEcef(
+    const std::array<double, 9>& R, const std::array<double, 3>& origin,
+    const std::array<double, 3>& enu) noexcept {
+  std::array<double, 3> delta = rotateToECEF(R, enu);
+  return {origin[0] + delta[0], origin[1] + delta[1], origin[2] + delta[2]};
+}
+
+}  // namespace trans_geo::kernel
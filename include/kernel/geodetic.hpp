@@ -0,0 +1,163 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+
+#include "ellipsoid/ellipsoid.hpp"  // Ellipsoid 構造体の定義
+#include "kernel/inline.hpp"
+#include "utils/utils.hpp"  // degToRad, radToDeg
+
+/**
+ * @file geodetic.hpp
+ * @brief Geo ⇔ ECEF 変換の計算カーネル（ヘッダオンリー）
+ *
+ * 変換器（GeoToECEFConverter / ECEFToGeoConverter）と同じ計算を、
+ * 仮想関数や座標オブジェクトを介さずに呼び出せる inline 関数として
+ * 提供します。変換器の結果とビット単位で一致します。
+ */
+namespace trans_geo::kernel {
+
+/**
+ * @brief 緯度・経度（度）と楕円体高から ECEF 座標を計算する
+ *
+ * @param ellipsoid 楕円体モデル
+ * @param latDeg    緯度（度）
+ * @param lonDeg    経度（度）
+ * @param h         楕円体高（メートル）
+ * @return std::array<double, 3> [X, Y, Z]（メートル）
+ */
+TRANSGEO_FORCE_INLINE std::array<double, 3> geoToEcef(
+    const trans_geo::ellipsoid::Ellipsoid& ellipsoid, double latDeg,
+    double lonDeg, double h) noexcept {
+  double lat = trans_geo::utils::degToRad(latDeg);
+  double lon = trans_geo::utils::degToRad(lonDeg);
+
+  // 補助量 N (prime vertical radius of curvature)
+  double sinLat = std::sin(lat);
+  double cosLat = std::cos(lat);
+  double N = ellipsoid.a / std::sqrt(1.0 - ellipsoid.e2 * sinLat * sinLat);
+
+  return {(N + h) * cosLat * std::cos(lon), (N + h) * cosLat * std::sin(lon),
+          (ellipsoid.oneMinusE2 * N + h) * sinLat};
+}
+
+/**
+ * @brief 緯度から楕円体高を求める
+ *
+ * h = p cosφ + Z sinφ − a √(1 − e² sin²φ) は p / cosφ − N と等価ですが、
+ * 極付近で cosφ → 0 となっても桁落ちしません。
+ *
+ * @param ellipsoid 楕円体モデル
+ * @param p         X-Y 平面上の距離
+ * @param Z         Z 座標
+ * @param sinLat    sinφ
+ * @param cosLat    cosφ
+ * @return double 楕円体高（メートル）
+ */
+TRANSGEO_FORCE_INLINE double ellipsoidalHeight(
+    const trans_geo::ellipsoid::Ellipsoid& ellipsoid, double p, double Z,
+    double sinLat, double cosLat) noexcept {
+  return p * cosLat + Z * sinLat -
+         ellipsoid.a * std::sqrt(1.0 - ellipsoid.e2 * sinLat * sinLat);
+}
+
+/**
+ * @brief 固定点反復で緯度を求める
+ *
+ * @param ellipsoid     楕円体モデル
+ * @param p             X-Y 平面上の距離
+ * @param Z             Z 座標
+ * @param tolerance     緯度の収束判定の許容誤差（ラジアン）
+ * @param maxIterations 最大反復回数
+ * @param lat           求めた緯度（ラジアン）の出力先
+ * @return int 実行した反復回数
+ */
+inline int solveLatitudeIterative(
+    const trans_geo::ellipsoid::Ellipsoid& ellipsoid, double p, double Z,
+    double tolerance, int maxIterations, double& lat) noexcept {
+  double a = ellipsoid.a;
+  double e2 = ellipsoid.e2;
+  // 初期値として緯度を求める（簡易初期値）
+  lat = std::atan2(Z, p * ellipsoid.oneMinusE2);
+  double latPrev = 0.0;
+  int iter = 0;
+  while (std::fabs(lat - latPrev) > tolerance && iter < maxIterations) {
+    latPrev = lat;
+    double sinLat = std::sin(lat);
+    double N = a / std::sqrt(1.0 - e2 * sinLat * sinLat);
+    lat = std::atan2(Z + e2 * N * sinLat, p);
+    iter++;
+  }
+  return iter;
+}
+
+/**
+ * @brief Bowring 法で緯度を求める
+ *
+ * 更成緯度 β の sin/cos を正規化したベクトルとして保持し、三角関数を
+ * 呼ばずに tanφ = (Z + e'² b sin³β) / (p − e² a cos³β) を steps 回適用します。
+ *
+ * @param ellipsoid 楕円体モデル
+ * @param p         X-Y 平面上の距離
+ * @param Z         Z 座標
+ * @param steps     適用回数（1 または 2）
+ * @param sinLat    sinφ の出力先
+ * @param cosLat    cosφ の出力先
+ */
+TRANSGEO_FORCE_INLINE void solveLatitudeBowring(
+    const trans_geo::ellipsoid::Ellipsoid& ellipsoid, double p, double Z,
+    int steps, double& sinLat, double& cosLat) noexcept {
+  // b, e'² b, e² a は楕円体の派生定数を使う（点ごとに平方根を計算しない）
+  double a = ellipsoid.a;
+  double b = ellipsoid.b;
+
+  // 初期値: tanβ = a Z / (b p)
+  double num = a * Z;
+  double den = b * p;
+  for (int i = 0; i < steps; ++i) {
+    double r = std::sqrt(num * num + den * den);
+    double sinBeta = r > 0.0 ? num / r : 0.0;
+    double cosBeta = r > 0.0 ? den / r : 1.0;
+    double nextNum = Z + ellipsoid.bEp2 * sinBeta * sinBeta * sinBeta;
+    double nextDen = p - ellipsoid.aE2 * cosBeta * cosBeta * cosBeta;
+    if (i + 1 == steps) {
+      num = nextNum;
+      den = nextDen;
+      break;
+    }
+    // tanβ = (b / a) tanφ で次ステップの更成緯度に更新
+    num = b * nextNum;
+    den = a * nextDen;
+  }
+  double r = std::sqrt(num * num + den * den);
+  sinLat = r > 0.0 ? num / r : 0.0;
+  cosLat = r > 0.0 ? den / r : 1.0;
+}
+
+/**
+ * @brief Bowring 法で ECEF 座標を緯度・経度・楕円体高に変換する
+ *
+ * GeodeticPrecision::Micrometre は steps = 2、地表付近で 1 mm 以下の精度で
+ * よい場合は steps = 1 に相当します。
+ *
+ * @param ellipsoid 楕円体モデル
+ * @param X         X 座標（メートル）
+ * @param Y         Y 座標（メートル）
+ * @param Z         Z 座標（メートル）
+ * @param steps     Bowring 法の適用回数（1 または 2）
+ * @return std::array<double, 3> [緯度（度）, 経度（度）, 楕円体高（メートル）]
+ */
+TRANSGEO_FORCE_INLINE std::array<double, 3> ecefToGeoBowring(
+    const trans_geo::ellipsoid::Ellipsoid& ellipsoid, double X, double Y,
+    double Z, int steps) noexcept {
+  double p = std::sqrt(X * X + Y * Y);
+  double lon = std::atan2(Y, X);
+  double sinLat = 0.0;
+  double cosLat = 1.0;
+  solveLatitudeBowring(ellipsoid, p, Z, steps, sinLat, cosLat);
+  double h = ellipsoidalHeight(ellipsoid, p, Z, sinLat, cosLat);
+  return {trans_geo::utils::radToDeg(std::atan2(sinLat, cosLat)),
+          trans_geo::utils::radToDeg(lon), h};
+}
+
+}  // namespace trans_geo::kernel
@@ -0,0 +1,16 @@
+#pragma once
+
+/**
+ * @brief 強制インライン展開の指定
+ *
+ * 点ごとのカーネル関数に付け、呼び出し側のループへ確実に展開させます。
+ * 展開されたループは呼び出し側のコンパイルオプション（-march など）で
+ * 自動ベクトル化されます。
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define TRANSGEO_FORCE_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define TRANSGEO_FORCE_INLINE __forceinline
+#else
+#define TRANSGEO_FORCE_INLINE inline
+#endif
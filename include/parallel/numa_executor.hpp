@@ -0,0 +1,174 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "converter/conversion_status.hpp"  // ConversionStatus の定義
+#include "converter/i_coordiante_converter.hpp"  // ICoordinateConverter の定義
+
+namespace trans_geo::parallel {
+
+class NumaPointBuffer;
+
+/**
+ * @brief NUMA ノードと、そのノードに属する CPU
+ */
+struct NumaNode {
+  int id;                 ///< ノード番号（OS の番号）
+  std::vector<int> cpus;  ///< ノードに属する CPU 番号
+};
+
+/**
+ * @brief 実行中のマシンの NUMA 構成
+ *
+ * libnuma を有効にしてビルドし、実行時に NUMA が使える場合は、CPU を持つ
+ * ノードとその CPU を列挙します。それ以外の場合は、すべての CPU を持つ
+ * 1 つのノードとして扱います。
+ */
+class NumaTopology {
+ public:
+  /**
+   * @brief 実行中のマシンの構成を調べる
+   * @return NumaTopology 構成
+   */
+  static NumaTopology detect();
+
+  /**
+   * @brief 構成を直接指定する（テストや、使うノードを絞る場合）
+   *
+   * @param nodes   ノードの一覧
+   * @param libnuma ノードへのメモリ割り当てとスレッドの固定に libnuma を使うか
+   * @throw std::invalid_argument nodes が空、または CPU のないノードがある場合
+   */
+  NumaTopology(std::vector<NumaNode> nodes, bool libnuma);
+
+  /**
+   * @brief ノードの一覧を取得する
+   * @return const std::vector<NumaNode>& ノードの一覧
+   */
+  const std::vector<NumaNode>& getNodes() const noexcept { return nodes_; }
+
+  /**
+   * @brief libnuma を使うかを取得する
+   * @return bool libnuma を使う場合は true（使わない場合は通常のスレッド）
+   */
+  bool usesLibnuma() const noexcept { return libnuma_; }
+
+ private:
+  std::vector<NumaNode> nodes_;
+  bool libnuma_;
+};
+
+/**
+ * @brief NumaExecutor の設定
+ */
+struct NumaExecutorOptions {
+  /// ノードごとのスレッド数（0 の場合はノードの CPU 数）
+  std::size_t threadsPerNode = 0;
+  /// libnuma を使う場合、各スレッドをノード内の 1 つの CPU に固定する
+  bool pinThreads = true;
+  /// スレッドが一度に取り出して変換する点数
+  std::size_t blockPoints = 65536;
+};
+
+/**
+ * @brief ノードごとの処理量
+ */
+struct NodeThroughput {
+  int node;                ///< ノード番号
+  std::size_t threads;     ///< 使ったスレッド数
+  std::size_t points;      ///< 変換した点数
+  double seconds;          ///< 開始から、ノードの最後のスレッドの終了まで
+  double pointsPerSecond;  ///< points / seconds
+};
+
+/**
+ * @brief NumaExecutor::convert() の結果
+ */
+struct NumaRunReport {
+  /// 最初に失敗したブロックの結果（すべて成功した場合は Ok）
+  trans_geo::conversion::ConversionStatus status =
+      trans_geo::conversion::ConversionStatus::Ok;
+  std::size_t points = 0;             ///< 変換した点数
+  double seconds = 0.0;               ///< 全体の所要時間
+  std::vector<NodeThroughput> nodes;  ///< ノードごとの処理量
+};
+
+/**
+ * @brief NUMA ノードごとにスレッドを割り当てて一括変換を行う実行器
+ *
+ * NumaPointBuffer の各チャンクは、いずれかのノードのメモリに置かれます。
+ * convert() はノードごとにスレッドを起動し、各スレッドは自分のノードの
+ * チャンクだけを blockPoints 点ずつ取り出して変換します。入力と出力の
+ * チャンクが同じノードにあるため、ソケットをまたぐメモリアクセスが
+ * 発生しません。
+ *
+ * libnuma がない場合（または NUMA が使えない場合）は、1 ノードの通常の
+ * スレッドとして動作します。
+ */
+class NumaExecutor {
+ public:
+  /**
+   * @brief 実行中のマシンの構成で作成する
+   * @param options 設定
+   * @throw std::invalid_argument blockPoints が 0 の場合
+   */
+  explicit NumaExecutor(NumaExecutorOptions options = {});
+
+  /**
+   * @brief 構成を指定して作成する
+   * @param topology 構成
+   * @param options  設定
+   * @throw std::invalid_argument blockPoints が 0 の場合
+   */
+  NumaExecutor(NumaTopology topology, NumaExecutorOptions options = {});
+
+  /**
+   * @brief 構成を取得する
+   * @return const NumaTopology& 構成
+   */
+  const NumaTopology& getTopology() const noexcept { return topology_; }
+
+  /**
+   * @brief ノードのスレッド数を取得する
+   * @param node ノードの添字（getNodes() の位置）
+   * @return std::size_t スレッド数
+   */
+  std::size_t getThreadCount(std::size_t node) const noexcept;
+
+  /**
+   * @brief 全ノードのスレッドで task を実行し、すべての終了を待つ
+   *
+   * task はノードの添字・ノード内のスレッド番号・ノードのスレッド数を
+   * 受け取ります。各スレッドは実行前に自分のノードに固定されます。
+   *
+   * @param task 各スレッドで実行する処理（例外を送出しないこと）
+   */
+  void runOnNodes(const std::function<void(std::size_t node,
+                                           std::size_t thread,
+                                           std::size_t threadCount)>& task)
+      const;
+
+  /**
+   * @brief 座標列を一括変換する
+   *
+   * input と output は同じ点数・同じチャンクの大きさである必要があります。
+   * 同じバッファを渡すと上書き変換します。
+   *
+   * @param converter 変換器
+   * @param input     入力
+   * @param output    出力先
+   * @return NumaRunReport 結果とノードごとの処理量。点数またはチャンクの
+   *         大きさが一致しない場合は status が SizeMismatch
+   */
+  NumaRunReport convert(
+      const trans_geo::conversion::ICoordinateConverter& converter,
+      const NumaPointBuffer& input, NumaPointBuffer& output) const;
+
+ private:
+  NumaTopology topology_;
+  NumaExecutorOptions options_;
+};
+
+}  // namespace trans_geo::parallel
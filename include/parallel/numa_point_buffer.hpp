@@ -0,0 +1,137 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "coordinate/point_view.hpp"  // PointView / ConstPointView の定義
+#include "parallel/numa_executor.hpp"  // NumaExecutor の定義
+
+namespace trans_geo::parallel {
+
+/// NumaPointBuffer の既定のチャンクの点数（1 チャンク 24 MiB）
+constexpr std::size_t kDefaultNumaChunkPoints = std::size_t{1} << 20;
+
+/**
+ * @brief NUMA ノードごとのメモリに分けて置く座標列
+ *
+ * 点列を chunkPoints 点ずつのチャンクに分け、連続したチャンクの区間を
+ * 各ノードに割り当てます。各チャンクは成分ごとの配列（SoA）です。
+ *
+ * 構築時に各ノードのスレッドが自分のチャンクを 0 で初期化します
+ * （ファーストタッチ）。libnuma を使う場合は、さらにチャンクをそのノードに
+ * 割り当てたメモリに置きます。assign() と copyTo() も各ノードのスレッドで
+ * 並列に行います。
+ *
+ * executor はバッファより長く有効である必要があります。
+ */
+class NumaPointBuffer {
+ public:
+  /**
+   * @brief size 点分の領域を各ノードに確保する
+   *
+   * @param executor    チャンクを割り当てる実行器
+   * @param size        点数
+   * @param chunkPoints チャンクの点数
+   * @throw std::invalid_argument chunkPoints が 0 の場合
+   * @throw std::bad_alloc メモリを確保できない場合
+   */
+  NumaPointBuffer(const NumaExecutor& executor, std::size_t size,
+                  std::size_t chunkPoints = kDefaultNumaChunkPoints);
+
+  ~NumaPointBuffer();
+
+  NumaPointBuffer(const NumaPointBuffer&) = delete;
+  NumaPointBuffer& operator=(const NumaPointBuffer&) = delete;
+
+  /**
+   * @brief 点数を取得する
+   * @return std::size_t 点数
+   */
+  std::size_t size() const noexcept { return size_; }
+
+  /**
+   * @brief チャンクの点数を取得する
+   * @return std::size_t チャンクの点数（最後のチャンクは少ない場合がある）
+   */
+  std::size_t getChunkPoints() const noexcept { return chunkPoints_; }
+
+  /**
+   * @brief チャンク数を取得する
+   * @return std::size_t チャンク数
+   */
+  std::size_t getChunkCount() const noexcept { return chunks_.size(); }
+
+  /**
+   * @brief チャンクを置いたノードを取得する
+   * @param chunk チャンク番号
+   * @return std::size_t ノードの添字（NumaTopology::getNodes() の位置）
+   */
+  std::size_t getChunkNode(std::size_t chunk) const noexcept {
+    return chunks_[chunk].node;
+  }
+
+  /**
+   * @brief チャンクの書き込み可能なビューを取得する
+   * @param chunk チャンク番号
+   * @return PointView チャンクの点列
+   */
+  trans_geo::coordinate::PointView chunk(std::size_t chunk) noexcept;
+
+  /**
+   * @brief チャンクの読み取り専用のビューを取得する
+   * @param chunk チャンク番号
+   * @return ConstPointView チャンクの点列
+   */
+  trans_geo::coordinate::ConstPointView chunk(
+      std::size_t chunk) const noexcept;
+
+  /**
+   * @brief 第 i 点を取得する
+   * @param i 点の番号
+   * @return std::array<double, 3> 3 成分
+   */
+  std::array<double, 3> get(std::size_t i) const noexcept;
+
+  /**
+   * @brief 第 i 点を設定する
+   * @param i      点の番号
+   * @param values 3 成分
+   */
+  void set(std::size_t i, const std::array<double, 3>& values) noexcept;
+
+  /**
+   * @brief 座標列を各ノードのスレッドで並列に書き込む
+   * @param source 書き込む座標列（size() 点）
+   * @throw std::invalid_argument 点数が一致しない場合
+   */
+  void assign(trans_geo::coordinate::ConstPointView source);
+
+  /**
+   * @brief 座標列を各ノードのスレッドで並列に読み出す
+   * @param destination 出力先（size() 点）
+   * @throw std::invalid_argument 点数が一致しない場合
+   */
+  void copyTo(trans_geo::coordinate::PointView destination) const;
+
+ private:
+  /// 1 つのチャンク（成分ごとに points 要素の配列を続けて置く）
+  struct Chunk {
+    double* data;
+    std::size_t points;
+    std::size_t node;
+  };
+
+  /**
+   * @brief 各ノードのスレッドで、そのノードのチャンクに task を適用する
+   */
+  template <typename Task>
+  void forEachLocalChunk(Task&& task) const;
+
+  const NumaExecutor& executor_;
+  std::size_t size_;
+  std::size_t chunkPoints_;
+  std::vector<Chunk> chunks_;
+};
+
+}  // namespace trans_geo::parallel
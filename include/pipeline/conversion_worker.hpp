@@ -0,0 +1,100 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#include "converter/i_coordiante_converter.hpp"  // ICoordinateConverter の定義
+#include "pipeline/ring_buffer.hpp"  // SpscRing / MpscRing の定義
+#include "pipeline/stages.hpp"       // kDefaultBatchSize の定義
+
+namespace trans_geo::pipeline {
+
+/**
+ * @brief リングバッファで受け渡す点（値型）
+ *
+ * tag は変換されずにそのまま出力へ引き継がれます。受信時刻や通し番号を
+ * 入れておくと、出力側で遅延の計測や入力との対応付けに使えます。
+ */
+struct TaggedPoint {
+  std::array<double, 3> values;  ///< 座標の 3 成分
+  std::uint64_t tag;             ///< 利用者定義の識別子
+};
+
+/**
+ * @brief 入力リングから点をまとめて取り出して変換し、出力リングへ渡す
+ *        変換スレッド
+ *
+ * start() で専用スレッドを起動し、入力にたまっている点を最大 maxBatch 点
+ * ずつ取り出して convertBatch() で一括変換します。点ごとのヒープ確保や
+ * ロックはありません。入力が空の間はスレッドを譲って待機します。
+ * 出力リングが満杯の場合は空くまで待つため、消費が追いつかないと入力側に
+ * 背圧がかかります。
+ *
+ * 入力は複数の受信スレッドから tryPush() でき、出力は 1 つのスレッドが
+ * 取り出します。変換器・入力・出力はワーカーより長く有効である必要が
+ * あります。
+ */
+class ConversionWorker {
+ public:
+  /**
+   * @brief コンストラクタ
+   *
+   * @param converter 変換器
+   * @param input     入力リング
+   * @param output    出力リング
+   * @param maxBatch  1 回に変換する最大点数
+   * @throw std::invalid_argument maxBatch が 0 の場合
+   */
+  ConversionWorker(const trans_geo::conversion::ICoordinateConverter& converter,
+                   MpscRing<TaggedPoint>& input, SpscRing<TaggedPoint>& output,
+                   std::size_t maxBatch = kDefaultBatchSize);
+
+  ConversionWorker(const ConversionWorker&) = delete;
+  ConversionWorker& operator=(const ConversionWorker&) = delete;
+
+  /**
+   * @brief デストラクタ（スレッドを停止して合流する）
+   */
+  ~ConversionWorker();
+
+  /**
+   * @brief 変換スレッドを起動する（起動済みの場合は何もしない）
+   */
+  void start();
+
+  /**
+   * @brief 変換スレッドを停止して合流する
+   *
+   * 入力に残っている点は変換して出力に渡してから停止します。
+   * 出力が満杯のまま消費されない場合、残りの点は破棄します。
+   */
+  void stop();
+
+  /**
+   * @brief 変換した点数を取得する
+   * @return std::uint64_t 出力リングへ渡した点数
+   */
+  std::uint64_t getConvertedCount() const noexcept;
+
+  /**
+   * @brief 変換に失敗して破棄した点数を取得する
+   * @return std::uint64_t 破棄した点数
+   */
+  std::uint64_t getDroppedCount() const noexcept;
+
+ private:
+  void run(std::stop_token stopToken);
+
+  const trans_geo::conversion::ICoordinateConverter& converter_;
+  MpscRing<TaggedPoint>& input_;
+  SpscRing<TaggedPoint>& output_;
+  std::size_t maxBatch_;
+  std::atomic<std::uint64_t> converted_{0};
+  std::atomic<std::uint64_t> dropped_{0};
+  std::jthread thread_;
+};
+
+}  // namespace trans_geo::pipeline
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace trans_geo::pipeline {
+
+/**
+ * @brief 値を 1 つずつ生成するコルーチン（同期ジェネレータ）
+ *
+ * co_yield した値を範囲 for で順に取り出せます。コルーチンは利用者が
+ * 次の値を要求したときにだけ再開されるため、下流が消費しない限り上流は
+ * 先へ進みません（プル型の背圧）。各段はすべて呼び出し側のスレッドで
+ * 実行され、段ごとのスレッドは不要です。
+ *
+ * コルーチン内で送出された例外は、値を取り出す側で再送出されます。
+ * ムーブのみ可能です。
+ *
+ * @tparam T 生成する値の型
+ */
+template <typename T>
+class Generator {
+ public:
+  struct promise_type {
+    std::optional<T> value;
+    std::exception_ptr exception;
+
+    Generator get_return_object() noexcept {
+      return Generator(
+          std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    std::suspend_always yield_value(T next) noexcept(
+        std::is_nothrow_move_constructible_v<T>) {
+      value.emplace(std::move(next));
+      return {};
+    }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept {
+      exception = std::current_exception();
+    }
+  };
+
+  using Handle = std::coroutine_handle<promise_type>;
+
+  /**
+   * @brief 範囲 for 用の入力イテレータ
+   */
+  class Iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+
+    Iterator() noexcept = default;
+    explicit Iterator(Handle handle) noexcept : handle_(handle) {}
+
+    const T& operator*() const { return *handle_.promise().value; }
+
+    Iterator& operator++() {
+      handle_.promise().value.reset();
+      resume(handle_);
+      return *this;
+    }
+
+    void operator++(int) { ++*this; }
+
+    friend bool operator==(const Iterator& it,
+                           std::default_sentinel_t) noexcept {
+      return !it.handle_ || it.handle_.done();
+    }
+
+   private:
+    Handle handle_;
+  };
+
+  Generator() noexcept = default;
+
+  Generator(Generator&& other) noexcept
+      : handle_(std::exchange(other.handle_, {})) {}
+
+  Generator& operator=(Generator&& other) noexcept {
+    if (this != &other) {
+      destroy();
+      handle_ = std::exchange(other.handle_, {});
+    }
+    return *this;
+  }
+
+  Generator(const Generator&) = delete;
+  Generator& operator=(const Generator&) = delete;
+
+  ~Generator() { destroy(); }
+
+  /**
+   * @brief 最初の値まで実行し、先頭を指すイテレータを返す
+   * @return Iterator 先頭のイテレータ
+   */
+  Iterator begin() {
+    if (handle_) {
+      resume(handle_);
+    }
+    return Iterator(handle_);
+  }
+
+  /**
+   * @brief 終端を表す番兵を返す
+   * @return std::default_sentinel_t 番兵
+   */
+  std::default_sentinel_t end() const noexcept { return {}; }
+
+ private:
+  explicit Generator(Handle handle) noexcept : handle_(handle) {}
+
+  static void resume(Handle handle) {
+    handle.resume();
+    if (handle.done() && handle.promise().exception) {
+      std::rethrow_exception(std::exchange(handle.promise().exception, {}));
+    }
+  }
+
+  void destroy() noexcept {
+    if (handle_) {
+      handle_.destroy();
+      handle_ = {};
+    }
+  }
+
+  Handle handle_;
+};
+
+}  // namespace trans_geo::pipeline
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+#include "coordinate/point_buffer.hpp"  // PointBuffer の定義
+#include "coordinate/point_view.hpp"    // PointView / ConstPointView の定義
+
+namespace trans_geo::pipeline {
+
+/**
+ * @brief 容量制限付きの点のキュー（センサ入力とパイプラインの接続用）
+ *
+ * センサのコールバックなど任意のスレッドから点を push し、パイプラインの
+ * 先頭（channelSource()）が pop します。満杯のときは push が待機する
+ * ため、パイプラインの処理が追いつかない場合は入力側に背圧がかかります。
+ * 点は成分ごとのリングバッファに格納します。
+ */
+class PointChannel {
+ public:
+  /**
+   * @brief コンストラクタ
+   * @param capacity 保持できる最大点数
+   * @throw std::invalid_argument capacity が 0 の場合
+   */
+  explicit PointChannel(std::size_t capacity);
+
+  /**
+   * @brief 1 点を追加する（満杯の間は待機する）
+   * @param point 追加する点
+   * @return bool 追加した場合は true。close() 済みの場合は false
+   */
+  bool push(const std::array<double, 3>& point);
+
+  /**
+   * @brief 複数の点を追加する（空きができるたびに順に追加する）
+   * @param points 追加する点列
+   * @return std::size_t 追加した点数（close() されると途中で打ち切る）
+   */
+  std::size_t push(trans_geo::coordinate::ConstPointView points);
+
+  /**
+   * @brief 1 点を待機せずに追加する
+   * @param point 追加する点
+   * @return bool 追加した場合は true。満杯または close() 済みの場合は false
+   */
+  bool tryPush(const std::array<double, 3>& point);
+
+  /**
+   * @brief 入力の終了を通知する
+   *
+   * 以降の push は失敗し、pop は残りの点を取り出した後に 0 を返します。
+   */
+  void close();
+
+  /**
+   * @brief 点を取り出す
+   *
+   * 1 点以上たまるか close() されるまで待機し、その時点でたまっている点を
+   * output の容量まで一度に取り出します。
+   *
+   * @param output 取り出し先
+   * @return std::size_t 取り出した点数。close() 済みで空の場合は 0
+   */
+  std::size_t pop(trans_geo::coordinate::PointView output);
+
+  /**
+   * @brief 現在たまっている点数を取得する
+   * @return std::size_t 点数
+   */
+  std::size_t size() const;
+
+  /**
+   * @brief 容量を取得する
+   * @return std::size_t 保持できる最大点数
+   */
+  std::size_t capacity() const noexcept;
+
+ private:
+  mutable std::mutex mutex_;
+  std::condition_variable notEmpty_;
+  std::condition_variable notFull_;
+  trans_geo::coordinate::PointBuffer ring_;
+  std::size_t head_ = 0;   ///< 先頭の点の位置
+  std::size_t count_ = 0;  ///< たまっている点数
+  bool closed_ = false;
+};
+
+}  // namespace trans_geo::pipeline
@@ -0,0 +1,251 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace trans_geo::pipeline {
+
+/// 偽共有を避けるための整列単位（バイト）
+constexpr std::size_t kCacheLineSize = 64;
+
+/**
+ * @brief ロックフリーの単一生産者・単一消費者リングバッファ
+ *
+ * 生産者と消費者がそれぞれ 1 スレッドの場合に使用します。書き込み位置と
+ * 読み出し位置は別々のキャッシュラインに置き、相手側の位置は各スレッドが
+ * キャッシュして、必要なときだけ読み直します。容量は 2 のべき乗に
+ * 切り上げます。要素はヒープ確保を伴わない値型を想定しています。
+ *
+ * @tparam T 要素の型（トリビアルにコピー可能であること）
+ */
+template <typename T>
+class SpscRing {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "SpscRing requires a trivially copyable element type");
+
+ public:
+  /**
+   * @brief コンストラクタ
+   * @param capacity 最小の容量（2 のべき乗に切り上げる）
+   * @throw std::invalid_argument capacity が 0 の場合
+   */
+  explicit SpscRing(std::size_t capacity)
+      : mask_(roundUpCapacity(capacity) - 1),
+        slots_(std::make_unique<T[]>(mask_ + 1)) {}
+
+  SpscRing(const SpscRing&) = delete;
+  SpscRing& operator=(const SpscRing&) = delete;
+
+  /**
+   * @brief 1 要素を追加する（生産者スレッドのみ）
+   * @param value 追加する値
+   * @return bool 追加した場合は true。満杯の場合は false
+   */
+  bool tryPush(const T& value) noexcept {
+    std::size_t tail = producer_.tail.load(std::memory_order_relaxed);
+    if (tail - producer_.cachedHead > mask_) {
+      producer_.cachedHead = consumer_.head.load(std::memory_order_acquire);
+      if (tail - producer_.cachedHead > mask_) {
+        return false;
+      }
+    }
+    slots_[tail & mask_] = value;
+    producer_.tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief 1 要素を取り出す（消費者スレッドのみ）
+   * @param value 取り出し先
+   * @return bool 取り出した場合は true。空の場合は false
+   */
+  bool tryPop(T& value) noexcept { return popBatch(&value, 1) == 1; }
+
+  /**
+   * @brief たまっている要素を最大 maxCount 個まとめて取り出す
+   *        （消費者スレッドのみ）
+   * @param output   取り出し先（maxCount 要素以上）
+   * @param maxCount 取り出す最大数
+   * @return std::size_t 取り出した数
+   */
+  std::size_t popBatch(T* output, std::size_t maxCount) noexcept {
+    std::size_t head = consumer_.head.load(std::memory_order_relaxed);
+    if (consumer_.cachedTail - head < maxCount) {
+      consumer_.cachedTail = producer_.tail.load(std::memory_order_acquire);
+    }
+    std::size_t count = consumer_.cachedTail - head;
+    if (count > maxCount) {
+      count = maxCount;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+      output[i] = slots_[(head + i) & mask_];
+    }
+    consumer_.head.store(head + count, std::memory_order_release);
+    return count;
+  }
+
+  /**
+   * @brief 容量を取得する
+   * @return std::size_t 容量
+   */
+  std::size_t capacity() const noexcept { return mask_ + 1; }
+
+ private:
+  static std::size_t roundUpCapacity(std::size_t capacity) {
+    if (capacity == 0) {
+      throw std::invalid_argument("SpscRing requires a positive capacity.");
+    }
+    std::size_t rounded = 1;
+    while (rounded < capacity) {
+      rounded <<= 1;
+    }
+    return rounded;
+  }
+
+  /// 生産者が更新する状態
+  struct alignas(kCacheLineSize) ProducerState {
+    std::atomic<std::size_t> tail{0};
+    std::size_t cachedHead = 0;  ///< 最後に読んだ消費者の位置
+  };
+
+  /// 消費者が更新する状態
+  struct alignas(kCacheLineSize) ConsumerState {
+    std::atomic<std::size_t> head{0};
+    std::size_t cachedTail = 0;  ///< 最後に読んだ生産者の位置
+  };
+
+  const std::size_t mask_;
+  std::unique_ptr<T[]> slots_;
+  ProducerState producer_;
+  ConsumerState consumer_;
+};
+
+/**
+ * @brief ロックフリーの複数生産者・単一消費者リングバッファ
+ *
+ * 複数の受信スレッドから追加し、1 つの変換スレッドが取り出す場合に
+ * 使用します。各スロットに世代番号を持たせ、生産者は書き込み位置を
+ * CAS で確保してから値を書き込みます（Vyukov 方式の有界キュー）。
+ * 容量は 2 のべき乗に切り上げます。
+ *
+ * @tparam T 要素の型（トリビアルにコピー可能であること）
+ */
+template <typename T>
+class MpscRing {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "MpscRing requires a trivially copyable element type");
+
+ public:
+  /**
+   * @brief コンストラクタ
+   * @param capacity 最小の容量（2 のべき乗に切り上げる）
+   * @throw std::invalid_argument capacity が 0 の場合
+   */
+  explicit MpscRing(std::size_t capacity)
+      : mask_(roundUpCapacity(capacity) - 1),
+        slots_(std::make_unique<Slot[]>(mask_ + 1)) {
+    for (std::size_t i = 0; i <= mask_; ++i) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  MpscRing(const MpscRing&) = delete;
+  MpscRing& operator=(const MpscRing&) = delete;
+
+  /**
+   * @brief 1 要素を追加する（任意のスレッド）
+   * @param value 追加する値
+   * @return bool 追加した場合は true。満杯の場合は false
+   */
+  bool tryPush(const T& value) noexcept {
+    std::size_t tail = tail_.value.load(std::memory_order_relaxed);
+    for (;;) {
+      Slot& slot = slots_[tail & mask_];
+      std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<std::ptrdiff_t>(sequence - tail);
+      if (diff == 0) {
+        if (tail_.value.compare_exchange_weak(tail, tail + 1,
+                                              std::memory_order_relaxed)) {
+          slot.value = value;
+          slot.sequence.store(tail + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        tail = tail_.value.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * @brief 1 要素を取り出す（消費者スレッドのみ）
+   * @param value 取り出し先
+   * @return bool 取り出した場合は true。空の場合は false
+   */
+  bool tryPop(T& value) noexcept { return popBatch(&value, 1) == 1; }
+
+  /**
+   * @brief 書き込みが完了した要素を最大 maxCount 個まとめて取り出す
+   *        （消費者スレッドのみ）
+   * @param output   取り出し先（maxCount 要素以上）
+   * @param maxCount 取り出す最大数
+   * @return std::size_t 取り出した数
+   */
+  std::size_t popBatch(T* output, std::size_t maxCount) noexcept {
+    std::size_t head = head_.value.load(std::memory_order_relaxed);
+    std::size_t count = 0;
+    while (count < maxCount) {
+      Slot& slot = slots_[(head + count) & mask_];
+      // 位置を確保済みで書き込み中の要素に達したら止める
+      if (slot.sequence.load(std::memory_order_acquire) !=
+          head + count + 1) {
+        break;
+      }
+      output[count] = slot.value;
+      slot.sequence.store(head + count + mask_ + 1,
+                          std::memory_order_release);
+      ++count;
+    }
+    head_.value.store(head + count, std::memory_order_relaxed);
+    return count;
+  }
+
+  /**
+   * @brief 容量を取得する
+   * @return std::size_t 容量
+   */
+  std::size_t capacity() const noexcept { return mask_ + 1; }
+
+ private:
+  static std::size_t roundUpCapacity(std::size_t capacity) {
+    if (capacity == 0) {
+      throw std::invalid_argument("MpscRing requires a positive capacity.");
+    }
+    std::size_t rounded = 1;
+    while (rounded < capacity) {
+      rounded <<= 1;
+    }
+    return rounded;
+  }
+
+  struct Slot {
+    std::atomic<std::size_t> sequence;
+    T value;
+  };
+
+  /// キャッシュラインを占有する位置
+  struct alignas(kCacheLineSize) PaddedIndex {
+    std::atomic<std::size_t> value{0};
+  };
+
+  const std::size_t mask_;
+  std::unique_ptr<Slot[]> slots_;
+  PaddedIndex tail_;  ///< 生産者が確保する次の位置
+  PaddedIndex head_;  ///< 消費者が次に読む位置
+};
+
+}  // namespace trans_geo::pipeline
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+
+#include "converter/i_coordiante_converter.hpp"  // ICoordinateConverter の定義
+#include "coordinate/point_view.hpp"  // ConstPointView の定義
+#include "pipeline/generator.hpp"     // Generator の定義
+#include "pipeline/point_channel.hpp"  // PointChannel の定義
+
+namespace trans_geo::pipeline {
+
+/// 既定の一括変換の点数
+constexpr std::size_t kDefaultBatchSize = 256;
+
+/**
+ * @brief 座標列のバッチを順に生成するストリーム
+ *
+ * 生成されたビューは、次のバッチを要求するまで有効です。
+ */
+using BatchStream = Generator<trans_geo::coordinate::ConstPointView>;
+
+/**
+ * @brief 座標列を batchSize 点ずつのバッチとして生成する
+ *
+ * @param points    入力の座標列（ストリームより長く有効であること）
+ * @param batchSize 1 バッチの最大点数
+ * @return BatchStream 入力を指すバッチ（コピーしない）
+ */
+BatchStream viewSource(trans_geo::coordinate::ConstPointView points,
+                       std::size_t batchSize = kDefaultBatchSize);
+
+/**
+ * @brief PointChannel から点を取り出してバッチとして生成する
+ *
+ * 1 点以上届くまで待機し、その時点でたまっている点を最大 maxBatch 点
+ * まとめて生成します。入力が集中した場合は大きなバッチに、まばらな
+ * 場合は待たずに小さなバッチになります。close() で終了します。
+ *
+ * @param channel  入力のキュー（ストリームより長く有効であること）
+ * @param maxBatch 1 バッチの最大点数
+ * @return BatchStream 取り出した点のバッチ
+ */
+BatchStream channelSource(PointChannel& channel,
+                          std::size_t maxBatch = kDefaultBatchSize);
+
+/**
+ * @brief 小さなバッチを batchSize 点のバッチにまとめる
+ *
+ * 上流のバッチを batchSize 点になるまで内部バッファにためてから生成します。
+ * 空の状態で batchSize 点以上のバッチが届いた場合は、コピーせずに
+ * 分割して生成します。上流が終了すると残りを生成します。
+ *
+ * @param source    上流のストリーム
+ * @param batchSize まとめる点数
+ * @return BatchStream batchSize 点（最後のみ以下）のバッチ
+ * @throw std::invalid_argument batchSize が 0 の場合（最初の取り出し時）
+ */
+BatchStream coalesce(BatchStream source,
+                     std::size_t batchSize = kDefaultBatchSize);
+
+/**
+ * @brief 各バッチを変換器で一括変換する
+ *
+ * 出力は段ごとのバッファに書き込み、バッファは使い回します。
+ *
+ * @param source    上流のストリーム
+ * @param converter 変換器（ストリームより長く有効であること）
+ * @return BatchStream 変換後のバッチ
+ * @throw std::invalid_argument convertBatch() が失敗した場合
+ * （取り出し時に送出）
+ */
+BatchStream convertStage(
+    BatchStream source,
+    const trans_geo::conversion::ICoordinateConverter& converter);
+
+}  // namespace trans_geo::pipeline
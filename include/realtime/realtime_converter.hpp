@@ -0,0 +1,140 @@
+#pragma once
+
+#include <array>
+
+#include "ellipsoid/ellipsoid.hpp"  // Ellipsoid 構造体の定義
+#include "kernel/enu.hpp"           // ECEF ⇔ ENU のカーネル
+#include "kernel/geodetic.hpp"      // Geo ⇔ ECEF のカーネル
+
+namespace trans_geo::realtime {
+
+/**
+ * @brief 地理座標の値型 [緯度（度）, 経度（度）, 楕円体高（メートル）]
+ */
+struct GeoPoint {
+  double latitude;
+  double longitude;
+  double altitude;
+};
+
+/**
+ * @brief ECEF 座標の値型（メートル）
+ */
+struct ECEFPoint {
+  double x;
+  double y;
+  double z;
+};
+
+/**
+ * @brief ENU 座標の値型（メートル）
+ */
+struct ENUPoint {
+  double east;
+  double north;
+  double up;
+};
+
+/// ECEF → Geo で適用する Bowring 法の回数（固定）
+constexpr int kRealtimeBowringSteps = 2;
+
+/**
+ * @brief 実行時間の上限が決まる変換（ハードリアルタイム向け）
+ *
+ * 値型のみを扱い、ヒープ確保・例外・仮想関数呼び出しを一切行いません。
+ * すべての関数は noexcept で、入力値によって反復回数が変わる処理を
+ * 含まないため、演算回数は一定です。
+ *
+ * - ECEF → Geo は Bowring 法を常に kRealtimeBowringSteps 回適用します
+ *   （GeodeticPrecision::Micrometre と同じ結果・精度）。
+ *   ECEFToGeoConverter の既定の反復法（最大 100 回）は使いません。
+ * - ENU の原点と回転行列はコンストラクタで一度だけ計算します。
+ *
+ * 入力の検証は行わず、NaN などの不正な値はそのまま結果に伝搬します。
+ * コピーしてスレッドごとに保持できます。
+ */
+class RealtimeConverter {
+ public:
+  /**
+   * @brief コンストラクタ
+   * @param ellipsoid 楕円体モデル（例: WGS84）
+   * @param origin    ENU 座標系の原点
+   */
+  RealtimeConverter(const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
+                    const GeoPoint& origin) noexcept
+      : ellipsoid_(ellipsoid),
+        originEcef_(trans_geo::kernel::geoToEcef(
+            ellipsoid, origin.latitude, origin.longitude, origin.altitude)),
+        rotation_(
+            trans_geo::kernel::enuRotation(origin.latitude, origin.longitude)) {
+  }
+
+  /**
+   * @brief Geo → ECEF
+   * @param geo 地理座標
+   * @return ECEFPoint ECEF 座標
+   */
+  ECEFPoint toECEF(const GeoPoint& geo) const noexcept {
+    std::array<double, 3> p = trans_geo::kernel::geoToEcef(
+        ellipsoid_, geo.latitude, geo.longitude, geo.altitude);
+    return {p[0], p[1], p[2]};
+  }
+
+  /**
+   * @brief ECEF → Geo（Bowring 法・固定回数）
+   * @param ecef ECEF 座標
+   * @return GeoPoint 地理座標
+   */
+  GeoPoint toGeo(const ECEFPoint& ecef) const noexcept {
+    std::array<double, 3> g = trans_geo::kernel::ecefToGeoBowring(
+        ellipsoid_, ecef.x, ecef.y, ecef.z, kRealtimeBowringSteps);
+    return {g[0], g[1], g[2]};
+  }
+
+  /**
+   * @brief ECEF → ENU
+   * @param ecef ECEF 座標
+   * @return ENUPoint ENU 座標
+   */
+  ENUPoint toENU(const ECEFPoint& ecef) const noexcept {
+    std::array<double, 3> e = trans_geo::kernel::ecefToEnu(
+        rotation_, originEcef_, {ecef.x, ecef.y, ecef.z});
+    return {e[0], e[1], e[2]};
+  }
+
+  /**
+   * @brief ENU → ECEF
+   * @param enu ENU 座標
+   * @return ECEFPoint ECEF 座標
+   */
+  ECEFPoint toECEF(const ENUPoint& enu) const noexcept {
+    std::array<double, 3> p = trans_geo::kernel::enuToEcef(
+        rotation_, originEcef_, {enu.east, enu.north, enu.up});
+    return {p[0], p[1], p[2]};
+  }
+
+  /**
+   * @brief Geo → ENU
+   * @param geo 地理座標
+   * @return ENUPoint ENU 座標
+   */
+  ENUPoint toENU(const GeoPoint& geo) const noexcept {
+    return toENU(toECEF(geo));
+  }
+
+  /**
+   * @brief ENU → Geo
+   * @param enu ENU 座標
+   * @return GeoPoint 地理座標
+   */
+  GeoPoint toGeo(const ENUPoint& enu) const noexcept {
+    return toGeo(toECEF(enu));
+  }
+
+ private:
+  trans_geo::ellipsoid::Ellipsoid ellipsoid_;
+  std::array<double, 3> originEcef_;  ///< 原点の ECEF 座標
+  std::array<double, 9> rotation_;    ///< ECEF→ENU 回転行列（行優先）
+};
+
+}  // namespace trans_geo::realtime
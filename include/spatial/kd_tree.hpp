@@ -0,0 +1,166 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "converter/conversion_status.hpp"       // ConversionStatus の定義
+#include "converter/i_coordiante_converter.hpp"  // ICoordinateConverter の定義
+#include "coordinate/point_buffer.hpp"  // PointBuffer の定義
+#include "coordinate/point_view.hpp"    // ConstPointView の定義
+
+namespace trans_geo::spatial {
+
+/// 近傍が見つからなかったことを表す番号
+constexpr std::size_t kNoNeighbor = std::numeric_limits<std::size_t>::max();
+
+/// 既定の葉の最大点数
+constexpr std::size_t kDefaultLeafSize = 16;
+
+/**
+ * @brief 近傍点
+ */
+struct Neighbor {
+  std::size_t index = kNoNeighbor;  ///< 構築時の座標列での番号
+  double distance = std::numeric_limits<double>::infinity();  ///< 距離（m）
+};
+
+/**
+ * @brief ECEF 座標の最近傍探索用 KD 木
+ *
+ * 構築時に点を木の葉の順に並べ替えて成分ごとの配列（SoA）に格納し、
+ * ノードも深さ優先順の 1 本の配列に置きます。探索はポインタをたどらず、
+ * 固定長のスタックで行うためヒープ確保を伴いません（半径探索の結果を除く）。
+ *
+ * ECEF は直交座標なので距離はユークリッド距離（メートル）です。Geo や ENU の
+ * 問い合わせは、ECEF へ変換する変換器（GeoToECEFConverter・
+ * ENUToECEFConverter）を渡すと内部で変換します。
+ *
+ * 構築後は変更できず、const メンバ関数は複数のスレッドから同時に呼べます。
+ */
+class KdTree {
+ public:
+  /**
+   * @brief ECEF 座標列から木を構築する
+   *
+   * @param ecef     ECEF 座標列（メートル）。値はコピーして保持する
+   * @param leafSize 葉の最大点数
+   * @throw std::invalid_argument leafSize が 0 の場合、または点数が
+   * 2^32 - 1 を超える場合
+   */
+  explicit KdTree(trans_geo::coordinate::ConstPointView ecef,
+                  std::size_t leafSize = kDefaultLeafSize);
+
+  /**
+   * @brief 点数を取得する
+   * @return std::size_t 点数
+   */
+  std::size_t size() const noexcept;
+
+  /**
+   * @brief k 近傍を探索する
+   *
+   * @param query 問い合わせ点（ECEF）
+   * @param out   近い順に書き込む出力先（k = out.size()）
+   * @return std::size_t 見つかった点数（点数が k 未満の場合は残りが
+   * kNoNeighbor）
+   */
+  std::size_t nearest(const std::array<double, 3>& query,
+                      std::span<Neighbor> out) const noexcept;
+
+  /**
+   * @brief Geo / ENU の問い合わせ点の k 近傍を探索する
+   *
+   * @param query 問い合わせ点
+   * @param toEcef query を ECEF に変換する変換器
+   * @param out   近い順に書き込む出力先（k = out.size()）
+   * @return std::size_t 見つかった点数
+   */
+  std::size_t nearest(
+      const std::array<double, 3>& query,
+      const trans_geo::conversion::ICoordinateConverter& toEcef,
+      std::span<Neighbor> out) const noexcept;
+
+  /**
+   * @brief 半径内の点を探索する
+   *
+   * @param query  問い合わせ点（ECEF）
+   * @param radius 半径（メートル）
+   * @param out    近い順に格納する出力先（内容は置き換える）
+   */
+  void withinRadius(const std::array<double, 3>& query, double radius,
+                    std::vector<Neighbor>& out) const;
+
+  /**
+   * @brief Geo / ENU の問い合わせ点から半径内の点を探索する
+   *
+   * @param query  問い合わせ点
+   * @param toEcef query を ECEF に変換する変換器
+   * @param radius 半径（メートル）
+   * @param out    近い順に格納する出力先（内容は置き換える）
+   */
+  void withinRadius(const std::array<double, 3>& query,
+                    const trans_geo::conversion::ICoordinateConverter& toEcef,
+                    double radius, std::vector<Neighbor>& out) const;
+
+  /**
+   * @brief 複数の問い合わせ点の k 近傍を並列に探索する
+   *
+   * 第 i 点の結果は out[i * k, (i + 1) * k) に書き込みます。
+   *
+   * @param queries     問い合わせ点列（ECEF）
+   * @param k           近傍数
+   * @param out         出力先（queries.size() * k 要素）
+   * @param threadCount スレッド数（0 の場合はハードウェアのスレッド数）
+   * @throw std::invalid_argument out の大きさが一致しない場合
+   */
+  void nearestBatch(trans_geo::coordinate::ConstPointView queries,
+                    std::size_t k, std::span<Neighbor> out,
+                    std::size_t threadCount = 0) const;
+
+  /**
+   * @brief Geo / ENU の問い合わせ点列を ECEF に一括変換してから
+   *        k 近傍を並列に探索する
+   *
+   * @param queries     問い合わせ点列
+   * @param toEcef      queries を ECEF に変換する変換器
+   * @param k           近傍数
+   * @param out         出力先（queries.size() * k 要素）
+   * @param threadCount スレッド数（0 の場合はハードウェアのスレッド数）
+   * @return trans_geo::conversion::ConversionStatus 変換の結果（Ok 以外の
+   * 場合は探索しない）
+   * @throw std::invalid_argument out の大きさが一致しない場合
+   */
+  trans_geo::conversion::ConversionStatus nearestBatch(
+      trans_geo::coordinate::ConstPointView queries,
+      const trans_geo::conversion::ICoordinateConverter& toEcef,
+      std::size_t k, std::span<Neighbor> out,
+      std::size_t threadCount = 0) const;
+
+ private:
+  /**
+   * @brief 木のノード（深さ優先順。左の子は直後のノード）
+   */
+  struct Node {
+    double split;        ///< 分割値（葉では未使用）
+    std::uint32_t begin;  ///< 点の範囲の先頭
+    std::uint32_t end;    ///< 点の範囲の末尾
+    std::uint32_t right;  ///< 右の子の番号（葉では 0）
+    std::uint32_t axis;   ///< 分割軸（葉では 3）
+  };
+
+  struct BuildEntry;
+
+  std::uint32_t build(std::vector<BuildEntry>& entries, std::uint32_t begin,
+                      std::uint32_t end);
+
+  std::size_t leafSize_;
+  std::vector<Node> nodes_;
+  std::vector<std::uint32_t> indices_;  ///< 並べ替え後の位置 → 元の番号
+  trans_geo::coordinate::PointBuffer points_;  ///< 葉の順に並べた点
+};
+
+}  // namespace trans_geo::spatial
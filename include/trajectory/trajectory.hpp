@@ -0,0 +1,141 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "converter/conversion_status.hpp"       // ConversionStatus の定義
+#include "converter/i_coordiante_converter.hpp"  // ICoordinateConverter の定義
+#include "coordinate/point_buffer.hpp"  // PointBuffer の定義
+#include "coordinate/point_view.hpp"    // PointView の定義
+
+namespace trans_geo::trajectory {
+
+/**
+ * @brief 補間方法
+ */
+enum class InterpolationMethod {
+  Linear,      ///< 区分線形
+  Hermite,     ///< 3 次エルミート（速度があれば使用、なければ差分で推定）
+  CubicSpline  ///< 自然 3 次スプライン（2 階微分まで連続）
+};
+
+/**
+ * @brief 変換器を指定した Trajectory::interpolate() の結果
+ */
+struct InterpolationResult {
+  std::size_t interpolated = 0;  ///< 範囲内で補間した点数
+  trans_geo::conversion::ConversionStatus status =
+      trans_geo::conversion::ConversionStatus::Ok;  ///< 変換の結果
+};
+
+/**
+ * @brief 時刻付き ECEF 位置の列（軌跡）と補間
+ *
+ * 緯度・経度ではなく ECEF の直交座標で補間するため、極付近や経度 ±180°
+ * をまたぐ区間でも歪みません。補間結果は ECEF のまま一括変換器に渡して
+ * ENU や Geo に変換できます。
+ *
+ * サンプルの時刻は狭義単調増加である必要があります。時刻の単位は任意
+ * です（速度を与える場合は同じ時間単位で与えてください）。
+ */
+class Trajectory {
+ public:
+  Trajectory() = default;
+
+  /**
+   * @brief サンプルを末尾に追加する
+   *
+   * @param time     時刻
+   * @param position ECEF 位置（メートル）
+   * @throw std::invalid_argument time が直前のサンプルの時刻以下の場合、
+   * または速度付きのサンプルと混在させた場合
+   */
+  void append(double time, const std::array<double, 3>& position);
+
+  /**
+   * @brief 速度付きのサンプルを末尾に追加する
+   *
+   * すべてのサンプルに速度がある場合、Hermite 補間は差分の代わりに
+   * この速度を接線として使います。
+   *
+   * @param time     時刻
+   * @param position ECEF 位置（メートル）
+   * @param velocity ECEF 速度（メートル / 時間単位）
+   * @throw std::invalid_argument time が直前のサンプルの時刻以下の場合、
+   * または速度なしのサンプルと混在させた場合
+   */
+  void append(double time, const std::array<double, 3>& position,
+              const std::array<double, 3>& velocity);
+
+  /**
+   * @brief サンプル数を取得する
+   * @return std::size_t サンプル数
+   */
+  std::size_t size() const noexcept;
+
+  /**
+   * @brief 補間できる時刻の範囲の始点を取得する
+   * @return double 最初のサンプルの時刻（空の場合は未定義）
+   */
+  double getStartTime() const noexcept;
+
+  /**
+   * @brief 補間できる時刻の範囲の終点を取得する
+   * @return double 最後のサンプルの時刻（空の場合は未定義）
+   */
+  double getEndTime() const noexcept;
+
+  /**
+   * @brief 複数の時刻の ECEF 位置を一度に補間する
+   *
+   * 区間の位置を前回の位置から順に進めるカーソルで探すため、昇順の時刻
+   * 列では二分探索を行いません。前の区間に戻る時刻が現れた場合のみ
+   * 二分探索でカーソルを戻します。スプラインの係数は呼び出しごとに一度
+   * だけ計算します。
+   *
+   * 範囲外の時刻には NaN を書き込みます（外挿は行いません）。
+   *
+   * @param times  補間する時刻
+   * @param output 出力先（times と同じ点数）
+   * @param method 補間方法
+   * @return std::size_t 範囲内で補間した点数
+   * @throw std::invalid_argument サンプルが 2 つ未満の場合、
+   * または output の点数が times と異なる場合
+   */
+  std::size_t interpolate(std::span<const double> times,
+                          trans_geo::coordinate::PointView output,
+                          InterpolationMethod method) const;
+
+  /**
+   * @brief 補間した ECEF 位置を一括変換器でそのまま変換する
+   *
+   * interpolate() で output に ECEF 位置を書き込み、続けて
+   * converter.convertBatch(output, output) を適用します。
+   * ECEFToENUConverter や ECEFToGeoConverter を指定してください。
+   *
+   * 範囲外の時刻の行も NaN のまま変換器に渡るため、変換後も NaN です。
+   * 有効な点数は結果の interpolated で確認してください。
+   *
+   * @param times     補間する時刻
+   * @param output    出力先（times と同じ点数）
+   * @param method    補間方法
+   * @param converter ECEF を入力とする変換器
+   * @return InterpolationResult 範囲内で補間した点数と変換の結果
+   * @throw std::invalid_argument interpolate() と同じ条件
+   */
+  InterpolationResult interpolate(
+      std::span<const double> times, trans_geo::coordinate::PointView output,
+      InterpolationMethod method,
+      const trans_geo::conversion::ICoordinateConverter& converter) const;
+
+ private:
+  void appendTime(double time, bool withVelocity);
+
+  std::vector<double> times_;
+  trans_geo::coordinate::PointBuffer positions_;
+  trans_geo::coordinate::PointBuffer velocities_;  ///< 速度付きの場合のみ
+};
+
+}  // namespace trans_geo::trajectory
@@ -0,0 +1,209 @@
+#include "capi/transgeo.h"
+
+#include <cmath>
+#include <exception>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+#include "converter/ECEF_to_ENU_converter.hpp"  // ECEFToENUConverter の定義
+#include "converter/ECEF_to_geo_converter.hpp"  // ECEFToGeoConverter の定義
+#include "converter/ENU_to_ECEF_converter.hpp"  // ENUToECEFConverter の定義
+#include "converter/ENU_to_geo_converter.hpp"   // ENUToGeoConverter の定義
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "converter/geo_to_ENU_converter.hpp"   // GeoToENUConverter の定義
+#include "coordinate/geo_coordinate.hpp"        // GeoCoordinate の定義
+#include "ellipsoid/ellipsoid_registry.hpp"     // findEllipsoid の定義
+
+using trans_geo::conversion::ConversionStatus;
+using trans_geo::conversion::ICoordinateConverter;
+
+/**
+ * @brief 不透明なハンドルの実体
+ */
+struct tg_converter {
+  std::unique_ptr<ICoordinateConverter> impl;
+};
+
+namespace {
+tg_status toStatus(ConversionStatus status) noexcept {
+  switch (status) {
+    case ConversionStatus::Ok:
+      return TG_OK;
+    case ConversionStatus::NullBuffer:
+      return TG_NULL_BUFFER;
+    case ConversionStatus::InvalidStride:
+      return TG_INVALID_STRIDE;
+    case ConversionStatus::SizeMismatch:
+    case ConversionStatus::InvalidQuantization:
+    case ConversionStatus::Saturated:
+      break;
+  }
+  return TG_INTERNAL_ERROR;
+}
+
+bool isValidEllipsoid(const tg_ellipsoid* ellipsoid) noexcept {
+  return ellipsoid != nullptr && std::isfinite(ellipsoid->a) &&
+         ellipsoid->a > 0.0 && std::isfinite(ellipsoid->f) &&
+         ellipsoid->f >= 0.0 && ellipsoid->f < 1.0;
+}
+
+/**
+ * @brief 変換器を作成し、例外を結果コードに変換する
+ */
+template <typename Factory>
+tg_status create(const tg_ellipsoid* ellipsoid, tg_converter** out,
+                 Factory&& factory) noexcept {
+  if (out == nullptr || !isValidEllipsoid(ellipsoid)) {
+    return TG_INVALID_ARGUMENT;
+  }
+  try {
+    trans_geo::ellipsoid::Ellipsoid model(ellipsoid->a, ellipsoid->f);
+    *out = new tg_converter{factory(model)};
+    return TG_OK;
+  } catch (const std::bad_alloc&) {
+    return TG_OUT_OF_MEMORY;
+  } catch (const std::invalid_argument&) {
+    return TG_INVALID_ARGUMENT;
+  } catch (...) {
+    return TG_INTERNAL_ERROR;
+  }
+}
+}  // namespace
+
+extern "C" {
+
+int tg_abi_version(void) { return TG_ABI_VERSION; }
+
+const char* tg_status_string(tg_status status) {
+  switch (status) {
+    case TG_OK:
+      return "TG_OK";
+    case TG_NULL_BUFFER:
+      return "TG_NULL_BUFFER";
+    case TG_INVALID_STRIDE:
+      return "TG_INVALID_STRIDE";
+    case TG_INVALID_ARGUMENT:
+      return "TG_INVALID_ARGUMENT";
+    case TG_OUT_OF_MEMORY:
+      return "TG_OUT_OF_MEMORY";
+    case TG_INTERNAL_ERROR:
+      return "TG_INTERNAL_ERROR";
+  }
+  return "TG_UNKNOWN";
+}
+
+tg_ellipsoid tg_ellipsoid_wgs84(void) {
+  return {trans_geo::ellipsoid::WGS84.a, trans_geo::ellipsoid::WGS84.f};
+}
+
+tg_ellipsoid tg_ellipsoid_grs80(void) {
+  return {trans_geo::ellipsoid::GRS80.a, trans_geo::ellipsoid::GRS80.f};
+}
+
+tg_status tg_ellipsoid_from_epsg(int epsg_code, tg_ellipsoid* out) {
+  if (out == nullptr) {
+    return TG_NULL_BUFFER;
+  }
+  const trans_geo::ellipsoid::Ellipsoid* ellipsoid =
+      trans_geo::ellipsoid::findEllipsoid(epsg_code);
+  if (ellipsoid == nullptr) {
+    return TG_INVALID_ARGUMENT;
+  }
+  *out = {ellipsoid->a, ellipsoid->f};
+  return TG_OK;
+}
+
+tg_status tg_converter_create(tg_conversion conversion,
+                              const tg_ellipsoid* ellipsoid,
+                              const double* origin, tg_converter** out) {
+  using namespace trans_geo::conversion;
+  using trans_geo::coordinate::GeoCoordinate;
+  using trans_geo::ellipsoid::Ellipsoid;
+
+  bool needsOrigin = conversion == TG_ECEF_TO_ENU ||
+                     conversion == TG_ENU_TO_ECEF ||
+                     conversion == TG_GEO_TO_ENU || conversion == TG_ENU_TO_GEO;
+  if (needsOrigin && origin == nullptr) {
+    return TG_INVALID_ARGUMENT;
+  }
+  return create(
+      ellipsoid, out,
+      [&](const Ellipsoid& model) -> std::unique_ptr<ICoordinateConverter> {
+        switch (conversion) {
+          case TG_GEO_TO_ECEF:
+            return std::make_unique<GeoToECEFConverter>(model);
+          case TG_ECEF_TO_GEO:
+            return std::make_unique<ECEFToGeoConverter>(model);
+          case TG_ECEF_TO_ENU:
+            return std::make_unique<ECEFToENUConverter>(
+                model, GeoCoordinate(origin[0], origin[1], origin[2]));
+          case TG_ENU_TO_ECEF:
+            return std::make_unique<ENUToECEFConverter>(
+                model, GeoCoordinate(origin[0], origin[1], origin[2]));
+          case TG_GEO_TO_ENU:
+            return std::make_unique<GeoToENUConverter>(
+                model, GeoCoordinate(origin[0], origin[1], origin[2]));
+          case TG_ENU_TO_GEO:
+            return std::make_unique<ENUToGeoConverter>(
+                model, GeoCoordinate(origin[0], origin[1], origin[2]));
+        }
+        throw std::invalid_argument("tg_converter_create: unknown conversion");
+      });
+}
+
+tg_status tg_ecef_to_geo_create(const tg_ellipsoid* ellipsoid,
+                                tg_geodetic_precision precision,
+                                tg_converter** out) {
+  using namespace trans_geo::conversion;
+
+  GeodeticPrecision preset;
+  switch (precision) {
+    case TG_PRECISION_REFERENCE:
+      preset = GeodeticPrecision::Reference;
+      break;
+    case TG_PRECISION_MICROMETRE:
+      preset = GeodeticPrecision::Micrometre;
+      break;
+    case TG_PRECISION_MILLIMETRE:
+      preset = GeodeticPrecision::Millimetre;
+      break;
+    case TG_PRECISION_DECIMETRE:
+      preset = GeodeticPrecision::Decimetre;
+      break;
+    default:
+      return TG_INVALID_ARGUMENT;
+  }
+  return create(ellipsoid, out,
+                [&](const trans_geo::ellipsoid::Ellipsoid& model) {
+                  return std::make_unique<ECEFToGeoConverter>(model, preset);
+                });
+}
+
+void tg_converter_destroy(tg_converter* converter) { delete converter; }
+
+tg_status tg_convert_strided(const tg_converter* converter, size_t count,
+                             const double* in_x, const double* in_y,
+                             const double* in_z, size_t in_stride,
+                             double* out_x, double* out_y, double* out_z,
+                             size_t out_stride) {
+  if (converter == nullptr) {
+    return TG_INVALID_ARGUMENT;
+  }
+  trans_geo::coordinate::ConstPointView input(in_x, in_y, in_z, count,
+                                              in_stride);
+  trans_geo::coordinate::PointView output(out_x, out_y, out_z, count,
+                                          out_stride);
+  return toStatus(converter->impl->convertBatch(input, output));
+}
+
+tg_status tg_convert_interleaved(const tg_converter* converter, size_t count,
+                                 const double* in, double* out) {
+  if (in == nullptr || out == nullptr) {
+    return count == 0 ? TG_OK : TG_NULL_BUFFER;
+  }
+  return tg_convert_strided(converter, count, in, in + 1, in + 2, 3, out,
+                            out + 1, out + 2, 3);
+}
+
+}  // extern "C"
@@ -1,23 +1,27 @@
 #include "converter/ECEF_to_ENU_converter.hpp"
 
-#include <Eigen/Dense>
-#include <cmath>
 #include <stdexcept>
 
 #include "coordinate/ECEF_coordinate.hpp"  // ECEFCoordinate の定義
 #include "coordinate/ENU_coordinate.hpp"   // ENUCoordinate の定義
 #include "coordinate/geo_coordinate.hpp"   // GeoCoordinate の定義
-#include "utils/utils.hpp"                 // degToRad, etc.
+#include "instrumentation/instrumentation.hpp"
+#include "kernel/batch_dispatch.hpp"  // batchKernels の定義
 
 namespace trans_geo::conversion {
 
 ECEFToENUConverter::ECEFToENUConverter(
     const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
     const trans_geo::coordinate::GeoCoordinate& origin)
-    : ellipsoid_(ellipsoid), origin_(origin) {}
+    : ellipsoid_(ellipsoid),
+      origin_(origin),
+      originHandle_(trans_geo::coordinate::internOrigin(origin)),
+      frame_(ellipsoid, origin) {}
 
 std::unique_ptr<trans_geo::interface::ICoordinate> ECEFToENUConverter::convert(
     const trans_geo::interface::ICoordinate& input) const {
+  TRANSGEO_INSTRUMENT_SCOPE(ECEFToENU, Convert, 1);
+
   // 入力が ECEFCoordinate であることを確認
   const auto* ecef =
       dynamic_cast<const trans_geo::coordinate::ECEFCoordinate*>(&input);
@@ -26,77 +30,109 @@ std::unique_ptr<trans_geo::interface::ICoordinate> ECEFToENUConverter::convert(
         "ECEFToENUConverter::convert expects input to be an ECEFCoordinate.");
   }
 
-  // ECEF 座標値を取得
-  std::vector<double> ecefValues = ecef->getValues();
-  if (ecefValues.size() != 3) {
-    throw std::invalid_argument("ECEFCoordinate must have exactly 3 values.");
+  // ENU 座標 = R * (p - p0)（原点と回転行列はキャッシュ済み）
+  std::array<double, 3> enu = frame_.toENU(ecef->getValueArray());
+
+  // 変換結果として、原点を共有する ENUCoordinate を生成
+  return std::make_unique<trans_geo::coordinate::ENUCoordinate>(
+      enu[0], enu[1], enu[2], originHandle_);
+}
+
+ConversionStatus ECEFToENUConverter::convertBatch(
+    trans_geo::coordinate::ConstPointView input,
+    trans_geo::coordinate::PointView output) const noexcept {
+  ConversionStatus status = validateBatch(input, output);
+  if (status != ConversionStatus::Ok) {
+    return status;
+  }
+
+  TRANSGEO_INSTRUMENT_SCOPE(ECEFToENU, Batch, input.size());
+  trans_geo::kernel::batchKernels().ecefToEnu(
+      frame_.getRotation().data(), frame_.getOriginECEF().data(),
+      trans_geo::kernel::makeBatchSpan(input, output));
+  return ConversionStatus::Ok;
+}
+
+ConversionStatus ECEFToENUConverter::convertBatchQuantized(
+    trans_geo::coordinate::ConstPointView input,
+    trans_geo::coordinate::QuantizedPointView output,
+    const trans_geo::coordinate::Quantization& quantization) const noexcept {
+  ConversionStatus status = validateBatch(input, output, quantization);
+  if (status != ConversionStatus::Ok) {
+    return status;
+  }
+
+  TRANSGEO_INSTRUMENT_SCOPE(ECEFToENU, Batch, input.size());
+  std::size_t saturated = trans_geo::kernel::batchKernels().ecefToEnuQuantized(
+      frame_.getRotation().data(), frame_.getOriginECEF().data(),
+      trans_geo::kernel::makeFixedPointScale(quantization),
+      trans_geo::kernel::makeBatchSpan(input, output));
+  return saturated == 0 ? ConversionStatus::Ok : ConversionStatus::Saturated;
+}
+
+ConversionStatus ECEFToENUConverter::convertBatchDequantized(
+    trans_geo::coordinate::ConstQuantizedPointView input,
+    const trans_geo::coordinate::Quantization& quantization,
+    trans_geo::coordinate::PointView output) const noexcept {
+  ConversionStatus status = validateBatch(input, quantization, output);
+  if (status != ConversionStatus::Ok) {
+    return status;
   }
-  double X = ecefValues[0];
-  double Y = ecefValues[1];
-  double Z = ecefValues[2];
-
-  // 原点の GeoCoordinate から値を取得（緯度,
-  // 経度は度、オプションの高度はメートル）
-  std::vector<double> geoValues = origin_.getValues();
-  if (geoValues.size() < 2) {
+
+  TRANSGEO_INSTRUMENT_SCOPE(ECEFToENU, Batch, input.size());
+  trans_geo::kernel::batchKernels().ecefToEnuDequantized(
+      frame_.getRotation().data(), frame_.getOriginECEF().data(),
+      trans_geo::kernel::makeFixedPointScale(quantization),
+      trans_geo::kernel::makeBatchSpan(input, output));
+  return ConversionStatus::Ok;
+}
+
+std::array<double, 3> ECEFToENUConverter::convertVelocity(
+    const std::array<double, 3>& ecefVelocity) const noexcept {
+  return frame_.rotateToENU(ecefVelocity);
+}
+
+std::array<double, 3> ECEFToENUConverter::convertAcceleration(
+    const std::array<double, 3>& ecefAcceleration) const noexcept {
+  return frame_.rotateToENU(ecefAcceleration);
+}
+
+void ECEFToENUConverter::convertStates(std::span<const double> ecefStates,
+                                       std::span<double> enuStates) const {
+  if (ecefStates.size() % kStateVectorSize != 0) {
+    throw std::invalid_argument(
+        "ECEFToENUConverter::convertStates expects a multiple of 6 values.");
+  }
+  if (ecefStates.size() != enuStates.size()) {
     throw std::invalid_argument(
-        "Origin GeoCoordinate does not contain enough values.");
+        "ECEFToENUConverter::convertStates requires input and output of the "
+        "same size.");
   }
-  double lat_deg = geoValues[0];
-  double lon_deg = geoValues[1];
-  double h_origin = (geoValues.size() == 3) ? geoValues[2] : 0.0;
-
-  // 緯度・経度をラジアンに変換（共通ユーティリティを利用）
-  double lat = trans_geo::utils::degToRad(lat_deg);
-  double lon = trans_geo::utils::degToRad(lon_deg);
-
-  // 楕円体モデルパラメータ
-  double a = ellipsoid_.a;
-  double e2 = ellipsoid_.e2;
-
-  // 原点の ECEF 座標を計算（Geo→ECEF 変換）
-  double sinLat = std::sin(lat);
-  double cosLat = std::cos(lat);
-  double sinLon = std::sin(lon);
-  double cosLon = std::cos(lon);
-  double N = a / std::sqrt(1.0 - e2 * sinLat * sinLat);
-  double X0 = (N + h_origin) * cosLat * cosLon;
-  double Y0 = (N + h_origin) * cosLat * sinLon;
-  double Z0 = ((1.0 - e2) * N + h_origin) * sinLat;
-
-  // 差分ベクトル d = [X - X0, Y - Y0, Z - Z0]
-  double dX = X - X0;
-  double dY = Y - Y0;
-  double dZ = Z - Z0;
-
-  // 回転行列 (ECEF -> ENU)
-  // R =
-  // [ -sin(lon),              cos(lon),             0 ]
-  // [ -sin(lat)*cos(lon),   -sin(lat)*sin(lon),   cos(lat) ]
-  // [  cos(lat)*cos(lon),    cos(lat)*sin(lon),   sin(lat) ]
-  Eigen::Matrix3d R;
-  R(0, 0) = -sinLon;
-  R(0, 1) = cosLon;
-  R(0, 2) = 0.0;
-  R(1, 0) = -sinLat * cosLon;
-  R(1, 1) = -sinLat * sinLon;
-  R(1, 2) = cosLat;
-  R(2, 0) = cosLat * cosLon;
-  R(2, 1) = cosLat * sinLon;
-  R(2, 2) = sinLat;
-
-  // ECEF 差分ベクトル
-  Eigen::Vector3d dVec(dX, dY, dZ);
-
-  // ENU 座標 = R * dVec
-  Eigen::Vector3d enuVec = R * dVec;
-  double E = enuVec(0);
-  double N_val = enuVec(1);
-  double U = enuVec(2);
-
-  // 変換結果として、ENUCoordinate を生成
-  return std::make_unique<trans_geo::coordinate::ENUCoordinate>(E, N_val, U,
-                                                                origin_);
+
+  TRANSGEO_INSTRUMENT_SCOPE(ECEFToENU, Batch,
+                            ecefStates.size() / kStateVectorSize);
+  for (std::size_t i = 0; i < ecefStates.size(); i += kStateVectorSize) {
+    const double* in = ecefStates.data() + i;
+    double* out = enuStates.data() + i;
+    // 上書き変換に備え、書き込み前に 1 点分の入力をすべて読み出す
+    std::array<double, 3> position = frame_.toENU({in[0], in[1], in[2]});
+    std::array<double, 3> velocity = frame_.rotateToENU({in[3], in[4], in[5]});
+    out[0] = position[0];
+    out[1] = position[1];
+    out[2] = position[2];
+    out[3] = velocity[0];
+    out[4] = velocity[1];
+    out[5] = velocity[2];
+  }
+}
+
+const ENUFrame& ECEFToENUConverter::getFrame() const noexcept {
+  return frame_;
+}
+
+const trans_geo::coordinate::OriginHandle& ECEFToENUConverter::getOriginHandle()
+    const noexcept {
+  return originHandle_;
 }
 
-}  // namespace trans_geo::conversion
\ No newline at end of file
+}  // namespace trans_geo::conversion
@@ -1,21 +1,130 @@
 #include "converter/ECEF_to_geo_converter.hpp"
 
-#include <Eigen/Dense>
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <stdexcept>
+#include <utility>
 
+#include "converter/quantized_batch.hpp"  // 量子化入出力の汎用の一括変換
 #include "coordinate/ECEF_coordinate.hpp"  // ECEFCoordinate の定義
 #include "coordinate/geo_coordinate.hpp"   // GeoCoordinate の定義
+#include "instrumentation/instrumentation.hpp"
+#include "kernel/batch_dispatch.hpp"  // batchKernels の定義
+#include "kernel/geodetic.hpp"        // 緯度・楕円体高の計算カーネル
 #include "utils/utils.hpp"
 
 namespace trans_geo::conversion {
+namespace {
+/// 従来の反復法の収束条件
+constexpr double kReferenceTolerance = 1e-12;
+constexpr int kReferenceMaxIterations = 100;
+
+/// Bowring 法を 2 ステップに切り替える高度のしきい値（メートル）
+constexpr double kMillimetreSingleStepLimit = 100e3;
+constexpr double kDecimetreSingleStepLimit = 1000e3;
+
+/// ジオイド高をまとめて補間する点数
+constexpr std::size_t kGeoidBlockSize = 256;
+
+/**
+ * @brief 1 ステップの Bowring 法で足りる地心距離の 2 乗（常に 2 ステップ
+ *        なら負の値）
+ */
+double singleStepRadiusSquared(
+    const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
+    GeodeticPrecision precision) noexcept {
+  if (precision == GeodeticPrecision::Micrometre) {
+    return -1.0;
+  }
+  double limit = precision == GeodeticPrecision::Millimetre
+                     ? kMillimetreSingleStepLimit
+                     : kDecimetreSingleStepLimit;
+  return (ellipsoid.b + limit) * (ellipsoid.b + limit);
+}
+
+/**
+ * @brief 一括変換カーネルが 1 / 2 ステップで解く点数を反復回数として記録する
+ *
+ * ステップ数は地心距離だけで決まるため、計測ビルドでもカーネルを
+ * 置き換えずに入力から数えます（上書き変換に備えてカーネルより前に数える）。
+ * quantization が nullptr でなければ入力を逆量子化して数えます。
+ */
+template <typename T>
+void recordBowringSteps(
+    trans_geo::coordinate::BasicPointView<const T> input,
+    const trans_geo::coordinate::Quantization* quantization,
+    double radiusSquared) noexcept {
+#if defined(TRANSGEO_ENABLE_INSTRUMENTATION)
+  std::uint64_t singleStep = 0;
+  for (std::size_t i = 0; i < input.size(); ++i) {
+    double v[3];
+    for (std::size_t k = 0; k < 3; ++k) {
+      v[k] = quantization == nullptr
+                 ? static_cast<double>(input(i, k))
+                 : trans_geo::coordinate::dequantize(
+                       static_cast<std::int32_t>(input(i, k)),
+                       quantization->scale[k], quantization->offset[k]);
+    }
+    // カーネルと同じ式で判定する
+    double p = std::sqrt(v[0] * v[0] + v[1] * v[1]);
+    singleStep += (p * p + v[2] * v[2]) <= radiusSquared ? 1 : 0;
+  }
+  TRANSGEO_RECORD_LATITUDE_ITERATIONS_N(ECEFToGeo, 1, singleStep);
+  TRANSGEO_RECORD_LATITUDE_ITERATIONS_N(ECEFToGeo, 2,
+                                        input.size() - singleStep);
+#else
+  static_cast<void>(input);
+  static_cast<void>(quantization);
+  static_cast<void>(radiusSquared);
+#endif
+}
+}  // namespace
 
 ECEFToGeoConverter::ECEFToGeoConverter(
     const trans_geo::ellipsoid::Ellipsoid& ellipsoid)
-    : ellipsoid_(ellipsoid) {}
+    : ECEFToGeoConverter(ellipsoid, GeodeticPrecision::Reference) {}
+
+ECEFToGeoConverter::ECEFToGeoConverter(
+    const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
+    GeodeticPrecision precision)
+    : ellipsoid_(ellipsoid),
+      precision_(precision),
+      tolerance_(kReferenceTolerance),
+      maxIterations_(kReferenceMaxIterations) {}
+
+ECEFToGeoConverter::ECEFToGeoConverter(
+    const trans_geo::ellipsoid::Ellipsoid& ellipsoid, double tolerance,
+    int maxIterations)
+    : ellipsoid_(ellipsoid),
+      precision_(GeodeticPrecision::Reference),
+      tolerance_(tolerance),
+      maxIterations_(maxIterations) {
+  if (!(tolerance >= 0.0)) {
+    throw std::invalid_argument(
+        "ECEFToGeoConverter requires a non-negative tolerance.");
+  }
+  if (maxIterations < 1) {
+    throw std::invalid_argument(
+        "ECEFToGeoConverter requires at least one iteration.");
+  }
+}
+
+ECEFToGeoConverter::ECEFToGeoConverter(
+    const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
+    GeodeticPrecision precision,
+    std::shared_ptr<const trans_geo::geoid::GeoidGrid> geoid,
+    trans_geo::geoid::GeoidInterpolation interpolation)
+    : ECEFToGeoConverter(ellipsoid, precision) {
+  geoid_ = std::move(geoid);
+  interpolation_ = interpolation;
+}
 
 std::unique_ptr<trans_geo::interface::ICoordinate> ECEFToGeoConverter::convert(
     const trans_geo::interface::ICoordinate& input) const {
+  TRANSGEO_INSTRUMENT_SCOPE(ECEFToGeo, Convert, 1);
+
   // 入力が ECEFCoordinate であることを確認
   const auto* ecef =
       dynamic_cast<const trans_geo::coordinate::ECEFCoordinate*>(&input);
@@ -25,49 +134,117 @@ std::unique_ptr<trans_geo::interface::ICoordinate> ECEFToGeoConverter::convert(
   }
 
   // ECEF 座標値を取得
-  std::vector<double> ecefValues = ecef->getValues();
-  if (ecefValues.size() != 3) {
-    throw std::invalid_argument("ECEFCoordinate must have exactly 3 values.");
+  std::array<double, 3> ecefValues = ecef->getValueArray();
+  std::array<double, 3> geo =
+      toGeodetic(ecefValues[0], ecefValues[1], ecefValues[2]);
+  if (geoid_) {
+    geo[2] -= geoid_->undulation(geo[0], geo[1], interpolation_);
   }
-  double X = ecefValues[0];
-  double Y = ecefValues[1];
-  double Z = ecefValues[2];
+  return std::make_unique<trans_geo::coordinate::GeoCoordinate>(
+      geo[0], geo[1], geo[2]);
+}
 
-  // 楕円体パラメータ
-  double a = ellipsoid_.a;
-  double e2 = ellipsoid_.e2;
+ConversionStatus ECEFToGeoConverter::convertBatch(
+    trans_geo::coordinate::ConstPointView input,
+    trans_geo::coordinate::PointView output) const noexcept {
+  ConversionStatus status = validateBatch(input, output);
+  if (status != ConversionStatus::Ok) {
+    return status;
+  }
+
+  TRANSGEO_INSTRUMENT_SCOPE(ECEFToGeo, Batch, input.size());
+  if (precision_ != GeodeticPrecision::Reference) {
+    // Bowring 法は CPU に合わせて選んだ一括変換カーネルで計算する
+    double radiusSquared = singleStepRadiusSquared(ellipsoid_, precision_);
+    recordBowringSteps(input, nullptr, radiusSquared);
+    trans_geo::kernel::batchKernels().ecefToGeo(
+        ellipsoid_, radiusSquared,
+        trans_geo::kernel::makeBatchSpan(input, output));
+  } else {
+    for (std::size_t i = 0; i < input.size(); ++i) {
+      std::array<double, 3> ecef = input.get(i);
+      output.set(i, toGeodetic(ecef[0], ecef[1], ecef[2]));
+    }
+  }
+  if (geoid_) {
+    // 出力の緯度・経度からブロックごとにジオイド高を補間して標高に直す
+    std::array<double, kGeoidBlockSize> undulation;
+    for (std::size_t base = 0; base < output.size();
+         base += kGeoidBlockSize) {
+      std::size_t n = std::min(kGeoidBlockSize, output.size() - base);
+      geoid_->undulations(output.subview(base, n), {undulation.data(), n},
+                          interpolation_);
+      for (std::size_t i = 0; i < n; ++i) {
+        output(base + i, 2) -= undulation[i];
+      }
+    }
+  }
+  return ConversionStatus::Ok;
+}
 
+ConversionStatus ECEFToGeoConverter::convertBatchDequantized(
+    trans_geo::coordinate::ConstQuantizedPointView input,
+    const trans_geo::coordinate::Quantization& quantization,
+    trans_geo::coordinate::PointView output) const noexcept {
+  if (precision_ == GeodeticPrecision::Reference || geoid_) {
+    return trans_geo::conversion::convertBatchDequantized(*this, input,
+                                                          quantization, output);
+  }
+  ConversionStatus status = validateBatch(input, quantization, output);
+  if (status != ConversionStatus::Ok) {
+    return status;
+  }
+
+  TRANSGEO_INSTRUMENT_SCOPE(ECEFToGeo, Batch, input.size());
+  double radiusSquared = singleStepRadiusSquared(ellipsoid_, precision_);
+  recordBowringSteps(input, &quantization, radiusSquared);
+  trans_geo::kernel::batchKernels().ecefToGeoDequantized(
+      ellipsoid_, radiusSquared,
+      trans_geo::kernel::makeFixedPointScale(quantization),
+      trans_geo::kernel::makeBatchSpan(input, output));
+  return ConversionStatus::Ok;
+}
+
+std::array<double, 3> ECEFToGeoConverter::toGeodetic(double X, double Y,
+                                                     double Z) const noexcept {
   // 中間変数 p: X-Y 平面上の距離
   double p = std::sqrt(X * X + Y * Y);
 
   // 経度は atan2 で直接求める（ラジアン）
   double lon = std::atan2(Y, X);
 
-  // 初期値として緯度を求める（簡易初期値）
-  double lat = std::atan2(Z, p * (1.0 - e2));
-  double lat_prev = 0.0;
-  int iter = 0, maxIter = 100;
-  constexpr double tol = 1e-12;
-  // 反復法で緯度を収束させる
-  while (std::fabs(lat - lat_prev) > tol && iter < maxIter) {
-    lat_prev = lat;
-    double sinLat = std::sin(lat);
-    double N = a / std::sqrt(1.0 - e2 * sinLat * sinLat);
-    lat = std::atan2(Z + e2 * N * sinLat, p);
-    iter++;
+  double lat = 0.0;
+  double sinLat = 0.0;
+  double cosLat = 1.0;
+  if (precision_ == GeodeticPrecision::Reference) {
+    int iter = trans_geo::kernel::solveLatitudeIterative(
+        ellipsoid_, p, Z, tolerance_, maxIterations_, lat);
+    TRANSGEO_RECORD_LATITUDE_ITERATIONS(ECEFToGeo, iter);
+    sinLat = std::sin(lat);
+    cosLat = std::cos(lat);
+  } else {
+    // 1 ステップで目標精度を満たす高度を超える点のみ 2 ステップ適用する
+    double radiusSquared = singleStepRadiusSquared(ellipsoid_, precision_);
+    int steps = (p * p + Z * Z) <= radiusSquared ? 1 : 2;
+    trans_geo::kernel::solveLatitudeBowring(ellipsoid_, p, Z, steps, sinLat,
+                                            cosLat);
+    TRANSGEO_RECORD_LATITUDE_ITERATIONS(ECEFToGeo, steps);
+    lat = std::atan2(sinLat, cosLat);
   }
-  // 補助量 N の再計算
-  double sinLat = std::sin(lat);
-  double N = a / std::sqrt(1.0 - e2 * sinLat * sinLat);
+
   // 高度 h の計算
-  double h = p / std::cos(lat) - N;
+  double h =
+      trans_geo::kernel::ellipsoidalHeight(ellipsoid_, p, Z, sinLat, cosLat);
 
   // ラジアン -> 度変換
   double lat_deg = trans_geo::utils::radToDeg(lat);
   double lon_deg = trans_geo::utils::radToDeg(lon);
 
-  return std::make_unique<trans_geo::coordinate::GeoCoordinate>(lat_deg,
-                                                                lon_deg, h);
+  return {lat_deg, lon_deg, h};
+}
+
+GeodeticPrecision ECEFToGeoConverter::getPrecision() const noexcept {
+  return precision_;
 }
 
-}  // namespace trans_geo::conversion
\ No newline at end of file
+}  // namespace trans_geo::conversion
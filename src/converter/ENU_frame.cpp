@@ -0,0 +1,49 @@
+#include "converter/ENU_frame.hpp"
+
+#include "kernel/enu.hpp"       // 回転行列の計算カーネル
+#include "kernel/geodetic.hpp"  // geoToEcef の定義
+
+namespace trans_geo::conversion {
+
+ENUFrame::ENUFrame(const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
+                   const trans_geo::coordinate::GeoCoordinate& origin) {
+  // 高度省略時は 0 m
+  double lat = origin.getLatitude();
+  double lon = origin.getLongitude();
+  double h = origin.getAltitude().value_or(0.0);
+
+  // 原点の ECEF 座標と回転行列 (ECEF -> ENU) を一度だけ計算する
+  originEcef_ = trans_geo::kernel::geoToEcef(ellipsoid, lat, lon, h);
+  rotation_ = trans_geo::kernel::enuRotation(lat, lon);
+}
+
+const std::array<double, 3>& ENUFrame::getOriginECEF() const noexcept {
+  return originEcef_;
+}
+
+const std::array<double, 9>& ENUFrame::getRotation() const noexcept {
+  return rotation_;
+}
+
+std::array<double, 3> ENUFrame::toENU(
+    const std::array<double, 3>& ecef) const noexcept {
+  return trans_geo::kernel::ecefToEnu(rotation_, originEcef_, ecef);
+}
+
+std::array<double, 3> ENUFrame::toECEF(
+    const std::array<double, 3>& enu) const noexcept {
+  return trans_geo::kernel::enuToEcef(rotation_, originEcef_, enu);
+}
+
+std::array<double, 3> ENUFrame::rotateToENU(
+    const std::array<double, 3>& v) const noexcept {
+  return trans_geo::kernel::rotateToENU(rotation_, v);
+}
+
+std::array<double, 3> ENUFrame::rotateToECEF(
+    const std::array<double, 3>& v) const noexcept {
+  // ENU → ECEF の変換行列は R^T
+  return trans_geo::kernel::rotateToECEF(rotation_, v);
+}
+
+}  // namespace trans_geo::conversion
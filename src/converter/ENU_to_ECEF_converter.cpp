@@ -1,23 +1,24 @@
 #include "converter/ENU_to_ECEF_converter.hpp"
 
-#include <Eigen/Dense>
-#include <cmath>
 #include <stdexcept>
 
 #include "coordinate/ECEF_coordinate.hpp"  // ECEFCoordinate の定義
 #include "coordinate/ENU_coordinate.hpp"   // ENUCoordinate の定義
 #include "coordinate/geo_coordinate.hpp"   // GeoCoordinate の定義
-#include "utils/utils.hpp"                 // degToRad, etc.
+#include "instrumentation/instrumentation.hpp"
+#include "kernel/batch_dispatch.hpp"  // batchKernels の定義
 
 namespace trans_geo::conversion {
 
 ENUToECEFConverter::ENUToECEFConverter(
     const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
     const trans_geo::coordinate::GeoCoordinate& origin)
-    : ellipsoid_(ellipsoid), origin_(origin) {}
+    : ellipsoid_(ellipsoid), origin_(origin), frame_(ellipsoid, origin) {}
 
 std::unique_ptr<trans_geo::interface::ICoordinate> ENUToECEFConverter::convert(
     const trans_geo::interface::ICoordinate& input) const {
+  TRANSGEO_INSTRUMENT_SCOPE(ENUToECEF, Convert, 1);
+
   // 入力が ENUCoordinate であることを確認
   const auto* enu =
       dynamic_cast<const trans_geo::coordinate::ENUCoordinate*>(&input);
@@ -26,70 +27,105 @@ std::unique_ptr<trans_geo::interface::ICoordinate> ENUToECEFConverter::convert(
         "ENUToECEFConverter::convert expects input to be an ENUCoordinate.");
   }
 
-  // ENU 座標値を取得 (単位: メートル)
-  double E = enu->getEast();
-  double N = enu->getNorth();
-  double U = enu->getUp();
+  // 最終的な ECEF 座標 = 原点の ECEF 座標 + R^T * (ENU)
+  std::array<double, 3> ecef =
+      frame_.toECEF({enu->getEast(), enu->getNorth(), enu->getUp()});
+
+  return std::make_unique<trans_geo::coordinate::ECEFCoordinate>(
+      ecef[0], ecef[1], ecef[2]);
+}
+
+ConversionStatus ENUToECEFConverter::convertBatch(
+    trans_geo::coordinate::ConstPointView input,
+    trans_geo::coordinate::PointView output) const noexcept {
+  ConversionStatus status = validateBatch(input, output);
+  if (status != ConversionStatus::Ok) {
+    return status;
+  }
+
+  TRANSGEO_INSTRUMENT_SCOPE(ENUToECEF, Batch, input.size());
+  trans_geo::kernel::batchKernels().enuToEcef(
+      frame_.getRotation().data(), frame_.getOriginECEF().data(),
+      trans_geo::kernel::makeBatchSpan(input, output));
+  return ConversionStatus::Ok;
+}
+
+ConversionStatus ENUToECEFConverter::convertBatchQuantized(
+    trans_geo::coordinate::ConstPointView input,
+    trans_geo::coordinate::QuantizedPointView output,
+    const trans_geo::coordinate::Quantization& quantization) const noexcept {
+  ConversionStatus status = validateBatch(input, output, quantization);
+  if (status != ConversionStatus::Ok) {
+    return status;
+  }
+
+  TRANSGEO_INSTRUMENT_SCOPE(ENUToECEF, Batch, input.size());
+  std::size_t saturated = trans_geo::kernel::batchKernels().enuToEcefQuantized(
+      frame_.getRotation().data(), frame_.getOriginECEF().data(),
+      trans_geo::kernel::makeFixedPointScale(quantization),
+      trans_geo::kernel::makeBatchSpan(input, output));
+  return saturated == 0 ? ConversionStatus::Ok : ConversionStatus::Saturated;
+}
+
+ConversionStatus ENUToECEFConverter::convertBatchDequantized(
+    trans_geo::coordinate::ConstQuantizedPointView input,
+    const trans_geo::coordinate::Quantization& quantization,
+    trans_geo::coordinate::PointView output) const noexcept {
+  ConversionStatus status = validateBatch(input, quantization, output);
+  if (status != ConversionStatus::Ok) {
+    return status;
+  }
 
-  // 原点の GeoCoordinate から値を取得（緯度・経度は度、標高はメートル）
-  std::vector<double> geoValues = origin_.getValues();
-  if (geoValues.size() < 2) {
+  TRANSGEO_INSTRUMENT_SCOPE(ENUToECEF, Batch, input.size());
+  trans_geo::kernel::batchKernels().enuToEcefDequantized(
+      frame_.getRotation().data(), frame_.getOriginECEF().data(),
+      trans_geo::kernel::makeFixedPointScale(quantization),
+      trans_geo::kernel::makeBatchSpan(input, output));
+  return ConversionStatus::Ok;
+}
+
+std::array<double, 3> ENUToECEFConverter::convertVelocity(
+    const std::array<double, 3>& enuVelocity) const noexcept {
+  return frame_.rotateToECEF(enuVelocity);
+}
+
+std::array<double, 3> ENUToECEFConverter::convertAcceleration(
+    const std::array<double, 3>& enuAcceleration) const noexcept {
+  return frame_.rotateToECEF(enuAcceleration);
+}
+
+void ENUToECEFConverter::convertStates(std::span<const double> enuStates,
+                                       std::span<double> ecefStates) const {
+  if (enuStates.size() % kStateVectorSize != 0) {
     throw std::invalid_argument(
-        "Origin GeoCoordinate does not contain enough values.");
+        "ENUToECEFConverter::convertStates expects a multiple of 6 values.");
   }
-  double lat_deg = geoValues[0];
-  double lon_deg = geoValues[1];
-  double h_origin = (geoValues.size() == 3) ? geoValues[2] : 0.0;
-
-  // 緯度・経度をラジアンに変換
-  double lat = trans_geo::utils::degToRad(lat_deg);
-  double lon = trans_geo::utils::degToRad(lon_deg);
-
-  // 楕円体モデルパラメータ
-  double a = ellipsoid_.a;
-  double e2 = ellipsoid_.e2;
-
-  // 原点の ECEF 座標を計算（Geo → ECEF）
-  double sinLat = std::sin(lat);
-  double cosLat = std::cos(lat);
-  double sinLon = std::sin(lon);
-  double cosLon = std::cos(lon);
-  double N_val = a / std::sqrt(1.0 - e2 * sinLat * sinLat);
-  double X0 = (N_val + h_origin) * cosLat * cosLon;
-  double Y0 = (N_val + h_origin) * cosLat * sinLon;
-  double Z0 = ((1.0 - e2) * N_val + h_origin) * sinLat;
-
-  // ENU → ECEF の変換のため、原点の緯度・経度から回転行列を構成する
-  // ECEF_to_ENU の回転行列 R は下記の通り:
-  // [ -sin(lon),              cos(lon),              0 ]
-  // [ -sin(lat)*cos(lon),  -sin(lat)*sin(lon),   cos(lat) ]
-  // [  cos(lat)*cos(lon),   cos(lat)*sin(lon),   sin(lat) ]
-  // その転置 R^T が ENU → ECEF 変換行列となる
-  Eigen::Matrix3d R;
-  R(0, 0) = -sinLon;
-  R(0, 1) = -sin(lat) * cosLon;
-  R(0, 2) = cos(lat) * cosLon;
-  R(1, 0) = cosLon;
-  R(1, 1) = -sin(lat) * sinLon;
-  R(1, 2) = cos(lat) * sinLon;
-  R(2, 0) = 0.0;
-  R(2, 1) = cos(lat);
-  R(2, 2) = sin(lat);
-
-  // ENU → ECEF の変換行列は R^T
-  Eigen::Matrix3d R_transpose = R.transpose();
-
-  // ENU 座標ベクトル
-  Eigen::Vector3d enuVec(E, N, U);
-  // ECEF 偏差ベクトル = R^T * (ENU)
-  Eigen::Vector3d delta = R_transpose * enuVec;
-
-  // 最終的な ECEF 座標 = 原点の ECEF 座標 + delta
-  double X = X0 + delta(0);
-  double Y = Y0 + delta(1);
-  double Z = Z0 + delta(2);
-
-  return std::make_unique<trans_geo::coordinate::ECEFCoordinate>(X, Y, Z);
+  if (enuStates.size() != ecefStates.size()) {
+    throw std::invalid_argument(
+        "ENUToECEFConverter::convertStates requires input and output of the "
+        "same size.");
+  }
+
+  TRANSGEO_INSTRUMENT_SCOPE(ENUToECEF, Batch,
+                            enuStates.size() / kStateVectorSize);
+  for (std::size_t i = 0; i < enuStates.size(); i += kStateVectorSize) {
+    const double* in = enuStates.data() + i;
+    double* out = ecefStates.data() + i;
+    // 上書き変換に備え、書き込み前に 1 点分の入力をすべて読み出す
+    std::array<double, 3> position = frame_.toECEF({in[0], in[1], in[2]});
+    std::array<double, 3> velocity =
+        frame_.rotateToECEF({in[3], in[4], in[5]});
+    out[0] = position[0];
+    out[1] = position[1];
+    out[2] = position[2];
+    out[3] = velocity[0];
+    out[4] = velocity[1];
+    out[5] = velocity[2];
+  }
+}
+
+const ENUFrame& ENUToECEFConverter::getFrame() const noexcept {
+  return frame_;
 }
 
 }  // namespace trans_geo::conversion
@@ -1,11 +1,13 @@
 #include "converter/ENU_to_geo_converter.hpp"
 
 #include <stdexcept>
+#include <utility>
 
 #include "converter/ECEF_to_geo_converter.hpp"  // ECEFToGeoConverter の定義
 #include "converter/ENU_to_ECEF_converter.hpp"  // ENUToECEFConverter の定義
 #include "coordinate/ENU_coordinate.hpp"        // ENUCoordinate の定義
 #include "coordinate/geo_coordinate.hpp"        // GeoCoordinate の定義
+#include "instrumentation/instrumentation.hpp"
 
 namespace trans_geo::conversion {
 
@@ -19,8 +21,22 @@ ENUToGeoConverter::ENUToGeoConverter(
   ecefToGeoConverter_ = std::make_unique<ECEFToGeoConverter>(ellipsoid_);
 }
 
+ENUToGeoConverter::ENUToGeoConverter(
+    const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
+    const trans_geo::coordinate::GeoCoordinate& origin,
+    std::shared_ptr<const trans_geo::geoid::GeoidGrid> geoid,
+    trans_geo::geoid::GeoidInterpolation interpolation)
+    : ENUToGeoConverter(ellipsoid, origin) {
+  // ECEF→Geo の段だけ標高を出力する変換器に差し替える
+  ecefToGeoConverter_ = std::make_unique<ECEFToGeoConverter>(
+      ellipsoid_, GeodeticPrecision::Reference, std::move(geoid),
+      interpolation);
+}
+
 std::unique_ptr<trans_geo::interface::ICoordinate> ENUToGeoConverter::convert(
     const trans_geo::interface::ICoordinate& input) const {
+  TRANSGEO_INSTRUMENT_SCOPE(ENUToGeo, Convert, 1);
+
   // 入力が ENUCoordinate であることを確認
   const auto* enu =
       dynamic_cast<const trans_geo::coordinate::ENUCoordinate*>(&input);
@@ -35,4 +51,19 @@ std::unique_ptr<trans_geo::interface::ICoordinate> ENUToGeoConverter::convert(
   return geoCoord;
 }
 
+ConversionStatus ENUToGeoConverter::convertBatch(
+    trans_geo::coordinate::ConstPointView input,
+    trans_geo::coordinate::PointView output) const noexcept {
+  ConversionStatus status = validateBatch(input, output);
+  if (status != ConversionStatus::Ok) {
+    return status;
+  }
+
+  TRANSGEO_INSTRUMENT_SCOPE(ENUToGeo, Batch, input.size());
+  // 中間の ECEF 座標は出力領域に書き込み、そのまま上書き変換する
+  enuToEcefConverter_->convertBatch(input, output);
+  ecefToGeoConverter_->convertBatch(output, output);
+  return ConversionStatus::Ok;
+}
+
 }  // namespace trans_geo::conversion
\ No newline at end of file
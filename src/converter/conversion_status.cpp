@@ -0,0 +1,76 @@
+#include "converter/conversion_status.hpp"
+
+namespace trans_geo::conversion {
+
+const char* toString(ConversionStatus status) noexcept {
+  switch (status) {
+    case ConversionStatus::Ok:
+      return "Ok";
+    case ConversionStatus::SizeMismatch:
+      return "SizeMismatch";
+    case ConversionStatus::NullBuffer:
+      return "NullBuffer";
+    case ConversionStatus::InvalidStride:
+      return "InvalidStride";
+    case ConversionStatus::InvalidQuantization:
+      return "InvalidQuantization";
+    case ConversionStatus::Saturated:
+      return "Saturated";
+  }
+  return "Unknown";
+}
+
+namespace {
+/**
+ * @brief 要素型によらない入出力ビューの検証
+ */
+template <typename In, typename Out>
+ConversionStatus validateViews(
+    trans_geo::coordinate::BasicPointView<In> input,
+    trans_geo::coordinate::BasicPointView<Out> output) noexcept {
+  if (input.size() != output.size()) {
+    return ConversionStatus::SizeMismatch;
+  }
+  if (input.size() == 0) {
+    return ConversionStatus::Ok;
+  }
+  if (!input.hasData() || !output.hasData()) {
+    return ConversionStatus::NullBuffer;
+  }
+  // 1 点のみの場合は間隔を参照しない
+  if (input.size() > 1 && (input.stride() == 0 || output.stride() == 0)) {
+    return ConversionStatus::InvalidStride;
+  }
+  return ConversionStatus::Ok;
+}
+}  // namespace
+
+ConversionStatus validateBatch(
+    trans_geo::coordinate::ConstPointView input,
+    trans_geo::coordinate::PointView output) noexcept {
+  return validateViews(input, output);
+}
+
+ConversionStatus validateBatch(
+    trans_geo::coordinate::ConstPointView input,
+    trans_geo::coordinate::QuantizedPointView output,
+    const trans_geo::coordinate::Quantization& quantization) noexcept {
+  ConversionStatus status = validateViews(input, output);
+  if (status == ConversionStatus::Ok && !quantization.isValid()) {
+    return ConversionStatus::InvalidQuantization;
+  }
+  return status;
+}
+
+ConversionStatus validateBatch(
+    trans_geo::coordinate::ConstQuantizedPointView input,
+    const trans_geo::coordinate::Quantization& quantization,
+    trans_geo::coordinate::PointView output) noexcept {
+  ConversionStatus status = validateViews(input, output);
+  if (status == ConversionStatus::Ok && !quantization.isValid()) {
+    return ConversionStatus::InvalidQuantization;
+  }
+  return status;
+}
+
+}  // namespace trans_geo::conversion
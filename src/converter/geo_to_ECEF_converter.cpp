@@ -1,21 +1,39 @@
 #include "converter/geo_to_ECEF_converter.hpp"
 
-#include <Eigen/Dense>
-#include <cmath>
+#include <algorithm>
+#include <array>
 #include <stdexcept>
+#include <utility>
 
+#include "converter/quantized_batch.hpp"  // 量子化入出力の汎用の一括変換
 #include "coordinate/ECEF_coordinate.hpp"  // ECEFCoordinate の定義
 #include "coordinate/geo_coordinate.hpp"   // GeoCoordinate の定義
-#include "utils/utils.hpp"
+#include "instrumentation/instrumentation.hpp"
+#include "kernel/batch_dispatch.hpp"  // batchKernels の定義
+#include "kernel/geodetic.hpp"        // geoToEcef の定義
 
 namespace trans_geo::conversion {
+namespace {
+/// ジオイド高をまとめて補間する点数
+constexpr std::size_t kGeoidBlockSize = 256;
+}  // namespace
 
 GeoToECEFConverter::GeoToECEFConverter(
     const trans_geo::ellipsoid::Ellipsoid& ellipsoid)
     : ellipsoid_(ellipsoid) {}
 
+GeoToECEFConverter::GeoToECEFConverter(
+    const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
+    std::shared_ptr<const trans_geo::geoid::GeoidGrid> geoid,
+    trans_geo::geoid::GeoidInterpolation interpolation)
+    : ellipsoid_(ellipsoid),
+      geoid_(std::move(geoid)),
+      interpolation_(interpolation) {}
+
 std::unique_ptr<trans_geo::interface::ICoordinate> GeoToECEFConverter::convert(
     const trans_geo::interface::ICoordinate& input) const {
+  TRANSGEO_INSTRUMENT_SCOPE(GeoToECEF, Convert, 1);
+
   // 入力が GeoCoordinate であることを確認
   const auto* geo =
       dynamic_cast<const trans_geo::coordinate::GeoCoordinate*>(&input);
@@ -26,30 +44,70 @@ std::unique_ptr<trans_geo::interface::ICoordinate> GeoToECEFConverter::convert(
 
   // GeoCoordinate から値を取得（単位:
   // 緯度・経度は度、オプションの高度はメートル）
-  std::vector<double> geoValues = geo->getValues();
-  double lat_deg = geoValues[0];
-  double lon_deg = geoValues[1];
-  double h = (geoValues.size() == 3) ? geoValues[2] : 0.0;
-
-  // 度 -> ラジアン変換
-  double lat = trans_geo::utils::degToRad(lat_deg);
-  double lon = trans_geo::utils::degToRad(lon_deg);
-
-  // 楕円体モデルパラメータ
-  double a = ellipsoid_.a;
-  double e2 = ellipsoid_.e2;
-
-  // 補助量 N (prime vertical radius of curvature)
-  double sinLat = std::sin(lat);
-  double cosLat = std::cos(lat);
-  double N_val = trans_geo::utils::calcN(a, e2, lat);
-
-  // ECEF 座標計算
-  double x = (N_val + h) * cosLat * std::cos(lon);
-  double y = (N_val + h) * cosLat * std::sin(lon);
-  double z = ((1.0 - e2) * N_val + h) * sinLat;
-
-  return std::make_unique<trans_geo::coordinate::ECEFCoordinate>(x, y, z);
+  // 高度なしの場合、3 要素目は 0 となる
+  std::array<double, 3> geoValues = geo->getValueArray();
+  if (geoid_) {
+    geoValues[2] +=
+        geoid_->undulation(geoValues[0], geoValues[1], interpolation_);
+  }
+  std::array<double, 3> ecef =
+      trans_geo::kernel::geoToEcef(ellipsoid_, geoValues[0], geoValues[1],
+                                   geoValues[2]);
+  return std::make_unique<trans_geo::coordinate::ECEFCoordinate>(
+      ecef[0], ecef[1], ecef[2]);
+}
+
+ConversionStatus GeoToECEFConverter::convertBatch(
+    trans_geo::coordinate::ConstPointView input,
+    trans_geo::coordinate::PointView output) const noexcept {
+  ConversionStatus status = validateBatch(input, output);
+  if (status != ConversionStatus::Ok) {
+    return status;
+  }
+
+  TRANSGEO_INSTRUMENT_SCOPE(GeoToECEF, Batch, input.size());
+  if (!geoid_) {
+    // CPU に合わせて選んだ一括変換カーネルで計算する
+    trans_geo::kernel::batchKernels().geoToEcef(
+        ellipsoid_, trans_geo::kernel::makeBatchSpan(input, output));
+    return ConversionStatus::Ok;
+  }
+
+  // ブロックごとにジオイド高をまとめて補間してから変換する（上書き変換でも
+  // 補間はそのブロックの入力を書き換える前に終わる）
+  std::array<double, kGeoidBlockSize> undulation;
+  for (std::size_t base = 0; base < input.size(); base += kGeoidBlockSize) {
+    std::size_t n = std::min(kGeoidBlockSize, input.size() - base);
+    geoid_->undulations(input.subview(base, n), {undulation.data(), n},
+                        interpolation_);
+    for (std::size_t i = 0; i < n; ++i) {
+      std::array<double, 3> geo = input.get(base + i);
+      output.set(base + i,
+                 trans_geo::kernel::geoToEcef(ellipsoid_, geo[0], geo[1],
+                                              geo[2] + undulation[i]));
+    }
+  }
+  return ConversionStatus::Ok;
+}
+
+ConversionStatus GeoToECEFConverter::convertBatchQuantized(
+    trans_geo::coordinate::ConstPointView input,
+    trans_geo::coordinate::QuantizedPointView output,
+    const trans_geo::coordinate::Quantization& quantization) const noexcept {
+  if (geoid_) {
+    return trans_geo::conversion::convertBatchQuantized(*this, input, output,
+                                                        quantization);
+  }
+  ConversionStatus status = validateBatch(input, output, quantization);
+  if (status != ConversionStatus::Ok) {
+    return status;
+  }
+
+  TRANSGEO_INSTRUMENT_SCOPE(GeoToECEF, Batch, input.size());
+  std::size_t saturated = trans_geo::kernel::batchKernels().geoToEcefQuantized(
+      ellipsoid_, trans_geo::kernel::makeFixedPointScale(quantization),
+      trans_geo::kernel::makeBatchSpan(input, output));
+  return saturated == 0 ? ConversionStatus::Ok : ConversionStatus::Saturated;
 }
 
-}  // namespace trans_geo::conversion
\ No newline at end of file
+}  // namespace trans_geo::conversion
@@ -1,10 +1,12 @@
 #include "converter/Geo_to_ENU_converter.hpp"
 
 #include <stdexcept>
+#include <utility>
 
 #include "converter/ECEF_to_ENU_converter.hpp"  // ECEFToENUConverter の定義
 #include "converter/Geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
 #include "coordinate/geo_coordinate.hpp"
+#include "instrumentation/instrumentation.hpp"
 
 namespace trans_geo::conversion {
 
@@ -18,8 +20,21 @@ GeoToENUConverter::GeoToENUConverter(
       std::make_unique<ECEFToENUConverter>(ellipsoid_, origin_);
 }
 
+GeoToENUConverter::GeoToENUConverter(
+    const trans_geo::ellipsoid::Ellipsoid& ellipsoid,
+    const trans_geo::coordinate::GeoCoordinate& origin,
+    std::shared_ptr<const trans_geo::geoid::GeoidGrid> geoid,
+    trans_geo::geoid::GeoidInterpolation interpolation)
+    : GeoToENUConverter(ellipsoid, origin) {
+  // Geo→ECEF の段だけ標高を扱う変換器に差し替える
+  geoToEcefConverter_ = std::make_unique<GeoToECEFConverter>(
+      ellipsoid_, std::move(geoid), interpolation);
+}
+
 std::unique_ptr<trans_geo::interface::ICoordinate> GeoToENUConverter::convert(
     const trans_geo::interface::ICoordinate& input) const {
+  TRANSGEO_INSTRUMENT_SCOPE(GeoToENU, Convert, 1);
+
   // 入力が GeoCoordinate であることを確認
   const auto* geo =
       dynamic_cast<const trans_geo::coordinate::GeoCoordinate*>(&input);
@@ -34,4 +49,19 @@ std::unique_ptr<trans_geo::interface::ICoordinate> GeoToENUConverter::convert(
   return enuCoord;
 }
 
+ConversionStatus GeoToENUConverter::convertBatch(
+    trans_geo::coordinate::ConstPointView input,
+    trans_geo::coordinate::PointView output) const noexcept {
+  ConversionStatus status = validateBatch(input, output);
+  if (status != ConversionStatus::Ok) {
+    return status;
+  }
+
+  TRANSGEO_INSTRUMENT_SCOPE(GeoToENU, Batch, input.size());
+  // 中間の ECEF 座標は出力領域に書き込み、そのまま上書き変換する
+  geoToEcefConverter_->convertBatch(input, output);
+  ecefToEnuConverter_->convertBatch(output, output);
+  return ConversionStatus::Ok;
+}
+
 }  // namespace trans_geo::conversion
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include "converter/quantized_batch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+namespace trans_geo::conversion {
+namespace {
+/// 中間の double 配列の点数（3 成分で 6 KiB）
+constexpr std::size_t kBlockSize = 256;
+}  // namespace
+
+ConversionStatus convertBatchQuantized(
+    const ICoordinateConverter& converter,
+    trans_geo::coordinate::ConstPointView input,
+    trans_geo::coordinate::QuantizedPointView output,
+    const trans_geo::coordinate::Quantization& quantization) noexcept {
+  ConversionStatus status = validateBatch(input, output, quantization);
+  if (status != ConversionStatus::Ok) {
+    return status;
+  }
+
+  std::array<double, 3 * kBlockSize> block;
+  bool saturated = false;
+  for (std::size_t base = 0; base < input.size(); base += kBlockSize) {
+    std::size_t n = std::min(kBlockSize, input.size() - base);
+    trans_geo::coordinate::PointView converted =
+        trans_geo::coordinate::PointView::columns(
+            block.data(), block.data() + kBlockSize,
+            block.data() + 2 * kBlockSize, n);
+    status = converter.convertBatch(input.subview(base, n), converted);
+    if (status != ConversionStatus::Ok) {
+      return status;
+    }
+    for (std::size_t k = 0; k < 3; ++k) {
+      for (std::size_t i = 0; i < n; ++i) {
+        output(base + i, k) = trans_geo::coordinate::quantize(
+            converted(i, k), quantization.scale[k], quantization.offset[k],
+            saturated);
+      }
+    }
+  }
+  return saturated ? ConversionStatus::Saturated : ConversionStatus::Ok;
+}
+
+ConversionStatus convertBatchDequantized(
+    const ICoordinateConverter& converter,
+    trans_geo::coordinate::ConstQuantizedPointView input,
+    const trans_geo::coordinate::Quantization& quantization,
+    trans_geo::coordinate::PointView output) noexcept {
+  ConversionStatus status = validateBatch(input, quantization, output);
+  if (status != ConversionStatus::Ok) {
+    return status;
+  }
+
+  std::array<double, 3 * kBlockSize> block;
+  for (std::size_t base = 0; base < input.size(); base += kBlockSize) {
+    std::size_t n = std::min(kBlockSize, input.size() - base);
+    trans_geo::coordinate::PointView restored =
+        trans_geo::coordinate::PointView::columns(
+            block.data(), block.data() + kBlockSize,
+            block.data() + 2 * kBlockSize, n);
+    for (std::size_t k = 0; k < 3; ++k) {
+      for (std::size_t i = 0; i < n; ++i) {
+        restored(i, k) = trans_geo::coordinate::dequantize(
+            input(base + i, k), quantization.scale[k], quantization.offset[k]);
+      }
+    }
+    status = converter.convertBatch(restored, output.subview(base, n));
+    if (status != ConversionStatus::Ok) {
+      return status;
+    }
+  }
+  return ConversionStatus::Ok;
+}
+
+}  // namespace trans_geo::conversion
@@ -0,0 +1,286 @@
+#include "converter/tiled_ENU_frames.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "kernel/enu.hpp"       // ecefToEnu / enuToEcef の定義
+#include "kernel/geodetic.hpp"  // geoToEcef の定義
+#include "utils/utils.hpp"      // degToRad, radToDeg
+
+namespace trans_geo::conversion {
+namespace {
+using trans_geo::coordinate::ConstPointView;
+using trans_geo::coordinate::PointView;
+
+/// 割り切れる大きさで行数・列数が 1 つ増えないための許容誤差
+constexpr double kCountTolerance = 1e-9;
+
+/**
+ * @brief 入力ビューを検証する（validateBatch() の入力側と同じ規則）
+ */
+ConversionStatus validateInput(ConstPointView input) noexcept {
+  if (input.size() == 0) {
+    return ConversionStatus::Ok;
+  }
+  if (!input.hasData()) {
+    return ConversionStatus::NullBuffer;
+  }
+  if (input.size() > 1 && input.stride() == 0) {
+    return ConversionStatus::InvalidStride;
+  }
+  return ConversionStatus::Ok;
+}
+
+/**
+ * @brief 長さ span の区間を tileSize 刻みで区切った区画の数
+ */
+std::size_t cellCount(double span, double tileSize) {
+  return static_cast<std::size_t>(std::ceil(span / tileSize - kCountTolerance));
+}
+
+/**
+ * @brief 区間の第 index 区画の中心（端の区画は区間内に収める）
+ */
+double cellCenter(double begin, double end, double tileSize,
+                  std::size_t index) {
+  double low = begin + static_cast<double>(index) * tileSize;
+  double high = std::min(end, low + tileSize);
+  return 0.5 * (low + high);
+}
+
+/**
+ * @brief タイル番号の昇順に並べた入力の番号を求める（安定な基数ソート）
+ *
+ * 16 bit ずつ 2 回の計数ソートで、比較ソートより少ないメモリアクセスで
+ * 並べ替えます。同じタイルの点は入力順のまま並びます。
+ */
+void sortByTile(const std::vector<std::uint32_t>& tileIds,
+                std::vector<std::uint32_t>& order) {
+  constexpr std::size_t kBuckets = std::size_t{1} << 16;
+  std::size_t n = tileIds.size();
+  std::vector<std::uint32_t> scratch(n);
+  std::vector<std::size_t> counts(kBuckets);
+  order.resize(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    scratch[i] = static_cast<std::uint32_t>(i);
+  }
+  for (unsigned shift : {0u, 16u}) {
+    std::fill(counts.begin(), counts.end(), 0);
+    for (std::uint32_t tile : tileIds) {
+      ++counts[(tile >> shift) & (kBuckets - 1)];
+    }
+    std::size_t offset = 0;
+    for (std::size_t& count : counts) {
+      std::size_t next = offset + count;
+      count = offset;
+      offset = next;
+    }
+    for (std::uint32_t index : scratch) {
+      order[counts[(tileIds[index] >> shift) & (kBuckets - 1)]++] = index;
+    }
+    scratch.swap(order);
+  }
+  order.swap(scratch);
+}
+}  // namespace
+
+TiledENUFrames::TiledENUFrames(
+    const trans_geo::ellipsoid::Ellipsoid& ellipsoid, double tileSizeDeg)
+    : ellipsoid_(ellipsoid),
+      tileSize_(tileSizeDeg),
+      inverseTileSize_(1.0 / tileSizeDeg) {
+  if (!(tileSizeDeg > 0.0 && tileSizeDeg <= 90.0)) {
+    throw std::invalid_argument(
+        "TiledENUFrames::TiledENUFrames tileSizeDeg must be in (0, 90]");
+  }
+  rows_ = cellCount(180.0, tileSizeDeg);
+  columns_ = cellCount(360.0, tileSizeDeg);
+  if (rows_ * columns_ > std::numeric_limits<std::uint32_t>::max()) {
+    throw std::invalid_argument(
+        "TiledENUFrames::TiledENUFrames too many tiles");
+  }
+
+  // 行・列ごとの三角関数を一度だけ計算する（ENUFrame と同じ式）
+  rowCenter_.resize(rows_);
+  rowTerms_.resize(rows_);
+  for (std::size_t r = 0; r < rows_; ++r) {
+    rowCenter_[r] = cellCenter(-90.0, 90.0, tileSizeDeg, r);
+    double lat = trans_geo::utils::degToRad(rowCenter_[r]);
+    double sinLat = std::sin(lat);
+    double N = ellipsoid.a / std::sqrt(1.0 - ellipsoid.e2 * sinLat * sinLat);
+    rowTerms_[r] = {sinLat, std::cos(lat), N};
+  }
+  columnCenter_.resize(columns_);
+  columnTerms_.resize(columns_);
+  for (std::size_t c = 0; c < columns_; ++c) {
+    columnCenter_[c] = cellCenter(-180.0, 180.0, tileSizeDeg, c);
+    double lon = trans_geo::utils::degToRad(columnCenter_[c]);
+    columnTerms_[c] = {std::sin(lon), std::cos(lon)};
+  }
+}
+
+double TiledENUFrames::getTileSize() const noexcept { return tileSize_; }
+
+std::size_t TiledENUFrames::getRowCount() const noexcept { return rows_; }
+
+std::size_t TiledENUFrames::getColumnCount() const noexcept {
+  return columns_;
+}
+
+std::uint32_t TiledENUFrames::tileOf(double latDeg,
+                                     double lonDeg) const noexcept {
+  // 整数への変換が未定義動作にならないよう、有限値だけを扱う
+  if (!std::isfinite(latDeg) || !std::isfinite(lonDeg)) {
+    return 0;
+  }
+  double lat = std::clamp(latDeg, -90.0, 90.0);
+  // 非常に大きな経度では正規化の丸め誤差が残るため、範囲にも丸める
+  double lon = std::clamp(
+      lonDeg - 360.0 * std::floor((lonDeg + 180.0) / 360.0), -180.0, 180.0);
+  std::size_t row = std::min(
+      rows_ - 1, static_cast<std::size_t>((lat + 90.0) * inverseTileSize_));
+  std::size_t column =
+      std::min(columns_ - 1,
+               static_cast<std::size_t>((lon + 180.0) * inverseTileSize_));
+  return static_cast<std::uint32_t>(row * columns_ + column);
+}
+
+trans_geo::coordinate::GeoCoordinate TiledENUFrames::getTileOrigin(
+    std::uint32_t tile) const {
+  if (tile >= rows_ * columns_) {
+    throw std::out_of_range(
+        "TiledENUFrames::getTileOrigin tile out of range");
+  }
+  return trans_geo::coordinate::GeoCoordinate(rowCenter_[tile / columns_],
+                                              columnCenter_[tile % columns_],
+                                              0.0);
+}
+
+TileFrame TiledENUFrames::getTileFrame(std::uint32_t tile) const noexcept {
+  const auto& [sinLat, cosLat, N] = rowTerms_[tile / columns_];
+  const auto& [sinLon, cosLon] = columnTerms_[tile % columns_];
+  TileFrame frame;
+  frame.originEcef = {N * cosLat * cosLon, N * cosLat * sinLon,
+                      ellipsoid_.oneMinusE2 * N * sinLat};
+  frame.rotation = {-sinLon,          cosLon,           0.0,
+                    -sinLat * cosLon, -sinLat * sinLon, cosLat,
+                    cosLat * cosLon,  cosLat * sinLon,  sinLat};
+  return frame;
+}
+
+template <typename ToEcef>
+void TiledENUFrames::convertGrouped(ConstPointView input,
+                                    const std::vector<std::uint32_t>& tileIds,
+                                    ToEcef toEcef,
+                                    TiledENUBatch& output) const {
+  std::size_t n = input.size();
+
+  sortByTile(tileIds, output.order);
+  output.tiles.clear();
+  output.offsets.clear();
+  for (auto& component : output.enu) component.resize(n);
+  for (std::size_t j = 0; j < n; ++j) {
+    std::uint32_t tile = tileIds[output.order[j]];
+    if (output.tiles.empty() || output.tiles.back() != tile) {
+      output.tiles.push_back(tile);
+      output.offsets.push_back(j);
+    }
+  }
+  output.offsets.push_back(n);
+
+  float* east = output.enu[0].data();
+  float* north = output.enu[1].data();
+  float* up = output.enu[2].data();
+  for (std::size_t g = 0; g < output.tiles.size(); ++g) {
+    TileFrame frame = getTileFrame(output.tiles[g]);
+    for (std::size_t j = output.offsets[g]; j < output.offsets[g + 1]; ++j) {
+      std::array<double, 3> enu = trans_geo::kernel::ecefToEnu(
+          frame.rotation, frame.originEcef, toEcef(input.get(output.order[j])));
+      east[j] = static_cast<float>(enu[0]);
+      north[j] = static_cast<float>(enu[1]);
+      up[j] = static_cast<float>(enu[2]);
+    }
+  }
+}
+
+ConversionStatus TiledENUFrames::fromGeo(ConstPointView geo,
+                                         TiledENUBatch& output) const {
+  ConversionStatus status = validateInput(geo);
+  if (status != ConversionStatus::Ok) {
+    return status;
+  }
+  if (geo.size() > std::numeric_limits<std::uint32_t>::max()) {
+    throw std::invalid_argument("TiledENUFrames::fromGeo too many points");
+  }
+  std::vector<std::uint32_t> tileIds(geo.size());
+  for (std::size_t i = 0; i < geo.size(); ++i) {
+    tileIds[i] = tileOf(geo(i, 0), geo(i, 1));
+  }
+  const trans_geo::ellipsoid::Ellipsoid& ellipsoid = ellipsoid_;
+  convertGrouped(
+      geo, tileIds,
+      [&ellipsoid](const std::array<double, 3>& p) {
+        return trans_geo::kernel::geoToEcef(ellipsoid, p[0], p[1], p[2]);
+      },
+      output);
+  return ConversionStatus::Ok;
+}
+
+ConversionStatus TiledENUFrames::fromECEF(ConstPointView ecef,
+                                          TiledENUBatch& output) const {
+  ConversionStatus status = validateInput(ecef);
+  if (status != ConversionStatus::Ok) {
+    return status;
+  }
+  if (ecef.size() > std::numeric_limits<std::uint32_t>::max()) {
+    throw std::invalid_argument("TiledENUFrames::fromECEF too many points");
+  }
+  // タイルの判定には楕円体面上の点としての緯度で十分（高度 10 km でも
+  // 真の測地緯度との差は 0.001° 未満）
+  double scale = 1.0 / ellipsoid_.oneMinusE2;
+  std::vector<std::uint32_t> tileIds(ecef.size());
+  for (std::size_t i = 0; i < ecef.size(); ++i) {
+    double X = ecef(i, 0);
+    double Y = ecef(i, 1);
+    double p = std::sqrt(X * X + Y * Y);
+    double lat = std::atan2(ecef(i, 2) * scale, p);
+    double lon = std::atan2(Y, X);
+    tileIds[i] = tileOf(trans_geo::utils::radToDeg(lat),
+                        trans_geo::utils::radToDeg(lon));
+  }
+  convertGrouped(
+      ecef, tileIds, [](const std::array<double, 3>& p) { return p; }, output);
+  return ConversionStatus::Ok;
+}
+
+ConversionStatus TiledENUFrames::toECEF(const TiledENUBatch& batch,
+                                        PointView output) const noexcept {
+  if (batch.size() != output.size()) {
+    return ConversionStatus::SizeMismatch;
+  }
+  if (batch.size() == 0) {
+    return ConversionStatus::Ok;
+  }
+  if (!output.hasData()) {
+    return ConversionStatus::NullBuffer;
+  }
+  if (output.size() > 1 && output.stride() == 0) {
+    return ConversionStatus::InvalidStride;
+  }
+  for (std::size_t g = 0; g < batch.groupCount(); ++g) {
+    TileFrame frame = getTileFrame(batch.tiles[g]);
+    for (std::size_t j = batch.offsets[g]; j < batch.offsets[g + 1]; ++j) {
+      output.set(batch.order[j],
+                 trans_geo::kernel::enuToEcef(
+                     frame.rotation, frame.originEcef,
+                     {static_cast<double>(batch.enu[0][j]),
+                      static_cast<double>(batch.enu[1][j]),
+                      static_cast<double>(batch.enu[2][j])}));
+    }
+  }
+  return ConversionStatus::Ok;
+}
+
+}  // namespace trans_geo::conversion
@@ -10,6 +10,13 @@ ECEFCoordinate::ECEFCoordinate(double x, double y, double z) noexcept
 
 std::vector<double> ECEFCoordinate::getValues() const { return {x_, y_, z_}; }
 
+std::size_t ECEFCoordinate::valueCount() const noexcept { return 3; }
+
+std::array<double, ECEFCoordinate::kMaxValues> ECEFCoordinate::getValueArray()
+    const noexcept {
+  return {x_, y_, z_};
+}
+
 void ECEFCoordinate::setValues(const std::vector<double>& values) {
   if (values.size() != 3) {
     throw std::invalid_argument(
@@ -3,25 +3,32 @@
 #include <iomanip>
 #include <sstream>
 #include <stdexcept>
+#include <utility>
 
 namespace trans_geo::coordinate {
 using std::make_unique;
 
 ENUCoordinate::ENUCoordinate(double east, double north, double up,
                              const trans_geo::interface::ICoordinate& origin)
-    : east_(east), north_(north), up_(up), origin_(origin.clone()) {
-  auto values = origin_->getValues();
-  if (values.size() != 2 && values.size() != 3) {
-    throw std::invalid_argument(
-        "ENUCoordinate::ENUCoordinate requires origin coordinate with 2 or 3 "
-        "values.");
-  }
+    : east_(east), north_(north), up_(up), origin_(makeOriginHandle(origin)) {}
+
+ENUCoordinate::ENUCoordinate(double east, double north, double up,
+                             OriginHandle origin)
+    : east_(east), north_(north), up_(up) {
+  setOriginHandle(std::move(origin));
 }
 
 std::vector<double> ENUCoordinate::getValues() const {
   return {east_, north_, up_};
 }
 
+std::size_t ENUCoordinate::valueCount() const noexcept { return 3; }
+
+std::array<double, ENUCoordinate::kMaxValues> ENUCoordinate::getValueArray()
+    const noexcept {
+  return {east_, north_, up_};
+}
+
 void ENUCoordinate::setValues(const std::vector<double>& values) {
   if (values.size() != 3) {
     throw std::invalid_argument(
@@ -44,14 +51,26 @@ std::unique_ptr<trans_geo::interface::ICoordinate> ENUCoordinate::getOrigin()
   return origin_->clone();
 }
 
+const OriginHandle& ENUCoordinate::getOriginHandle() const noexcept {
+  return origin_;
+}
+
 void ENUCoordinate::setOrigin(const trans_geo::interface::ICoordinate& origin) {
-  auto values = origin.getValues();
-  if (values.size() != 2 && values.size() != 3) {
+  origin_ = makeOriginHandle(origin);
+}
+
+void ENUCoordinate::setOriginHandle(OriginHandle origin) {
+  if (!origin) {
+    throw std::invalid_argument(
+        "ENUCoordinate::setOriginHandle requires a non-null origin.");
+  }
+  std::size_t count = origin->valueCount();
+  if (count != 2 && count != 3) {
     throw std::invalid_argument(
-        "ENUCoordinate::setOrigin requires origin coordinate with 2 or 3 "
-        "values.");
+        "ENUCoordinate::setOriginHandle requires origin coordinate with 2 or "
+        "3 values.");
   }
-  origin_ = origin.clone();
+  origin_ = std::move(origin);
 }
 
 double ENUCoordinate::getEast() const noexcept { return east_; }
@@ -68,6 +87,6 @@ void ENUCoordinate::setUp(double up) noexcept { up_ = up; }
 
 std::unique_ptr<trans_geo::interface::ICoordinate> ENUCoordinate::clone()
     const {
-  return make_unique<ENUCoordinate>(east_, north_, up_, *origin_);
+  return make_unique<ENUCoordinate>(east_, north_, up_, origin_);
 }
 }  // namespace trans_geo::coordinate
\ No newline at end of file
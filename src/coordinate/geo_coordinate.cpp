@@ -21,6 +21,15 @@ std::vector<double> GeoCoordinate::getValues() const {
   return values;
 }
 
+std::size_t GeoCoordinate::valueCount() const noexcept {
+  return altitude_.has_value() ? 3 : 2;
+}
+
+std::array<double, GeoCoordinate::kMaxValues> GeoCoordinate::getValueArray()
+    const noexcept {
+  return {latitude_, longitude_, altitude_.value_or(0.0)};
+}
+
 void GeoCoordinate::setValues(const std::vector<double>& values) {
   if (values.size() == 2) {
     latitude_ = values[0];
@@ -37,13 +46,14 @@ void GeoCoordinate::setValues(const std::vector<double>& values) {
 }
 
 std::string GeoCoordinate::toString() const {
-  std::vector<double> values = getValues();
+  std::array<double, kMaxValues> values = getValueArray();
+  std::size_t count = valueCount();
   std::ostringstream oss;
   oss << std::fixed << std::setprecision(6);
   oss << "[";
-  for (size_t i = 0; i < values.size(); ++i) {
+  for (size_t i = 0; i < count; ++i) {
     oss << values[i];
-    if (i != values.size() - 1) {
+    if (i != count - 1) {
       oss << ", ";
     }
   }
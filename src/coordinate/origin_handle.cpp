@@ -0,0 +1,88 @@
+#include "coordinate/origin_handle.hpp"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <typeindex>
+
+namespace trans_geo::coordinate {
+namespace {
+using trans_geo::interface::ICoordinate;
+
+/// インターン表のキー（動的型・要素数・座標値のビット列）
+using OriginKey =
+    std::tuple<std::type_index, std::size_t,
+               std::array<std::uint64_t, ICoordinate::kMaxValues>>;
+
+/**
+ * @brief 原点のインターン表
+ */
+struct OriginRegistry {
+  std::mutex mutex;
+  std::map<OriginKey, std::weak_ptr<const ICoordinate>> entries;
+};
+
+OriginRegistry& registry() {
+  static OriginRegistry instance;
+  return instance;
+}
+
+/**
+ * @brief インターン表のキーを作成する
+ *
+ * NaN を含む場合も順序が定まるよう、座標値はビット列で比較します。
+ */
+OriginKey makeKey(const ICoordinate& origin) {
+  std::array<double, ICoordinate::kMaxValues> values = origin.getValueArray();
+  std::array<std::uint64_t, ICoordinate::kMaxValues> bits{};
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    bits[i] = std::bit_cast<std::uint64_t>(values[i]);
+  }
+  return {std::type_index(typeid(origin)), origin.valueCount(), bits};
+}
+
+void validateOrigin(const ICoordinate& origin) {
+  std::size_t count = origin.valueCount();
+  if (count != 2 && count != 3) {
+    throw std::invalid_argument(
+        "OriginHandle requires origin coordinate with 2 or 3 values.");
+  }
+}
+}  // namespace
+
+OriginHandle makeOriginHandle(const ICoordinate& origin) {
+  validateOrigin(origin);
+  return OriginHandle(origin.clone());
+}
+
+OriginHandle internOrigin(const ICoordinate& origin) {
+  validateOrigin(origin);
+  OriginKey key = makeKey(origin);
+
+  OriginRegistry& reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  auto it = reg.entries.find(key);
+  if (it != reg.entries.end()) {
+    if (OriginHandle shared = it->second.lock()) {
+      return shared;
+    }
+  }
+
+  // 新規登録の際に解放済みの原点を掃除する
+  for (auto entry = reg.entries.begin(); entry != reg.entries.end();) {
+    if (entry->second.expired()) {
+      entry = reg.entries.erase(entry);
+    } else {
+      ++entry;
+    }
+  }
+  OriginHandle handle(origin.clone());
+  reg.entries[key] = handle;
+  return handle;
+}
+
+}  // namespace trans_geo::coordinate
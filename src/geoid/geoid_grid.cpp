@@ -0,0 +1,278 @@
+#include "geoid/geoid_grid.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace trans_geo::geoid {
+namespace {
+/// 一括補間で 1 度に処理する点数
+constexpr std::size_t kBlockSize = 64;
+
+/// 格子の経度範囲が 360° を覆うとみなす許容誤差（度）
+constexpr double kFullCircleTolerance = 1e-9;
+
+constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+
+[[noreturn]] void throwInvalid(const char* reason) {
+  throw std::invalid_argument(std::string("GeoidGrid: ") + reason);
+}
+
+std::uint32_t byteSwap(std::uint32_t bits) {
+  return (bits >> 24) | ((bits >> 8) & 0x0000ff00u) |
+         ((bits << 8) & 0x00ff0000u) | (bits << 24);
+}
+
+std::uint64_t byteSwap(std::uint64_t bits) {
+  return (static_cast<std::uint64_t>(
+              byteSwap(static_cast<std::uint32_t>(bits)))
+          << 32) |
+         byteSwap(static_cast<std::uint32_t>(bits >> 32));
+}
+
+/**
+ * @brief ビッグエンディアンの値を読み出す
+ */
+template <typename T, typename Bits>
+T loadBigEndian(const std::byte* p) {
+  Bits bits;
+  std::memcpy(&bits, p, sizeof(bits));
+  if constexpr (std::endian::native == std::endian::little) {
+    bits = byteSwap(bits);
+  }
+  return std::bit_cast<T>(bits);
+}
+
+/**
+ * @brief ビッグエンディアンで書き込む
+ */
+template <typename Bits, typename T>
+void storeBigEndian(std::byte* p, T value) {
+  Bits bits = std::bit_cast<Bits>(value);
+  if constexpr (std::endian::native == std::endian::little) {
+    bits = byteSwap(bits);
+  }
+  std::memcpy(p, &bits, sizeof(bits));
+}
+
+/**
+ * @brief Catmull-Rom の重み（t は [0, 1]）
+ */
+std::array<double, 4> cubicWeights(double t) {
+  double t2 = t * t;
+  double t3 = t2 * t;
+  return {-0.5 * t3 + t2 - 0.5 * t, 1.5 * t3 - 2.5 * t2 + 1.0,
+          -1.5 * t3 + 2.0 * t2 + 0.5 * t, 0.5 * t3 - 0.5 * t2};
+}
+}  // namespace
+
+std::vector<std::byte> serializeGtx(const GeoidGridLayout& layout,
+                                    std::span<const float> values) {
+  std::size_t count = std::size_t{layout.rows} * layout.columns;
+  if (values.size() != count) {
+    throw std::invalid_argument(
+        "serializeGtx requires rows * columns values.");
+  }
+  std::vector<std::byte> buffer(kGtxHeaderSize + count * sizeof(float));
+  std::byte* p = buffer.data();
+  storeBigEndian<std::uint64_t>(p, layout.south);
+  storeBigEndian<std::uint64_t>(p + 8, layout.west);
+  storeBigEndian<std::uint64_t>(p + 16, layout.latitudeSpacing);
+  storeBigEndian<std::uint64_t>(p + 24, layout.longitudeSpacing);
+  storeBigEndian<std::uint32_t>(p + 32, layout.rows);
+  storeBigEndian<std::uint32_t>(p + 36, layout.columns);
+  for (std::size_t i = 0; i < count; ++i) {
+    storeBigEndian<std::uint32_t>(p + kGtxHeaderSize + i * sizeof(float),
+                                  values[i]);
+  }
+  return buffer;
+}
+
+GeoidGrid::GeoidGrid(const std::string& path) : file_(std::in_place, path) {
+  parseHeader(file_->bytes());
+  file_->adviseRandomAccess();
+}
+
+GeoidGrid::GeoidGrid(std::span<const std::byte> buffer) {
+  parseHeader(buffer);
+}
+
+void GeoidGrid::parseHeader(std::span<const std::byte> buffer) {
+  if (buffer.size() < kGtxHeaderSize) {
+    throwInvalid("buffer is smaller than the GTX header");
+  }
+  const std::byte* p = buffer.data();
+  layout_.south = loadBigEndian<double, std::uint64_t>(p);
+  layout_.west = loadBigEndian<double, std::uint64_t>(p + 8);
+  layout_.latitudeSpacing = loadBigEndian<double, std::uint64_t>(p + 16);
+  layout_.longitudeSpacing = loadBigEndian<double, std::uint64_t>(p + 24);
+  auto rows = loadBigEndian<std::int32_t, std::uint32_t>(p + 32);
+  auto columns = loadBigEndian<std::int32_t, std::uint32_t>(p + 36);
+
+  if (!(layout_.latitudeSpacing > 0.0 && layout_.longitudeSpacing > 0.0) ||
+      !std::isfinite(layout_.south) || !std::isfinite(layout_.west)) {
+    throwInvalid("invalid grid origin or spacing");
+  }
+  if (rows < 2 || columns < 2) {
+    throwInvalid("grid must have at least 2 rows and 2 columns");
+  }
+  layout_.rows = static_cast<std::uint32_t>(rows);
+  layout_.columns = static_cast<std::uint32_t>(columns);
+  std::size_t count = std::size_t{layout_.rows} * layout_.columns;
+  if ((buffer.size() - kGtxHeaderSize) / sizeof(float) < count) {
+    throwInvalid("buffer is smaller than rows * columns values");
+  }
+  values_ = p + kGtxHeaderSize;
+
+  // 360° を覆う格子（東端の列が西端の列と重なるものを含む）は周期的に扱う
+  double coverage = layout_.columns * layout_.longitudeSpacing;
+  if (coverage >= 360.0 - kFullCircleTolerance) {
+    period_ = static_cast<std::uint32_t>(
+        std::lround(360.0 / layout_.longitudeSpacing));
+  }
+}
+
+const GeoidGridLayout& GeoidGrid::getLayout() const noexcept {
+  return layout_;
+}
+
+double GeoidGrid::undulation(double latDeg, double lonDeg,
+                             GeoidInterpolation method) const noexcept {
+  double result = kNaN;
+  interpolate(&latDeg, &lonDeg, 1, 1, &result, method);
+  return result;
+}
+
+void GeoidGrid::undulations(std::span<const double> latDeg,
+                            std::span<const double> lonDeg,
+                            std::span<double> output,
+                            GeoidInterpolation method) const noexcept {
+  std::size_t count =
+      std::min({latDeg.size(), lonDeg.size(), output.size()});
+  interpolate(latDeg.data(), lonDeg.data(), 1, count, output.data(), method);
+}
+
+void GeoidGrid::undulations(trans_geo::coordinate::ConstPointView geo,
+                            std::span<double> output,
+                            GeoidInterpolation method) const noexcept {
+  std::size_t count = std::min(geo.size(), output.size());
+  if (count == 0 || !geo.hasData()) {
+    return;
+  }
+  interpolate(geo.component(0), geo.component(1), geo.stride(), count,
+              output.data(), method);
+}
+
+double GeoidGrid::value(std::int64_t row,
+                        std::int64_t column) const noexcept {
+  float v = loadBigEndian<float, std::uint32_t>(
+      values_ + (row * layout_.columns + column) * sizeof(float));
+  return v == kGtxNoData ? kNaN : static_cast<double>(v);
+}
+
+double GeoidGrid::node(std::int64_t row, std::int64_t column) const noexcept {
+  const std::int64_t maxRow = layout_.rows - 1;
+  const std::int64_t maxColumn = layout_.columns - 1;
+  // 格子の外側に 1 点はみ出した格子点は端の 2 点から線形に外挿する
+  // （双 3 次補間が端の格子でも 1 次関数を再現するように）
+  if (row < 0) {
+    return 2.0 * node(0, column) - node(1, column);
+  }
+  if (row > maxRow) {
+    return 2.0 * node(maxRow, column) - node(maxRow - 1, column);
+  }
+  if (period_ != 0) {
+    column %= period_;
+    return value(row, column < 0 ? column + period_ : column);
+  }
+  if (column < 0) {
+    return 2.0 * value(row, 0) - value(row, 1);
+  }
+  if (column > maxColumn) {
+    return 2.0 * value(row, maxColumn) - value(row, maxColumn - 1);
+  }
+  return value(row, column);
+}
+
+void GeoidGrid::interpolate(const double* lat, const double* lon,
+                            std::size_t stride, std::size_t count,
+                            double* output,
+                            GeoidInterpolation method) const noexcept {
+  const double lastRow = layout_.rows - 1.0;
+  const double lastColumn = layout_.columns - 1.0;
+  const double inverseLat = 1.0 / layout_.latitudeSpacing;
+  const double inverseLon = 1.0 / layout_.longitudeSpacing;
+  const bool periodic = period_ != 0;
+
+  std::array<std::int64_t, kBlockSize> row0;
+  std::array<std::int64_t, kBlockSize> column0;
+  std::array<double, kBlockSize> fy;
+  std::array<double, kBlockSize> fx;
+  std::array<bool, kBlockSize> inside;
+  for (std::size_t base = 0; base < count; base += kBlockSize) {
+    std::size_t n = std::min(kBlockSize, count - base);
+
+    // 1. 格子の番号と重み（分岐のない算術）
+    for (std::size_t i = 0; i < n; ++i) {
+      double y = (lat[(base + i) * stride] - layout_.south) * inverseLat;
+      double lonRel = lon[(base + i) * stride] - layout_.west;
+      if (periodic) {
+        lonRel -= 360.0 * std::floor(lonRel / 360.0);
+      }
+      double x = lonRel * inverseLon;
+      bool valid = y >= 0.0 && y <= lastRow && x >= 0.0 &&
+                   (periodic || x <= lastColumn);
+      // 最終行・最終列上の点は 1 つ手前の格子の端として扱う
+      double r = std::min(std::floor(y), lastRow - 1.0);
+      double c = periodic ? std::floor(x) : std::min(std::floor(x),
+                                                     lastColumn - 1.0);
+      inside[i] = valid;
+      row0[i] = valid ? static_cast<std::int64_t>(r) : 0;
+      column0[i] = valid ? static_cast<std::int64_t>(c) : 0;
+      fy[i] = valid ? y - r : 0.0;
+      fx[i] = valid ? x - c : 0.0;
+    }
+
+    // 2. 格子点の読み出しと 3. 重み付き和
+    if (method == GeoidInterpolation::Bilinear) {
+      std::array<std::array<double, kBlockSize>, 4> v;
+      for (std::size_t i = 0; i < n; ++i) {
+        v[0][i] = node(row0[i], column0[i]);
+        v[1][i] = node(row0[i], column0[i] + 1);
+        v[2][i] = node(row0[i] + 1, column0[i]);
+        v[3][i] = node(row0[i] + 1, column0[i] + 1);
+      }
+      for (std::size_t i = 0; i < n; ++i) {
+        double south = v[0][i] + fx[i] * (v[1][i] - v[0][i]);
+        double north = v[2][i] + fx[i] * (v[3][i] - v[2][i]);
+        double h = south + fy[i] * (north - south);
+        output[base + i] = inside[i] ? h : kNaN;
+      }
+    } else {
+      std::array<std::array<double, kBlockSize>, 4> rowSums;
+      for (std::size_t i = 0; i < n; ++i) {
+        std::array<double, 4> wx = cubicWeights(fx[i]);
+        for (std::int64_t j = 0; j < 4; ++j) {
+          std::int64_t row = row0[i] + j - 1;
+          std::int64_t column = column0[i];
+          rowSums[j][i] = wx[0] * node(row, column - 1) +
+                          wx[1] * node(row, column) +
+                          wx[2] * node(row, column + 1) +
+                          wx[3] * node(row, column + 2);
+        }
+      }
+      for (std::size_t i = 0; i < n; ++i) {
+        std::array<double, 4> wy = cubicWeights(fy[i]);
+        double h = wy[0] * rowSums[0][i] + wy[1] * rowSums[1][i] +
+                   wy[2] * rowSums[2][i] + wy[3] * rowSums[3][i];
+        output[base + i] = inside[i] ? h : kNaN;
+      }
+    }
+  }
+}
+
+}  // namespace trans_geo::geoid
@@ -0,0 +1,263 @@
+#include "instrumentation/instrumentation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace trans_geo::instrumentation {
+namespace {
+
+/**
+ * @brief 単一ライタ用のカウンタ
+ *
+ * 書き込むのは所有スレッドのみなので、加算は relaxed な load/store で済み、
+ * ロック付きの読み書き変更命令を発行しません。スナップショット側は
+ * 別スレッドから relaxed load で読み出します。
+ */
+struct Counter {
+  std::atomic<std::uint64_t> value{0};
+
+  void add(std::uint64_t n) noexcept {
+    value.store(value.load(std::memory_order_relaxed) + n,
+                std::memory_order_relaxed);
+  }
+  std::uint64_t load() const noexcept {
+    return value.load(std::memory_order_relaxed);
+  }
+  void clear() noexcept { value.store(0, std::memory_order_relaxed); }
+};
+
+struct OperationCounters {
+  Counter calls;
+  Counter points;
+  Counter totalNanoseconds;
+  std::array<Counter, kLatencyBuckets> latency;
+};
+
+/**
+ * @brief スレッドごとのカウンタ一式
+ */
+struct Shard {
+  std::array<std::array<OperationCounters, kOperationCount>, kConverterCount>
+      operations;
+  std::array<std::array<Counter, kIterationBuckets>, kConverterCount>
+      iterations;
+
+  void addTo(Snapshot& snapshot) const noexcept {
+    for (std::size_t c = 0; c < kConverterCount; ++c) {
+      auto& dst = snapshot.converters[c];
+      for (std::size_t o = 0; o < kOperationCount; ++o) {
+        const auto& src = operations[c][o];
+        auto& op = dst.operations[o];
+        op.calls += src.calls.load();
+        op.points += src.points.load();
+        op.totalNanoseconds += src.totalNanoseconds.load();
+        for (std::size_t b = 0; b < kLatencyBuckets; ++b) {
+          op.latency[b] += src.latency[b].load();
+        }
+      }
+      for (std::size_t b = 0; b < kIterationBuckets; ++b) {
+        dst.latitudeIterations[b] += iterations[c][b].load();
+      }
+    }
+  }
+
+  void clear() noexcept {
+    for (auto& converter : operations) {
+      for (auto& op : converter) {
+        op.calls.clear();
+        op.points.clear();
+        op.totalNanoseconds.clear();
+        for (auto& bucket : op.latency) bucket.clear();
+      }
+    }
+    for (auto& converter : iterations) {
+      for (auto& bucket : converter) bucket.clear();
+    }
+  }
+};
+
+/**
+ * @brief 生存中のスレッドのカウンタと、終了済みスレッドの合算値を管理する
+ *
+ * ミューテックスを取るのはスレッドの初回記録時・終了時とスナップショット
+ * 取得時のみで、記録処理そのものはロックを取りません。
+ */
+class Registry {
+ public:
+  void attach(const Shard* shard) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    live_.push_back(shard);
+  }
+
+  void detach(const Shard* shard) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shard->addTo(retired_);
+    live_.erase(std::remove(live_.begin(), live_.end(), shard), live_.end());
+  }
+
+  Snapshot snapshot() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Snapshot result = retired_;
+    for (const Shard* shard : live_) {
+      shard->addTo(result);
+    }
+    return result;
+  }
+
+  void reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    retired_ = Snapshot{};
+    for (const Shard* shard : live_) {
+      // 所有スレッドの書き込みと競合した場合、その 1 回分は残り得る
+      const_cast<Shard*>(shard)->clear();
+    }
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<const Shard*> live_;
+  Snapshot retired_;
+};
+
+Registry& registry() {
+  static Registry instance;
+  return instance;
+}
+
+/**
+ * @brief スレッド終了時にカウンタを合算値へ退避するためのハンドル
+ */
+struct ShardHandle {
+  Shard shard;
+  ShardHandle() { registry().attach(&shard); }
+  ~ShardHandle() { registry().detach(&shard); }
+};
+
+Shard& localShard() {
+  thread_local ShardHandle handle;
+  return handle.shard;
+}
+
+std::size_t latencyBucket(std::uint64_t nanoseconds) noexcept {
+  return std::min<std::size_t>(std::bit_width(nanoseconds),
+                               kLatencyBuckets - 1);
+}
+
+}  // namespace
+
+void recordCall(ConverterId id, Operation op, std::uint64_t points,
+                std::uint64_t nanoseconds) noexcept {
+  auto& counters = localShard().operations[static_cast<std::size_t>(id)]
+                                          [static_cast<std::size_t>(op)];
+  counters.calls.add(1);
+  counters.points.add(points);
+  counters.totalNanoseconds.add(nanoseconds);
+  counters.latency[latencyBucket(nanoseconds)].add(1);
+}
+
+void recordLatitudeIterations(ConverterId id, int iterations,
+                              std::uint64_t points) noexcept {
+  std::size_t bucket = std::min<std::size_t>(
+      static_cast<std::size_t>(std::max(iterations, 0)), kIterationBuckets - 1);
+  localShard().iterations[static_cast<std::size_t>(id)][bucket].add(points);
+}
+
+Snapshot snapshot() { return registry().snapshot(); }
+
+void reset() { registry().reset(); }
+
+const char* toString(ConverterId id) noexcept {
+  switch (id) {
+    case ConverterId::GeoToECEF:
+      return "GeoToECEF";
+    case ConverterId::ECEFToGeo:
+      return "ECEFToGeo";
+    case ConverterId::ECEFToENU:
+      return "ECEFToENU";
+    case ConverterId::ENUToECEF:
+      return "ENUToECEF";
+    case ConverterId::GeoToENU:
+      return "GeoToENU";
+    case ConverterId::ENUToGeo:
+      return "ENUToGeo";
+    default:
+      return "Unknown";
+  }
+}
+
+const char* toString(Operation op) noexcept {
+  switch (op) {
+    case Operation::Convert:
+      return "convert";
+    case Operation::Batch:
+      return "batch";
+    default:
+      return "unknown";
+  }
+}
+
+std::string toPrometheusText(const Snapshot& snapshot) {
+  std::ostringstream oss;
+  oss << "# TYPE transgeo_instrumentation_enabled gauge\n"
+      << "transgeo_instrumentation_enabled " << (snapshot.enabled ? 1 : 0)
+      << "\n";
+
+  oss << "# TYPE transgeo_calls_total counter\n";
+  oss << "# TYPE transgeo_points_total counter\n";
+  oss << "# TYPE transgeo_latency_nanoseconds histogram\n";
+  for (std::size_t c = 0; c < kConverterCount; ++c) {
+    for (std::size_t o = 0; o < kOperationCount; ++o) {
+      const auto& op = snapshot.converters[c].operations[o];
+      if (op.calls == 0) {
+        continue;
+      }
+      std::string labels =
+          std::string("converter=\"") + toString(static_cast<ConverterId>(c)) +
+          "\",operation=\"" + toString(static_cast<Operation>(o)) + "\"";
+      oss << "transgeo_calls_total{" << labels << "} " << op.calls << "\n";
+      oss << "transgeo_points_total{" << labels << "} " << op.points << "\n";
+      std::uint64_t cumulative = 0;
+      for (std::size_t b = 0; b + 1 < kLatencyBuckets; ++b) {
+        cumulative += op.latency[b];
+        // バケット b の上限は 2^b ns 未満
+        oss << "transgeo_latency_nanoseconds_bucket{" << labels << ",le=\""
+            << ((std::uint64_t{1} << b) - 1) << "\"} " << cumulative << "\n";
+      }
+      oss << "transgeo_latency_nanoseconds_bucket{" << labels
+          << ",le=\"+Inf\"} " << op.calls << "\n";
+      oss << "transgeo_latency_nanoseconds_sum{" << labels << "} "
+          << op.totalNanoseconds << "\n";
+      oss << "transgeo_latency_nanoseconds_count{" << labels << "} "
+          << op.calls << "\n";
+    }
+  }
+
+  oss << "# TYPE transgeo_latitude_iterations histogram\n";
+  for (std::size_t c = 0; c < kConverterCount; ++c) {
+    const auto& iterations = snapshot.converters[c].latitudeIterations;
+    std::uint64_t total = 0;
+    for (auto count : iterations) total += count;
+    if (total == 0) {
+      continue;
+    }
+    std::string labels = std::string("converter=\"") +
+                         toString(static_cast<ConverterId>(c)) + "\"";
+    std::uint64_t cumulative = 0;
+    for (std::size_t b = 0; b + 1 < kIterationBuckets; ++b) {
+      cumulative += iterations[b];
+      oss << "transgeo_latitude_iterations_bucket{" << labels << ",le=\"" << b
+          << "\"} " << cumulative << "\n";
+    }
+    oss << "transgeo_latitude_iterations_bucket{" << labels << ",le=\"+Inf\"} "
+        << total << "\n";
+    oss << "transgeo_latitude_iterations_count{" << labels << "} " << total
+        << "\n";
+  }
+  return oss.str();
+}
+
+}  // namespace trans_geo::instrumentation
@@ -0,0 +1,232 @@
+#include "io/arrow_adapter.hpp"
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace trans_geo::io {
+namespace {
+[[noreturn]] void throwInvalid(const char* function,
+                               const std::string& reason) {
+  throw std::invalid_argument(std::string(function) + ": " + reason);
+}
+
+/**
+ * @brief 検証済みの列の先頭ポインタと点数を求める
+ */
+std::array<double*, 3> resolveColumns(
+    const char* function, const ArrowSchema& schema, const ArrowArray& array,
+    const std::array<std::size_t, 3>& columns) {
+  if (schema.release == nullptr || array.release == nullptr) {
+    throwInvalid(function, "schema or array has been released");
+  }
+  if (schema.format == nullptr || std::strcmp(schema.format, "+s") != 0) {
+    throwInvalid(function, "record batch must be a struct array");
+  }
+  if (array.n_children != schema.n_children || array.length < 0 ||
+      array.offset < 0) {
+    throwInvalid(function, "schema and array do not match");
+  }
+  if (array.null_count != 0 && array.n_buffers > 0 &&
+      array.buffers[0] != nullptr) {
+    throwInvalid(function, "record batch contains null rows");
+  }
+
+  std::array<double*, 3> data{};
+  for (std::size_t k = 0; k < 3; ++k) {
+    std::size_t index = columns[k];
+    if (index >= static_cast<std::size_t>(schema.n_children)) {
+      throwInvalid(function, "column " + std::to_string(index) +
+                                 " is out of range");
+    }
+    const ArrowSchema& childSchema = *schema.children[index];
+    const ArrowArray& child = *array.children[index];
+    if (childSchema.format == nullptr ||
+        std::strcmp(childSchema.format, "g") != 0) {
+      throwInvalid(function, "column " + std::to_string(index) +
+                                 " is not float64");
+    }
+    if (child.n_buffers != 2 || child.offset < 0 ||
+        child.length < array.offset + array.length) {
+      throwInvalid(function, "column " + std::to_string(index) +
+                                 " has an invalid layout");
+    }
+    if (child.null_count != 0 && child.buffers[0] != nullptr) {
+      throwInvalid(function, "column " + std::to_string(index) +
+                                 " contains nulls");
+    }
+    if (child.buffers[1] == nullptr) {
+      if (array.length != 0) {
+        throwInvalid(function, "column " + std::to_string(index) +
+                                   " has no data buffer");
+      }
+      continue;
+    }
+    // Arrow のバッファは const で公開されるが、所有者はその場での更新を許可する
+    auto* values =
+        const_cast<double*>(static_cast<const double*>(child.buffers[1]));
+    data[k] = values + child.offset + array.offset;
+  }
+  return data;
+}
+
+/**
+ * @brief 列名（frame ごと）
+ */
+std::array<const char*, 3> columnNames(CoordinateFrame frame) {
+  switch (frame) {
+    case CoordinateFrame::Geo:
+      return {"lat", "lon", "h"};
+    case CoordinateFrame::ECEF:
+      return {"x", "y", "z"};
+    case CoordinateFrame::ENU:
+      return {"e", "n", "u"};
+  }
+  return {"c0", "c1", "c2"};
+}
+
+/**
+ * @brief 子列のスキーマを解放する（静的な文字列のみ参照する）
+ */
+void releaseChildSchema(ArrowSchema* schema) {
+  schema->release = nullptr;
+}
+
+/**
+ * @brief 親スキーマの所有データ
+ */
+struct SchemaPrivate {
+  std::array<ArrowSchema, 3> children;
+  std::array<ArrowSchema*, 3> childPointers;
+};
+
+void releaseSchema(ArrowSchema* schema) {
+  auto* owned = static_cast<SchemaPrivate*>(schema->private_data);
+  for (ArrowSchema& child : owned->children) {
+    if (child.release != nullptr) {
+      child.release(&child);
+    }
+  }
+  delete owned;
+  schema->release = nullptr;
+}
+
+/**
+ * @brief 子列のデータの所有データ（座標列を共有して保持する）
+ */
+struct ColumnPrivate {
+  std::shared_ptr<trans_geo::coordinate::PointBuffer> points;
+  std::array<const void*, 2> buffers;
+};
+
+void releaseColumn(ArrowArray* array) {
+  delete static_cast<ColumnPrivate*>(array->private_data);
+  array->release = nullptr;
+}
+
+/**
+ * @brief 親データの所有データ
+ */
+struct ArrayPrivate {
+  std::array<const void*, 1> buffers{nullptr};
+  std::array<ArrowArray, 3> children;
+  std::array<ArrowArray*, 3> childPointers;
+};
+
+void releaseArray(ArrowArray* array) {
+  auto* owned = static_cast<ArrayPrivate*>(array->private_data);
+  for (ArrowArray& child : owned->children) {
+    if (child.release != nullptr) {
+      child.release(&child);
+    }
+  }
+  delete owned;
+  array->release = nullptr;
+}
+}  // namespace
+
+std::size_t findArrowColumn(const ArrowSchema& schema, std::string_view name) {
+  for (int64_t i = 0; i < schema.n_children; ++i) {
+    const char* childName = schema.children[i]->name;
+    if (childName != nullptr && name == childName) {
+      return static_cast<std::size_t>(i);
+    }
+  }
+  throwInvalid("findArrowColumn", "no column named " + std::string(name));
+}
+
+trans_geo::coordinate::ConstPointView arrowPoints(
+    const ArrowSchema& schema, const ArrowArray& array,
+    const std::array<std::size_t, 3>& columns) {
+  std::array<double*, 3> data =
+      resolveColumns("arrowPoints", schema, array, columns);
+  return trans_geo::coordinate::ConstPointView::columns(
+      data[0], data[1], data[2], static_cast<std::size_t>(array.length));
+}
+
+trans_geo::coordinate::PointView arrowMutablePoints(
+    const ArrowSchema& schema, ArrowArray& array,
+    const std::array<std::size_t, 3>& columns) {
+  std::array<double*, 3> data =
+      resolveColumns("arrowMutablePoints", schema, array, columns);
+  return trans_geo::coordinate::PointView::columns(
+      data[0], data[1], data[2], static_cast<std::size_t>(array.length));
+}
+
+void exportArrowPoints(trans_geo::coordinate::PointBuffer&& points,
+                       CoordinateFrame frame, ArrowSchema* schema,
+                       ArrowArray* array) {
+  auto shared = std::make_shared<trans_geo::coordinate::PointBuffer>(
+      std::move(points));
+  auto length = static_cast<int64_t>(shared->size());
+  std::array<const char*, 3> names = columnNames(frame);
+
+  // 確保を先に済ませ、以降は例外を送出しない
+  auto schemaOwned = std::make_unique<SchemaPrivate>();
+  auto arrayOwned = std::make_unique<ArrayPrivate>();
+  std::array<std::unique_ptr<ColumnPrivate>, 3> columns;
+  for (auto& column : columns) {
+    column = std::make_unique<ColumnPrivate>();
+  }
+
+  for (std::size_t k = 0; k < 3; ++k) {
+    schemaOwned->children[k] = ArrowSchema{
+        "g", names[k], nullptr, 0, 0, nullptr, nullptr, releaseChildSchema,
+        nullptr};
+    schemaOwned->childPointers[k] = &schemaOwned->children[k];
+
+    ColumnPrivate* column = columns[k].release();
+    column->points = shared;
+    column->buffers = {nullptr, shared->component(k).data()};
+    arrayOwned->children[k] =
+        ArrowArray{length,  0,       0,       2, 0, column->buffers.data(),
+                   nullptr, nullptr, releaseColumn, column};
+    arrayOwned->childPointers[k] = &arrayOwned->children[k];
+  }
+
+  *schema = ArrowSchema{"+s",
+                        "",
+                        nullptr,
+                        0,
+                        3,
+                        schemaOwned->childPointers.data(),
+                        nullptr,
+                        releaseSchema,
+                        schemaOwned.get()};
+  *array = ArrowArray{length,
+                      0,
+                      0,
+                      1,
+                      3,
+                      arrayOwned->buffers.data(),
+                      arrayOwned->childPointers.data(),
+                      nullptr,
+                      releaseArray,
+                      arrayOwned.get()};
+  schemaOwned.release();
+  arrayOwned.release();
+}
+
+}  // namespace trans_geo::io
@@ -0,0 +1,485 @@
+#include "io/async_file_io.hpp"
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined(TRANSGEO_HAVE_IO_URING)
+#include <linux/io_uring.h>
+#endif
+
+namespace trans_geo::io {
+namespace {
+/// 1 回の読み書きの上限（io_uring の長さは 32 ビット）
+constexpr std::size_t kMaxTransfer = std::size_t{1} << 30;
+/// Threads 実装の入出力スレッド数の上限
+constexpr std::size_t kMaxIoThreads = 4;
+
+/**
+ * @brief 1 件の読み書きの要求（data・bytes・offset は残りの範囲）
+ */
+struct Request {
+  int fd;
+  std::byte* data;
+  std::size_t bytes;
+  std::uint64_t offset;
+  std::uint64_t tag;
+  bool write;
+};
+
+[[noreturn]] void throwSystemError(int error, const char* what) {
+  throw std::system_error(error, std::generic_category(), what);
+}
+
+Request makeRequest(int fd, const void* data, std::size_t bytes,
+                    std::uint64_t offset, std::uint64_t tag, bool write) {
+  return {fd, static_cast<std::byte*>(const_cast<void*>(data)), bytes, offset,
+          tag, write};
+}
+
+/**
+ * @brief 入出力スレッドが pread / pwrite を呼ぶ実装
+ */
+class ThreadFileIo final : public IAsyncFileIo {
+ public:
+  explicit ThreadFileIo(std::size_t capacity) : capacity_(capacity) {
+    std::size_t threads = std::min(capacity, kMaxIoThreads);
+    for (std::size_t t = 0; t < threads; ++t) {
+      workers_.emplace_back([this] { run(); });
+    }
+  }
+
+  ~ThreadFileIo() override {
+    {
+      std::lock_guard lock(mutex_);
+      stopping_ = true;
+    }
+    requested_.notify_all();
+    // 各スレッドは登録済みの要求を処理し終えてから終了する
+    for (std::jthread& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  AsyncIoBackend getBackend() const noexcept override {
+    return AsyncIoBackend::Threads;
+  }
+  std::size_t getCapacity() const noexcept override { return capacity_; }
+  std::size_t pending() const noexcept override { return pending_; }
+
+  void read(int fd, void* data, std::size_t bytes, std::uint64_t offset,
+            std::uint64_t tag) override {
+    enqueue(makeRequest(fd, data, bytes, offset, tag, false));
+  }
+
+  void write(int fd, const void* data, std::size_t bytes,
+             std::uint64_t offset, std::uint64_t tag) override {
+    enqueue(makeRequest(fd, data, bytes, offset, tag, true));
+  }
+
+  std::uint64_t wait() override {
+    if (pending_ == 0) {
+      throw std::logic_error("IAsyncFileIo::wait has no pending request.");
+    }
+    std::unique_lock lock(mutex_);
+    completed_.wait(lock, [this] { return !completions_.empty(); });
+    Completion completion = completions_.front();
+    completions_.pop_front();
+    --pending_;
+    if (completion.error != 0) {
+      throwSystemError(completion.error, "IAsyncFileIo::wait");
+    }
+    return completion.tag;
+  }
+
+ private:
+  struct Completion {
+    std::uint64_t tag;
+    int error;
+  };
+
+  void enqueue(const Request& request) {
+    if (pending_ >= capacity_) {
+      throw std::length_error("IAsyncFileIo queue is full.");
+    }
+    {
+      std::lock_guard lock(mutex_);
+      requests_.push_back(request);
+    }
+    ++pending_;
+    requested_.notify_one();
+  }
+
+  void run() {
+    std::unique_lock lock(mutex_);
+    while (true) {
+      requested_.wait(lock,
+                      [this] { return stopping_ || !requests_.empty(); });
+      if (requests_.empty()) {
+        return;
+      }
+      Request request = requests_.front();
+      requests_.pop_front();
+      lock.unlock();
+      int error = transfer(request);
+      lock.lock();
+      completions_.push_back({request.tag, error});
+      completed_.notify_one();
+    }
+  }
+
+  /**
+   * @brief 要求の範囲をすべて読み書きする
+   * @return int 成功した場合は 0、失敗した場合は errno
+   */
+  static int transfer(Request& request) {
+    while (request.bytes > 0) {
+      std::size_t bytes = std::min(request.bytes, kMaxTransfer);
+      ssize_t done =
+          request.write
+              ? ::pwrite(request.fd, request.data, bytes,
+                         static_cast<off_t>(request.offset))
+              : ::pread(request.fd, request.data, bytes,
+                        static_cast<off_t>(request.offset));
+      if (done < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return errno;
+      }
+      if (done == 0) {
+        return EIO;  // ファイル末尾を超えた読み込み
+      }
+      request.data += done;
+      request.bytes -= static_cast<std::size_t>(done);
+      request.offset += static_cast<std::uint64_t>(done);
+    }
+    return 0;
+  }
+
+  std::size_t capacity_;
+  std::size_t pending_ = 0;  ///< 登録したスレッドだけが読み書きする
+  std::mutex mutex_;
+  std::condition_variable requested_;
+  std::condition_variable completed_;
+  std::deque<Request> requests_;
+  std::deque<Completion> completions_;
+  bool stopping_ = false;
+  std::vector<std::jthread> workers_;
+};
+
+#if defined(TRANSGEO_HAVE_IO_URING)
+/// io_uring の要求数の上限（カーネルの IORING_MAX_ENTRIES より小さくする）
+constexpr std::size_t kMaxRingEntries = 4096;
+
+int ioUringSetup(unsigned entries, io_uring_params* params) {
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int ioUringEnter(int fd, unsigned submit, unsigned minComplete,
+                 unsigned flags) {
+  return static_cast<int>(::syscall(__NR_io_uring_enter, fd, submit,
+                                    minComplete, flags, nullptr, 0));
+}
+
+/**
+ * @brief IORING_OP_READ / WRITE と 1 回の mmap での共有を持つカーネル
+ *        （5.6 以降）かを判定する
+ */
+bool hasRequiredFeatures(const io_uring_params& params) {
+  return (params.features & IORING_FEAT_SINGLE_MMAP) &&
+         (params.features & IORING_FEAT_RW_CUR_POS);
+}
+
+/**
+ * @brief io_uring のシステムコールを直接呼ぶ実装（liburing は使わない）
+ *
+ * 要求は登録時にすぐ io_uring_enter で発行し、短い読み書きは完了を
+ * 受け取ったときに残りを再発行します。
+ */
+class IoUringFileIo final : public IAsyncFileIo {
+ public:
+  explicit IoUringFileIo(std::size_t capacity)
+      : capacity_(std::min(capacity, kMaxRingEntries)) {
+    io_uring_params params{};
+    ringFd_ = ioUringSetup(static_cast<unsigned>(capacity_), &params);
+    if (ringFd_ < 0) {
+      throwSystemError(errno, "IoUringFileIo: io_uring_setup failed");
+    }
+    if (!hasRequiredFeatures(params)) {
+      ::close(ringFd_);
+      throwSystemError(ENOSYS, "IoUringFileIo: kernel is too old");
+    }
+
+    ringBytes_ = std::max(
+        params.sq_off.array + params.sq_entries * sizeof(unsigned),
+        params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+    ring_ = ::mmap(nullptr, ringBytes_, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, ringFd_, IORING_OFF_SQ_RING);
+    sqesBytes_ = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes = ring_ == MAP_FAILED
+                     ? MAP_FAILED
+                     : ::mmap(nullptr, sqesBytes_, PROT_READ | PROT_WRITE,
+                              MAP_SHARED | MAP_POPULATE, ringFd_,
+                              IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+      int error = errno;
+      release();
+      throwSystemError(error, "IoUringFileIo: cannot map the rings");
+    }
+    sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+    auto* ring = static_cast<std::byte*>(ring_);
+    sqHead_ = reinterpret_cast<unsigned*>(ring + params.sq_off.head);
+    sqTail_ = reinterpret_cast<unsigned*>(ring + params.sq_off.tail);
+    sqMask_ = *reinterpret_cast<unsigned*>(ring + params.sq_off.ring_mask);
+    sqArray_ = reinterpret_cast<unsigned*>(ring + params.sq_off.array);
+    cqHead_ = reinterpret_cast<unsigned*>(ring + params.cq_off.head);
+    cqTail_ = reinterpret_cast<unsigned*>(ring + params.cq_off.tail);
+    cqMask_ = *reinterpret_cast<unsigned*>(ring + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(ring + params.cq_off.cqes);
+
+    requests_.resize(capacity_);
+    for (std::size_t slot = capacity_; slot > 0; --slot) {
+      freeSlots_.push_back(slot - 1);
+    }
+  }
+
+  ~IoUringFileIo() override {
+    // カーネルが書き込み中のバッファを呼び出し側が解放しないよう、
+    // 未完了の要求をすべて受け取ってから閉じる。io_uring_enter 自体が
+    // 失敗した場合は完了を待てないため、そこで打ち切る
+    while (pending_ > 0 && !enterFailed_) {
+      try {
+        wait();
+      } catch (const std::system_error&) {
+      }
+    }
+    release();
+  }
+
+  AsyncIoBackend getBackend() const noexcept override {
+    return AsyncIoBackend::IoUring;
+  }
+  std::size_t getCapacity() const noexcept override { return capacity_; }
+  std::size_t pending() const noexcept override { return pending_; }
+
+  void read(int fd, void* data, std::size_t bytes, std::uint64_t offset,
+            std::uint64_t tag) override {
+    enqueue(makeRequest(fd, data, bytes, offset, tag, false));
+  }
+
+  void write(int fd, const void* data, std::size_t bytes,
+             std::uint64_t offset, std::uint64_t tag) override {
+    enqueue(makeRequest(fd, data, bytes, offset, tag, true));
+  }
+
+  std::uint64_t wait() override {
+    if (pending_ == 0) {
+      throw std::logic_error("IAsyncFileIo::wait has no pending request.");
+    }
+    if (!emptyCompletions_.empty()) {
+      std::size_t slot = emptyCompletions_.back();
+      emptyCompletions_.pop_back();
+      finish(slot);
+      return requests_[slot].tag;
+    }
+    while (true) {
+      unsigned head = *cqHead_;
+      unsigned tail =
+          std::atomic_ref<unsigned>(*cqTail_).load(std::memory_order_acquire);
+      if (head == tail) {
+        if (ioUringEnter(ringFd_, 0, 1, IORING_ENTER_GETEVENTS) < 0 &&
+            errno != EINTR) {
+          enterFailed_ = true;
+          throwSystemError(errno, "IAsyncFileIo::wait");
+        }
+        continue;
+      }
+      io_uring_cqe cqe = cqes_[head & cqMask_];
+      std::atomic_ref<unsigned>(*cqHead_).store(head + 1,
+                                                std::memory_order_release);
+
+      std::size_t slot = static_cast<std::size_t>(cqe.user_data);
+      Request& request = requests_[slot];
+      if (cqe.res <= 0) {
+        finish(slot);
+        // 0 はファイル末尾を超えた読み込み
+        throwSystemError(cqe.res < 0 ? -cqe.res : EIO, "IAsyncFileIo::wait");
+      }
+      request.data += cqe.res;
+      request.bytes -= static_cast<std::size_t>(cqe.res);
+      request.offset += static_cast<std::uint64_t>(cqe.res);
+      if (request.bytes > 0) {
+        submit(slot);
+        continue;
+      }
+      finish(slot);
+      return request.tag;
+    }
+  }
+
+ private:
+  void enqueue(const Request& request) {
+    if (pending_ >= capacity_) {
+      throw std::length_error("IAsyncFileIo queue is full.");
+    }
+    std::size_t slot = freeSlots_.back();
+    freeSlots_.pop_back();
+    requests_[slot] = request;
+    ++pending_;
+    if (request.bytes == 0) {
+      // 長さ 0 の要求はカーネルに渡さず、完了済みとして扱う
+      emptyCompletions_.push_back(slot);
+      return;
+    }
+    submit(slot);
+  }
+
+  /**
+   * @brief 要求を 1 つ発行する
+   *
+   * io_uring_enter が失敗した場合は、カーネルが受け取っていない SQE を
+   * 取り消して slot を返却してから例外を送出する（pending() に残さない）。
+   */
+  void submit(std::size_t slot) {
+    const Request& request = requests_[slot];
+    unsigned tail = *sqTail_;
+    unsigned index = tail & sqMask_;
+    io_uring_sqe& sqe = sqes_[index];
+    std::memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = request.write ? IORING_OP_WRITE : IORING_OP_READ;
+    sqe.fd = request.fd;
+    sqe.addr = reinterpret_cast<std::uint64_t>(request.data);
+    sqe.len = static_cast<unsigned>(std::min(request.bytes, kMaxTransfer));
+    sqe.off = request.offset;
+    sqe.user_data = slot;
+    sqArray_[index] = index;
+    std::atomic_ref<unsigned>(*sqTail_).store(tail + 1,
+                                              std::memory_order_release);
+    while (ioUringEnter(ringFd_, 1, 0, 0) < 0) {
+      if (errno != EINTR) {
+        int error = errno;
+        unsigned head =
+            std::atomic_ref<unsigned>(*sqHead_).load(std::memory_order_acquire);
+        if (head == tail) {
+          std::atomic_ref<unsigned>(*sqTail_).store(tail,
+                                                    std::memory_order_release);
+          finish(slot);
+        }
+        // 受け取られていた場合は完了が届くため、pending() に残して
+        // wait() で受け取る
+        throwSystemError(error, "IAsyncFileIo: io_uring_enter failed");
+      }
+    }
+  }
+
+  void finish(std::size_t slot) noexcept {
+    freeSlots_.push_back(slot);
+    --pending_;
+  }
+
+  void release() noexcept {
+    if (sqes_ != nullptr) {
+      ::munmap(sqes_, sqesBytes_);
+    }
+    if (ring_ != MAP_FAILED) {
+      ::munmap(ring_, ringBytes_);
+    }
+    ::close(ringFd_);
+  }
+
+  std::size_t capacity_;
+  std::size_t pending_ = 0;
+  bool enterFailed_ = false;  ///< io_uring_enter が失敗し完了を待てない
+  int ringFd_ = -1;
+  void* ring_ = MAP_FAILED;
+  std::size_t ringBytes_ = 0;
+  io_uring_sqe* sqes_ = nullptr;
+  std::size_t sqesBytes_ = 0;
+  unsigned* sqHead_ = nullptr;
+  unsigned* sqTail_ = nullptr;
+  unsigned sqMask_ = 0;
+  unsigned* sqArray_ = nullptr;
+  unsigned* cqHead_ = nullptr;
+  unsigned* cqTail_ = nullptr;
+  unsigned cqMask_ = 0;
+  io_uring_cqe* cqes_ = nullptr;
+  std::vector<Request> requests_;
+  std::vector<std::size_t> freeSlots_;
+  std::vector<std::size_t> emptyCompletions_;
+};
+
+/**
+ * @brief io_uring を実際に作成できるかを調べる
+ */
+bool probeIoUring() noexcept {
+  io_uring_params params{};
+  int fd = ioUringSetup(1, &params);
+  if (fd < 0) {
+    return false;
+  }
+  ::close(fd);
+  return hasRequiredFeatures(params);
+}
+#endif
+}  // namespace
+
+const char* asyncIoBackendName(AsyncIoBackend backend) noexcept {
+  switch (backend) {
+    case AsyncIoBackend::Auto:
+      return "auto";
+    case AsyncIoBackend::IoUring:
+      return "io_uring";
+    case AsyncIoBackend::Threads:
+      return "threads";
+  }
+  return "unknown";
+}
+
+bool asyncIoBackendAvailable(AsyncIoBackend backend) noexcept {
+  if (backend != AsyncIoBackend::IoUring) {
+    return true;
+  }
+#if defined(TRANSGEO_HAVE_IO_URING)
+  static const bool available = probeIoUring();
+  return available;
+#else
+  return false;
+#endif
+}
+
+std::unique_ptr<IAsyncFileIo> makeAsyncFileIo(AsyncIoBackend backend,
+                                              std::size_t capacity) {
+  if (capacity == 0) {
+    throw std::invalid_argument(
+        "makeAsyncFileIo requires a non-zero capacity.");
+  }
+  if (backend == AsyncIoBackend::Auto) {
+    backend = asyncIoBackendAvailable(AsyncIoBackend::IoUring)
+                  ? AsyncIoBackend::IoUring
+                  : AsyncIoBackend::Threads;
+  }
+  if (backend == AsyncIoBackend::IoUring) {
+#if defined(TRANSGEO_HAVE_IO_URING)
+    return std::make_unique<IoUringFileIo>(capacity);
+#else
+    throwSystemError(ENOSYS, "makeAsyncFileIo: built without io_uring");
+#endif
+  }
+  return std::make_unique<ThreadFileIo>(capacity);
+}
+
+}  // namespace trans_geo::io
@@ -0,0 +1,238 @@
+#include "io/chunked_conversion.hpp"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <chrono>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+
+namespace trans_geo::io {
+namespace {
+using trans_geo::conversion::ConversionStatus;
+using trans_geo::coordinate::ConstPointView;
+using trans_geo::coordinate::PointView;
+using Clock = std::chrono::steady_clock;
+
+[[noreturn]] void throwSystemError(const std::string& what) {
+  throw std::system_error(errno, std::generic_category(), what);
+}
+
+/**
+ * @brief スコープを抜けると閉じるファイル記述子
+ */
+class FileDescriptor {
+ public:
+  FileDescriptor(int fd, const std::string& what) : fd_(fd) {
+    if (fd_ < 0) {
+      throwSystemError(what);
+    }
+  }
+  ~FileDescriptor() { ::close(fd_); }
+  FileDescriptor(const FileDescriptor&) = delete;
+  FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+  int get() const noexcept { return fd_; }
+
+ private:
+  int fd_;
+};
+
+/**
+ * @brief 同期的に最大 bytes バイトを読み込む
+ * @return std::size_t 読み込んだバイト数（ファイル末尾では少ない）
+ */
+std::size_t readAt(int fd, void* data, std::size_t bytes, off_t offset) {
+  std::size_t done = 0;
+  while (done < bytes) {
+    ssize_t n = ::pread(fd, static_cast<char*>(data) + done, bytes - done,
+                        offset + static_cast<off_t>(done));
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n < 0) {
+      throwSystemError("convertColumnarFile: cannot read the header");
+    }
+    if (n == 0) {
+      break;
+    }
+    done += static_cast<std::size_t>(n);
+  }
+  return done;
+}
+
+/**
+ * @brief 同期的に bytes バイトを書き込む
+ */
+void writeAt(int fd, const void* data, std::size_t bytes, off_t offset) {
+  std::size_t done = 0;
+  while (done < bytes) {
+    ssize_t n = ::pwrite(fd, static_cast<const char*>(data) + done,
+                         bytes - done, offset + static_cast<off_t>(done));
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n < 0) {
+      throwSystemError("convertColumnarFile: cannot write the header");
+    }
+    done += static_cast<std::size_t>(n);
+  }
+}
+
+/// 要求の tag（バッファの番号と、読み込みか書き込みか）
+constexpr std::uint64_t makeTag(std::size_t slot, bool write) {
+  return static_cast<std::uint64_t>(slot) * 2 + (write ? 1 : 0);
+}
+}  // namespace
+
+ChunkedConversionReport convertColumnarFile(
+    const std::string& inputPath, const std::string& outputPath,
+    const trans_geo::conversion::ICoordinateConverter& converter,
+    const ColumnarMetadata& outputMetadata,
+    const ChunkedConversionOptions& options) {
+  // 列はホストのバイト順のまま読み書きするため、リトルエンディアンに限定する
+  if constexpr (std::endian::native != std::endian::little) {
+    throw std::runtime_error(
+        "convertColumnarFile requires a little-endian host.");
+  }
+  if (options.chunkPoints == 0 || options.queueDepth == 0) {
+    throw std::invalid_argument(
+        "convertColumnarFile requires non-zero chunkPoints and queueDepth.");
+  }
+  Clock::time_point start = Clock::now();
+
+  // 入力のヘッダだけを同期的に読んで検証する
+  FileDescriptor input(::open(inputPath.c_str(), O_RDONLY | O_CLOEXEC),
+                       "convertColumnarFile: cannot open " + inputPath);
+  struct stat st{};
+  if (::fstat(input.get(), &st) != 0) {
+    throwSystemError("convertColumnarFile: cannot stat " + inputPath);
+  }
+  std::byte headerBytes[sizeof(ColumnarHeader)];
+  std::size_t headerSize =
+      readAt(input.get(), headerBytes, sizeof(headerBytes), 0);
+  ColumnarLayout layout =
+      parseColumnarHeader(std::span(headerBytes, headerSize),
+                          static_cast<std::uint64_t>(st.st_size));
+  const std::size_t n = layout.pointCount;
+  ColumnarHeader header = makeColumnarHeader(outputMetadata, n);
+
+  // 出力を開くと切り詰められるため、入力と同じファイルは受け付けない
+  struct stat outputSt{};
+  if (::stat(outputPath.c_str(), &outputSt) == 0 &&
+      outputSt.st_dev == st.st_dev && outputSt.st_ino == st.st_ino) {
+    throw std::invalid_argument(
+        "convertColumnarFile requires distinct input and output files.");
+  }
+  FileDescriptor output(
+      ::open(outputPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+             0644),
+      "convertColumnarFile: cannot open " + outputPath);
+  if (::ftruncate(output.get(), static_cast<off_t>(columnarByteSize(n))) !=
+      0) {
+    throwSystemError("convertColumnarFile: cannot resize " + outputPath);
+  }
+  writeAt(output.get(), &header, sizeof(header), 0);
+
+  const std::size_t chunkPoints = options.chunkPoints;
+  const std::size_t chunks = (n + chunkPoints - 1) / chunkPoints;
+  const std::size_t slots = std::max<std::size_t>(
+      1, std::min(options.queueDepth, chunks));
+  // バッファごとに入力 3 列・出力 3 列（未初期化）
+  std::unique_ptr<double[]> buffers(
+      new double[chunks == 0 ? 0 : slots * 6 * chunkPoints]);
+  std::vector<std::size_t> readsPending(slots, 0);
+  std::vector<std::size_t> writesPending(slots, 0);
+  // 入力 3 列と出力 3 列の要求がバッファの数だけ同時に登録される。
+  // キューはバッファの後に作成する。破棄は逆順のため、例外で抜ける場合も
+  // キューのデストラクタが未完了の要求を受け取ってからバッファが解放される
+  std::unique_ptr<IAsyncFileIo> io =
+      makeAsyncFileIo(options.backend, 6 * slots);
+
+  ChunkedConversionReport report;
+  report.points = n;
+  report.chunks = chunks;
+  report.backend = io->getBackend();
+
+  auto inputBuffer = [&](std::size_t slot) {
+    return buffers.get() + slot * 6 * chunkPoints;
+  };
+  auto outputBuffer = [&](std::size_t slot) {
+    return inputBuffer(slot) + 3 * chunkPoints;
+  };
+  auto chunkSize = [&](std::size_t chunk) {
+    return std::min(chunkPoints, n - chunk * chunkPoints);
+  };
+  auto submitRead = [&](std::size_t chunk) {
+    std::size_t slot = chunk % slots;
+    for (std::size_t k = 0; k < kColumnCount; ++k) {
+      io->read(input.get(), inputBuffer(slot) + k * chunkPoints,
+               chunkSize(chunk) * sizeof(double),
+               layout.columnOffsets[k] + chunk * chunkPoints * sizeof(double),
+               makeTag(slot, false));
+    }
+    readsPending[slot] += kColumnCount;
+  };
+  auto waitOne = [&] {
+    Clock::time_point waitStart = Clock::now();
+    std::uint64_t tag = io->wait();
+    report.ioWaitSeconds +=
+        std::chrono::duration<double>(Clock::now() - waitStart).count();
+    std::size_t slot = static_cast<std::size_t>(tag / 2);
+    --(tag % 2 != 0 ? writesPending : readsPending)[slot];
+  };
+
+  for (std::size_t chunk = 0; chunk < slots && chunk < chunks; ++chunk) {
+    submitRead(chunk);
+  }
+  for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+    // チャンクの読み込みと、同じバッファの前回の書き込みの完了を待つ
+    std::size_t slot = chunk % slots;
+    while (readsPending[slot] > 0 || writesPending[slot] > 0) {
+      waitOne();
+    }
+
+    std::size_t count = chunkSize(chunk);
+    double* in = inputBuffer(slot);
+    double* out = outputBuffer(slot);
+    Clock::time_point convertStart = Clock::now();
+    ConversionStatus status = converter.convertBatch(
+        ConstPointView::columns(in, in + chunkPoints, in + 2 * chunkPoints,
+                                count),
+        PointView::columns(out, out + chunkPoints, out + 2 * chunkPoints,
+                           count));
+    report.convertSeconds +=
+        std::chrono::duration<double>(Clock::now() - convertStart).count();
+    if (status != ConversionStatus::Ok) {
+      throw std::runtime_error(
+          std::string("convertColumnarFile: conversion failed with ") +
+          trans_geo::conversion::toString(status));
+    }
+
+    for (std::size_t k = 0; k < kColumnCount; ++k) {
+      io->write(output.get(), out + k * chunkPoints, count * sizeof(double),
+                header.columnOffsets[k] + chunk * chunkPoints * sizeof(double),
+                makeTag(slot, true));
+    }
+    writesPending[slot] += kColumnCount;
+    // 入力バッファは空いたので、このバッファが次に担当するチャンクを読む
+    if (chunk + slots < chunks) {
+      submitRead(chunk + slots);
+    }
+  }
+  while (io->pending() > 0) {
+    waitOne();
+  }
+
+  report.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+  return report;
+}
+
+}  // namespace trans_geo::io
@@ -0,0 +1,230 @@
+#include "io/columnar_format.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace trans_geo::io {
+namespace {
+constexpr std::uint8_t kOriginPresent = 0x1;
+constexpr std::uint8_t kOriginHasAltitude = 0x2;
+
+/**
+ * @brief offset を kColumnAlignment の倍数に切り上げる
+ */
+constexpr std::size_t alignColumn(std::size_t offset) {
+  return (offset + kColumnAlignment - 1) / kColumnAlignment * kColumnAlignment;
+}
+
+[[noreturn]] void throwInvalid(const char* reason) {
+  throw std::invalid_argument(std::string("ColumnarReader: ") + reason);
+}
+}  // namespace
+
+ColumnarHeader makeColumnarHeader(const ColumnarMetadata& metadata,
+                                  std::size_t pointCount) {
+  if (metadata.frame == CoordinateFrame::ENU && !metadata.origin) {
+    throw std::invalid_argument(
+        "makeColumnarHeader requires an origin for ENU coordinates.");
+  }
+
+  ColumnarHeader header{};
+  std::memcpy(header.magic, kColumnarMagic, sizeof(header.magic));
+  header.version = kColumnarVersion;
+  header.headerSize = sizeof(ColumnarHeader);
+  header.byteOrderMark = kColumnarByteOrderMark;
+  header.frame = static_cast<std::uint8_t>(metadata.frame);
+  header.columnType = static_cast<std::uint8_t>(ColumnType::Float64);
+  header.columnCount = kColumnCount;
+  header.pointCount = pointCount;
+  header.ellipsoidA = metadata.ellipsoid.a;
+  header.ellipsoidF = metadata.ellipsoid.f;
+  if (metadata.frame == CoordinateFrame::ENU) {
+    const auto& origin = *metadata.origin;
+    header.originFlags = kOriginPresent;
+    header.origin[0] = origin.getLatitude();
+    header.origin[1] = origin.getLongitude();
+    if (origin.getAltitude()) {
+      header.originFlags |= kOriginHasAltitude;
+      header.origin[2] = *origin.getAltitude();
+    }
+  }
+
+  std::size_t offset = alignColumn(sizeof(ColumnarHeader));
+  for (std::size_t k = 0; k < kColumnCount; ++k) {
+    header.columnOffsets[k] = offset;
+    offset = alignColumn(offset + pointCount * sizeof(double));
+  }
+  return header;
+}
+
+std::size_t columnarByteSize(std::size_t pointCount) noexcept {
+  std::size_t offset = alignColumn(sizeof(ColumnarHeader));
+  for (std::size_t k = 0; k < kColumnCount; ++k) {
+    offset = alignColumn(offset + pointCount * sizeof(double));
+  }
+  return offset;
+}
+
+ColumnarLayout parseColumnarHeader(std::span<const std::byte> bytes,
+                                   std::uint64_t totalSize) {
+  if (bytes.size() < sizeof(ColumnarHeader) ||
+      totalSize < sizeof(ColumnarHeader)) {
+    throwInvalid("buffer is smaller than the header");
+  }
+  ColumnarHeader header;
+  std::memcpy(&header, bytes.data(), sizeof(header));
+
+  if (std::memcmp(header.magic, kColumnarMagic, sizeof(header.magic)) != 0) {
+    throwInvalid("bad magic");
+  }
+  if (header.byteOrderMark != kColumnarByteOrderMark) {
+    throwInvalid("unsupported byte order");
+  }
+  if (header.version != kColumnarVersion) {
+    throwInvalid("unsupported version");
+  }
+  if (header.headerSize < sizeof(ColumnarHeader) ||
+      header.columnCount != kColumnCount ||
+      header.columnType != static_cast<std::uint8_t>(ColumnType::Float64)) {
+    throwInvalid("unsupported column layout");
+  }
+  if (header.frame < static_cast<std::uint8_t>(CoordinateFrame::Geo) ||
+      header.frame > static_cast<std::uint8_t>(CoordinateFrame::ENU)) {
+    throwInvalid("unknown coordinate frame");
+  }
+  CoordinateFrame frame = static_cast<CoordinateFrame>(header.frame);
+  if (frame == CoordinateFrame::ENU &&
+      !(header.originFlags & kOriginPresent)) {
+    throwInvalid("ENU data without origin");
+  }
+
+  // 列の範囲がファイル内に収まることを、乗算のオーバーフローを避けて検証
+  if (header.pointCount > totalSize / sizeof(double)) {
+    throwInvalid("point count exceeds buffer size");
+  }
+  ColumnarLayout layout{
+      {frame,
+       trans_geo::ellipsoid::Ellipsoid(header.ellipsoidA, header.ellipsoidF),
+       std::nullopt},
+      static_cast<std::size_t>(header.pointCount),
+      {}};
+  const std::uint64_t columnBytes = header.pointCount * sizeof(double);
+  for (std::size_t k = 0; k < kColumnCount; ++k) {
+    std::uint64_t offset = header.columnOffsets[k];
+    if (offset < header.headerSize || offset > totalSize ||
+        totalSize - offset < columnBytes) {
+      throwInvalid("column lies outside the buffer");
+    }
+    if (offset % alignof(double) != 0) {
+      throwInvalid("column is not aligned for zero-copy access");
+    }
+    layout.columnOffsets[k] = offset;
+  }
+
+  if (frame == CoordinateFrame::ENU) {
+    if (header.originFlags & kOriginHasAltitude) {
+      layout.metadata.origin.emplace(header.origin[0], header.origin[1],
+                                     header.origin[2]);
+    } else {
+      layout.metadata.origin.emplace(header.origin[0], header.origin[1]);
+    }
+  }
+  return layout;
+}
+
+std::vector<std::byte> serializeColumnar(
+    const ColumnarMetadata& metadata,
+    trans_geo::coordinate::ConstPointView points) {
+  if (metadata.frame == CoordinateFrame::ENU && !metadata.origin) {
+    throw std::invalid_argument(
+        "serializeColumnar requires an origin for ENU coordinates.");
+  }
+  if (!points.hasData()) {
+    throw std::invalid_argument(
+        "serializeColumnar requires non-null component pointers.");
+  }
+  // 列はホストのバイト順のまま書き出すため、リトルエンディアンに限定する
+  if constexpr (std::endian::native != std::endian::little) {
+    throw std::runtime_error(
+        "serializeColumnar requires a little-endian host.");
+  }
+
+  const std::size_t n = points.size();
+  const std::size_t columnBytes = n * sizeof(double);
+  ColumnarHeader header = makeColumnarHeader(metadata, n);
+
+  std::vector<std::byte> buffer(columnarByteSize(n));
+  std::memcpy(buffer.data(), &header, sizeof(header));
+  for (std::size_t k = 0; k < kColumnCount && n > 0; ++k) {
+    double* column =
+        reinterpret_cast<double*>(buffer.data() + header.columnOffsets[k]);
+    if (points.stride() == 1) {
+      std::memcpy(column, points.component(k), columnBytes);
+    } else {
+      for (std::size_t i = 0; i < n; ++i) {
+        column[i] = points(i, k);
+      }
+    }
+  }
+  return buffer;
+}
+
+void writeColumnarFile(const std::string& path,
+                       const ColumnarMetadata& metadata,
+                       trans_geo::coordinate::ConstPointView points) {
+  std::vector<std::byte> buffer = serializeColumnar(metadata, points);
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char*>(buffer.data()),
+            static_cast<std::streamsize>(buffer.size()));
+  if (!out) {
+    throw std::runtime_error("writeColumnarFile: cannot write " + path);
+  }
+}
+
+ColumnarReader::ColumnarReader(std::span<const std::byte> buffer)
+    : frame_(CoordinateFrame::Geo),
+      ellipsoid_(trans_geo::ellipsoid::WGS84),
+      size_(0),
+      columns_{} {
+  ColumnarLayout layout = parseColumnarHeader(buffer, buffer.size());
+  for (std::size_t k = 0; k < kColumnCount; ++k) {
+    const std::byte* column = buffer.data() + layout.columnOffsets[k];
+    if (reinterpret_cast<std::uintptr_t>(column) % alignof(double) != 0) {
+      throwInvalid("column is not aligned for zero-copy access");
+    }
+    columns_[k] = reinterpret_cast<const double*>(column);
+  }
+  frame_ = layout.metadata.frame;
+  ellipsoid_ = layout.metadata.ellipsoid;
+  origin_ = layout.metadata.origin;
+  size_ = layout.pointCount;
+}
+
+CoordinateFrame ColumnarReader::getFrame() const noexcept { return frame_; }
+
+trans_geo::ellipsoid::Ellipsoid ColumnarReader::getEllipsoid() const noexcept {
+  return ellipsoid_;
+}
+
+const std::optional<trans_geo::coordinate::GeoCoordinate>&
+ColumnarReader::getOrigin() const noexcept {
+  return origin_;
+}
+
+std::size_t ColumnarReader::size() const noexcept { return size_; }
+
+std::span<const double> ColumnarReader::getColumn(
+    std::size_t k) const noexcept {
+  return {columns_[k], size_};
+}
+
+trans_geo::coordinate::ConstPointView ColumnarReader::getPoints()
+    const noexcept {
+  return trans_geo::coordinate::ConstPointView::columns(
+      columns_[0], columns_[1], columns_[2], size_);
+}
+
+}  // namespace trans_geo::io
@@ -0,0 +1,83 @@
+#include "io/mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+namespace trans_geo::io {
+namespace {
+[[noreturn]] void throwSystemError(const std::string& what) {
+  throw std::system_error(errno, std::generic_category(), what);
+}
+}  // namespace
+
+MappedFile::MappedFile(const std::string& path) {
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throwSystemError("MappedFile: cannot open " + path);
+  }
+
+  struct stat st{};
+  if (::fstat(fd, &st) != 0) {
+    int error = errno;
+    ::close(fd);
+    errno = error;
+    throwSystemError("MappedFile: cannot stat " + path);
+  }
+
+  size_ = static_cast<std::size_t>(st.st_size);
+  if (size_ > 0) {
+    void* mapped = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped == MAP_FAILED) {
+      int error = errno;
+      ::close(fd);
+      errno = error;
+      throwSystemError("MappedFile: cannot map " + path);
+    }
+    data_ = static_cast<const std::byte*>(mapped);
+  }
+  // マップ後はファイル記述子を保持する必要がない
+  ::close(fd);
+}
+
+MappedFile::~MappedFile() { release(); }
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+  if (this != &other) {
+    release();
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+  }
+  return *this;
+}
+
+std::span<const std::byte> MappedFile::bytes() const noexcept {
+  return {data_, size_};
+}
+
+std::size_t MappedFile::size() const noexcept { return size_; }
+
+void MappedFile::adviseRandomAccess() const noexcept {
+  if (data_ != nullptr) {
+    ::madvise(const_cast<std::byte*>(data_), size_, MADV_RANDOM);
+  }
+}
+
+void MappedFile::release() noexcept {
+  if (data_ != nullptr) {
+    ::munmap(const_cast<std::byte*>(data_), size_);
+    data_ = nullptr;
+    size_ = 0;
+  }
+}
+
+}  // namespace trans_geo::io
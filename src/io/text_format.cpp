@@ -0,0 +1,55 @@
+#include "io/text_format.hpp"
+
+#include <charconv>
+#include <system_error>
+
+namespace trans_geo::io {
+namespace {
+/**
+ * @brief 1 つの値を [first, last) に書き込む
+ *
+ * @return char* 書き込んだ末尾。収まらない場合は nullptr
+ */
+char* formatValue(char* first, char* last, double value,
+                  int precision) noexcept {
+  std::to_chars_result result =
+      precision == kShortestRoundTrip
+          ? std::to_chars(first, last, value)
+          : std::to_chars(first, last, value, std::chars_format::fixed,
+                          precision);
+  return result.ec == std::errc() ? result.ptr : nullptr;
+}
+}  // namespace
+
+FormatResult formatPoints(trans_geo::coordinate::ConstPointView points,
+                          std::span<char> buffer,
+                          const TextFormatOptions& options) noexcept {
+  FormatResult result;
+  if (!points.hasData()) {
+    return result;
+  }
+
+  char* cursor = buffer.data();
+  char* const last = buffer.data() + buffer.size();
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    char* out = cursor;
+    for (std::size_t k = 0; k < 3; ++k) {
+      out = formatValue(out, last, points(i, k), options.precision);
+      if (out == nullptr || out == last) {
+        out = nullptr;
+        break;
+      }
+      *out++ = k < 2 ? options.delimiter : options.terminator;
+    }
+    if (out == nullptr) {
+      // 途中まで書き込んだ点は結果に含めない
+      break;
+    }
+    cursor = out;
+    ++result.points;
+  }
+  result.bytes = static_cast<std::size_t>(cursor - buffer.data());
+  return result;
+}
+
+}  // namespace trans_geo::io
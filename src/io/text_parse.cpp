@@ -0,0 +1,176 @@
+#include "io/text_parse.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <system_error>
+
+namespace trans_geo::io {
+namespace {
+bool isBlank(char c, char delimiter) {
+  return (c == ' ' || c == '\t') && c != delimiter;
+}
+
+/**
+ * @brief 列の前後の空白・タブを取り除く（区切り文字は除く）
+ */
+std::string_view trim(std::string_view field, char delimiter) {
+  while (!field.empty() && isBlank(field.front(), delimiter)) {
+    field.remove_prefix(1);
+  }
+  while (!field.empty() && isBlank(field.back(), delimiter)) {
+    field.remove_suffix(1);
+  }
+  return field;
+}
+
+/// 区切り文字が空白・タブの場合に 1 つの区切りとしてまとめる文字
+constexpr std::string_view kBlanks = " \t";
+
+/**
+ * @brief pos 以降で最初の空白・タブでない位置（なければ行末）
+ */
+std::size_t skipBlanks(std::string_view line, std::size_t pos) {
+  std::size_t next = line.find_first_not_of(kBlanks, pos);
+  return next == std::string_view::npos ? line.size() : next;
+}
+
+/**
+ * @brief 列全体を 1 つの数値として解析する
+ */
+bool parseNumber(std::string_view field, double& value) {
+  // std::from_chars は先頭の '+' を受け付けない
+  if (!field.empty() && field.front() == '+') {
+    field.remove_prefix(1);
+  }
+  if (field.empty()) {
+    return false;
+  }
+  const char* last = field.data() + field.size();
+  std::from_chars_result result = std::from_chars(field.data(), last, value);
+  return result.ec == std::errc() && result.ptr == last;
+}
+
+/**
+ * @brief 1 行を解析して 3 成分を取り出す
+ *
+ * @return bool 成功した場合は true。失敗時は error に成分と種類を設定する
+ */
+bool parseRow(std::string_view line, const TextParseOptions& options,
+              std::size_t maxColumn, std::array<double, 3>& values,
+              ParseError& error) {
+  std::array<bool, 3> found{};
+  for (std::size_t k = 0; k < 3; ++k) {
+    if (options.columns[k] == kNoColumn) {
+      values[k] = options.fillValue;
+      found[k] = true;
+    }
+  }
+
+  // 空白区切りでは桁揃えの連続した空白・タブを 1 つの区切りとし、
+  // 行頭・行末の空白は列に数えない
+  const bool blankDelimited =
+      options.delimiter == ' ' || options.delimiter == '\t';
+  std::size_t begin = blankDelimited ? skipBlanks(line, 0) : 0;
+  for (std::size_t field = 0; field <= maxColumn; ++field) {
+    std::size_t end = blankDelimited ? line.find_first_of(kBlanks, begin)
+                                     : line.find(options.delimiter, begin);
+    if (end == std::string_view::npos) {
+      end = line.size();
+    }
+    for (std::size_t k = 0; k < 3; ++k) {
+      if (options.columns[k] != field) {
+        continue;
+      }
+      std::string_view text =
+          trim(line.substr(begin, end - begin), options.delimiter);
+      if (!parseNumber(text, values[k])) {
+        error.component = k;
+        error.kind = ParseErrorKind::InvalidNumber;
+        return false;
+      }
+      found[k] = true;
+    }
+    begin = blankDelimited ? skipBlanks(line, end) : end + 1;
+    if (end == line.size() || (blankDelimited && begin == line.size())) {
+      break;
+    }
+  }
+
+  for (std::size_t k = 0; k < 3; ++k) {
+    if (!found[k]) {
+      error.component = k;
+      error.kind = ParseErrorKind::MissingField;
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+ParseReport parsePoints(std::string_view text,
+                        trans_geo::coordinate::PointView output,
+                        const TextParseOptions& options) {
+  ParseReport report;
+  if (!output.hasData()) {
+    return report;
+  }
+
+  std::size_t maxColumn = 0;
+  for (std::size_t column : options.columns) {
+    if (column != kNoColumn) {
+      maxColumn = std::max(maxColumn, column);
+    }
+  }
+
+  std::size_t pos = 0;
+  while (pos < text.size() && report.points < output.size()) {
+    std::size_t newline = text.find('\n', pos);
+    std::size_t lineEnd =
+        newline == std::string_view::npos ? text.size() : newline;
+    std::string_view line = text.substr(pos, lineEnd - pos);
+    if (!line.empty() && line.back() == '\r') {
+      line.remove_suffix(1);
+    }
+    pos = newline == std::string_view::npos ? text.size() : newline + 1;
+    report.consumedBytes = pos;
+    ++report.linesRead;
+
+    if (report.linesRead <= options.skipLines) {
+      continue;
+    }
+    std::string_view content = trim(line, options.delimiter);
+    if (content.empty() ||
+        (options.comment != '\0' && content.front() == options.comment)) {
+      continue;
+    }
+
+    std::array<double, 3> values{};
+    ParseError error{report.linesRead, 0, ParseErrorKind::MissingField};
+    if (parseRow(line, options, maxColumn, values, error)) {
+      output.set(report.points++, values);
+    } else {
+      ++report.malformedRows;
+      if (report.errors.size() < options.maxReportedErrors) {
+        report.errors.push_back(error);
+      }
+    }
+  }
+  return report;
+}
+
+ParseReport parsePoints(std::string_view text,
+                        trans_geo::coordinate::PointBuffer& output,
+                        const TextParseOptions& options) {
+  // 行数を上限として一度に確保し、解析後に実際の点数へ縮める
+  std::size_t capacity =
+      static_cast<std::size_t>(std::count(text.begin(), text.end(), '\n')) +
+      1;
+  std::size_t base = output.size();
+  output.resize(base + capacity);
+  ParseReport report =
+      parsePoints(text, output.view().subview(base, capacity), options);
+  output.resize(base + report.points);
+  return report;
+}
+
+}  // namespace trans_geo::io
@@ -0,0 +1,110 @@
+#include "kernel/batch_dispatch.hpp"
+
+#include <cstdlib>
+#include <string_view>
+
+namespace trans_geo::kernel {
+// 各版のカーネル表（batch_kernels_<isa>.cpp で定義）
+namespace generic {
+extern const BatchKernels kBatchKernels;
+}  // namespace generic
+#if defined(TRANSGEO_ENABLE_ISA_DISPATCH)
+namespace avx2 {
+extern const BatchKernels kBatchKernels;
+}  // namespace avx2
+namespace avx512 {
+extern const BatchKernels kBatchKernels;
+}  // namespace avx512
+#endif
+
+namespace {
+/**
+ * @brief 環境変数 TRANSGEO_FORCE_ISA で指定された版を選ぶ
+ *
+ * @return const BatchKernels* 指定された版。未指定・未対応の場合は nullptr
+ */
+const BatchKernels* forcedKernels() noexcept {
+  const char* value = std::getenv("TRANSGEO_FORCE_ISA");
+  if (value == nullptr) {
+    return nullptr;
+  }
+  std::string_view name(value);
+  for (Isa isa : {Isa::Generic, Isa::Avx2, Isa::Avx512}) {
+    if (name == isaName(isa)) {
+      return batchKernelsFor(isa);
+    }
+  }
+  return nullptr;
+}
+
+const BatchKernels& selectKernels() noexcept {
+  if (const BatchKernels* forced = forcedKernels()) {
+    return *forced;
+  }
+  for (Isa isa : {Isa::Avx512, Isa::Avx2}) {
+    if (const BatchKernels* kernels = batchKernelsFor(isa)) {
+      return *kernels;
+    }
+  }
+  return generic::kBatchKernels;
+}
+}  // namespace
+
+const char* isaName(Isa isa) noexcept {
+  switch (isa) {
+    case Isa::Generic:
+      return "generic";
+    case Isa::Avx2:
+      return "avx2";
+    case Isa::Avx512:
+      return "avx512";
+  }
+  return "unknown";
+}
+
+bool isaSupported(Isa isa) noexcept {
+  switch (isa) {
+    case Isa::Generic:
+      return true;
+#if defined(TRANSGEO_ENABLE_ISA_DISPATCH)
+    // __builtin_cpu_supports は OS が拡張レジスタを保存するかも確認する
+    case Isa::Avx2:
+      return __builtin_cpu_supports("avx2");
+    case Isa::Avx512:
+      return __builtin_cpu_supports("avx512f") &&
+             __builtin_cpu_supports("avx512dq") &&
+             __builtin_cpu_supports("avx512vl");
+#else
+    case Isa::Avx2:
+    case Isa::Avx512:
+      return false;
+#endif
+  }
+  return false;
+}
+
+const BatchKernels* batchKernelsFor(Isa isa) noexcept {
+  if (!isaSupported(isa)) {
+    return nullptr;
+  }
+  switch (isa) {
+    case Isa::Generic:
+      return &generic::kBatchKernels;
+#if defined(TRANSGEO_ENABLE_ISA_DISPATCH)
+    case Isa::Avx2:
+      return &avx2::kBatchKernels;
+    case Isa::Avx512:
+      return &avx512::kBatchKernels;
+#endif
+    default:
+      return nullptr;
+  }
+}
+
+const BatchKernels& batchKernels() noexcept {
+  // 初回の呼び出しで一度だけ選ぶ（以後は関数ポインタの表を引くだけ）
+  static const BatchKernels& kernels = selectKernels();
+  return kernels;
+}
+
+}  // namespace trans_geo::kernel
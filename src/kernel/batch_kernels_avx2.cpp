@@ -0,0 +1,6 @@
+// AVX2 でビルドする一括変換カーネル（CMake で -mavx2 を指定する）
+#if defined(TRANSGEO_ENABLE_ISA_DISPATCH)
+#define TRANSGEO_BATCH_ISA avx2
+#define TRANSGEO_BATCH_ISA_VALUE Isa::Avx2
+#include "batch_kernels.inc"
+#endif
@@ -0,0 +1,7 @@
+// AVX-512 でビルドする一括変換カーネル
+// （CMake で -mavx512f -mavx512dq -mavx512vl を指定する）
+#if defined(TRANSGEO_ENABLE_ISA_DISPATCH)
+#define TRANSGEO_BATCH_ISA avx512
+#define TRANSGEO_BATCH_ISA_VALUE Isa::Avx512
+#include "batch_kernels.inc"
+#endif
@@ -0,0 +1,4 @@
+// ビルド時の既定の命令セットでビルドする一括変換カーネル
+#define TRANSGEO_BATCH_ISA generic
+#define TRANSGEO_BATCH_ISA_VALUE Isa::Generic
+#include "batch_kernels.inc"
@@ -0,0 +1,205 @@
+#include "parallel/numa_executor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#if defined(TRANSGEO_HAVE_LIBNUMA)
+#include <numa.h>
+#endif
+
+#include "parallel/numa_point_buffer.hpp"  // NumaPointBuffer の定義
+
+namespace trans_geo::parallel {
+namespace {
+using trans_geo::conversion::ConversionStatus;
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief すべての CPU を持つ 1 つのノード（libnuma を使わない場合）
+ */
+std::vector<NumaNode> singleNode() {
+  NumaNode node{0, {}};
+  unsigned count = std::max(1u, std::thread::hardware_concurrency());
+  for (unsigned cpu = 0; cpu < count; ++cpu) {
+    node.cpus.push_back(static_cast<int>(cpu));
+  }
+  return {node};
+}
+
+/**
+ * @brief 呼び出したスレッドを CPU に固定する
+ */
+void pinToCpu([[maybe_unused]] int cpu) {
+#if defined(TRANSGEO_HAVE_LIBNUMA)
+  struct bitmask* mask = numa_allocate_cpumask();
+  numa_bitmask_setbit(mask, static_cast<unsigned>(cpu));
+  numa_sched_setaffinity(0, mask);
+  numa_free_cpumask(mask);
+#endif
+}
+
+/**
+ * @brief convert() でスレッドが取り出す変換の単位
+ */
+struct Block {
+  std::size_t chunk;
+  std::size_t offset;
+  std::size_t points;
+};
+}  // namespace
+
+NumaTopology NumaTopology::detect() {
+#if defined(TRANSGEO_HAVE_LIBNUMA)
+  if (numa_available() >= 0) {
+    std::vector<NumaNode> nodes;
+    struct bitmask* cpus = numa_allocate_cpumask();
+    for (int id = 0; id <= numa_max_node(); ++id) {
+      if (numa_node_to_cpus(id, cpus) != 0) {
+        continue;
+      }
+      NumaNode node{id, {}};
+      for (unsigned cpu = 0; cpu < cpus->size; ++cpu) {
+        if (numa_bitmask_isbitset(cpus, cpu)) {
+          node.cpus.push_back(static_cast<int>(cpu));
+        }
+      }
+      // CPU のないノード（メモリのみのノード）は使わない
+      if (!node.cpus.empty()) {
+        nodes.push_back(std::move(node));
+      }
+    }
+    numa_free_cpumask(cpus);
+    if (!nodes.empty()) {
+      return NumaTopology(std::move(nodes), true);
+    }
+  }
+#endif
+  return NumaTopology(singleNode(), false);
+}
+
+NumaTopology::NumaTopology(std::vector<NumaNode> nodes, bool libnuma)
+    : nodes_(std::move(nodes)), libnuma_(libnuma) {
+  if (nodes_.empty()) {
+    throw std::invalid_argument("NumaTopology requires at least one node.");
+  }
+  for (const NumaNode& node : nodes_) {
+    if (node.cpus.empty()) {
+      throw std::invalid_argument(
+          "NumaTopology requires at least one CPU per node.");
+    }
+  }
+#if !defined(TRANSGEO_HAVE_LIBNUMA)
+  libnuma_ = false;
+#endif
+}
+
+NumaExecutor::NumaExecutor(NumaExecutorOptions options)
+    : NumaExecutor(NumaTopology::detect(), options) {}
+
+NumaExecutor::NumaExecutor(NumaTopology topology, NumaExecutorOptions options)
+    : topology_(std::move(topology)), options_(options) {
+  if (options_.blockPoints == 0) {
+    throw std::invalid_argument(
+        "NumaExecutor requires a non-zero blockPoints.");
+  }
+}
+
+std::size_t NumaExecutor::getThreadCount(std::size_t node) const noexcept {
+  return options_.threadsPerNode != 0
+             ? options_.threadsPerNode
+             : topology_.getNodes()[node].cpus.size();
+}
+
+void NumaExecutor::runOnNodes(
+    const std::function<void(std::size_t, std::size_t, std::size_t)>& task)
+    const {
+  const std::vector<NumaNode>& nodes = topology_.getNodes();
+  bool pin = topology_.usesLibnuma() && options_.pinThreads;
+  std::vector<std::jthread> workers;
+  for (std::size_t node = 0; node < nodes.size(); ++node) {
+    std::size_t threads = getThreadCount(node);
+    for (std::size_t t = 0; t < threads; ++t) {
+      int cpu = nodes[node].cpus[t % nodes[node].cpus.size()];
+      workers.emplace_back([&task, node, t, threads, cpu, pin] {
+        if (pin) {
+          pinToCpu(cpu);
+        }
+        task(node, t, threads);
+      });
+    }
+  }
+  // jthread のデストラクタですべてのスレッドと合流する
+}
+
+NumaRunReport NumaExecutor::convert(
+    const trans_geo::conversion::ICoordinateConverter& converter,
+    const NumaPointBuffer& input, NumaPointBuffer& output) const {
+  NumaRunReport report;
+  if (input.size() != output.size() ||
+      input.getChunkPoints() != output.getChunkPoints()) {
+    report.status = ConversionStatus::SizeMismatch;
+    return report;
+  }
+
+  // ノードごとに、そのノードの（出力）チャンクを blockPoints 点ずつに分ける
+  const std::vector<NumaNode>& nodes = topology_.getNodes();
+  std::vector<std::vector<Block>> blocks(nodes.size());
+  for (std::size_t c = 0; c < output.getChunkCount(); ++c) {
+    std::size_t points = output.chunk(c).size();
+    for (std::size_t offset = 0; offset < points;
+         offset += options_.blockPoints) {
+      blocks[output.getChunkNode(c) % nodes.size()].push_back(
+          {c, offset, std::min(options_.blockPoints, points - offset)});
+    }
+  }
+
+  std::vector<std::atomic<std::size_t>> next(nodes.size());
+  std::vector<std::atomic<std::size_t>> converted(nodes.size());
+  std::vector<std::atomic<Clock::rep>> finished(nodes.size());
+  std::atomic<int> failure{static_cast<int>(ConversionStatus::Ok)};
+  Clock::time_point start = Clock::now();
+  runOnNodes([&](std::size_t node, std::size_t, std::size_t) {
+    std::size_t points = 0;
+    for (std::size_t b = next[node]++; b < blocks[node].size();
+         b = next[node]++) {
+      const Block& block = blocks[node][b];
+      ConversionStatus status = converter.convertBatch(
+          input.chunk(block.chunk).subview(block.offset, block.points),
+          output.chunk(block.chunk).subview(block.offset, block.points));
+      if (status != ConversionStatus::Ok) {
+        int ok = static_cast<int>(ConversionStatus::Ok);
+        failure.compare_exchange_strong(ok, static_cast<int>(status));
+        continue;
+      }
+      points += block.points;
+    }
+    converted[node] += points;
+    // ノードの所要時間は、最後に終わったスレッドの終了時刻で決まる
+    Clock::rep end = (Clock::now() - start).count();
+    Clock::rep previous = finished[node].load();
+    while (previous < end &&
+           !finished[node].compare_exchange_weak(previous, end)) {
+    }
+  });
+  report.seconds =
+      std::chrono::duration<double>(Clock::now() - start).count();
+
+  report.status = static_cast<ConversionStatus>(failure.load());
+  for (std::size_t node = 0; node < nodes.size(); ++node) {
+    double seconds =
+        std::chrono::duration<double>(Clock::duration(finished[node].load()))
+            .count();
+    std::size_t points = converted[node].load();
+    report.points += points;
+    report.nodes.push_back(
+        {nodes[node].id, getThreadCount(node), points, seconds,
+         seconds > 0.0 ? static_cast<double>(points) / seconds : 0.0});
+  }
+  return report;
+}
+
+}  // namespace trans_geo::parallel
@@ -0,0 +1,162 @@
+#include "parallel/numa_point_buffer.hpp"
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+
+#if defined(TRANSGEO_HAVE_LIBNUMA)
+#include <numa.h>
+#endif
+
+namespace trans_geo::parallel {
+namespace {
+using trans_geo::coordinate::ConstPointView;
+using trans_geo::coordinate::PointView;
+
+/**
+ * @brief チャンクの領域（3 * points 要素）を確保する
+ */
+double* allocateChunk(std::size_t points, [[maybe_unused]] int nodeId,
+                      [[maybe_unused]] bool libnuma) {
+  std::size_t bytes = 3 * points * sizeof(double);
+#if defined(TRANSGEO_HAVE_LIBNUMA)
+  if (libnuma) {
+    void* data = numa_alloc_onnode(bytes, nodeId);
+    if (data == nullptr) {
+      throw std::bad_alloc();
+    }
+    return static_cast<double*>(data);
+  }
+#endif
+  // 0 初期化はファーストタッチとしてノードのスレッドで行う
+  return static_cast<double*>(::operator new(bytes));
+}
+
+/**
+ * @brief allocateChunk() で確保した領域を解放する
+ */
+void freeChunk(double* data, std::size_t points,
+               [[maybe_unused]] bool libnuma) noexcept {
+#if defined(TRANSGEO_HAVE_LIBNUMA)
+  if (libnuma) {
+    numa_free(data, 3 * points * sizeof(double));
+    return;
+  }
+#endif
+  (void)points;
+  ::operator delete(data);
+}
+}  // namespace
+
+template <typename Task>
+void NumaPointBuffer::forEachLocalChunk(Task&& task) const {
+  // ノードのスレッドで、そのノードの各チャンクを均等に分けて処理する
+  executor_.runOnNodes([&](std::size_t node, std::size_t thread,
+                           std::size_t threadCount) {
+    for (const Chunk& chunk : chunks_) {
+      if (chunk.node != node) {
+        continue;
+      }
+      std::size_t begin = chunk.points * thread / threadCount;
+      std::size_t end = chunk.points * (thread + 1) / threadCount;
+      task(chunk, begin, end);
+    }
+  });
+}
+
+NumaPointBuffer::NumaPointBuffer(const NumaExecutor& executor,
+                                 std::size_t size, std::size_t chunkPoints)
+    : executor_(executor), size_(size), chunkPoints_(chunkPoints) {
+  if (chunkPoints_ == 0) {
+    throw std::invalid_argument(
+        "NumaPointBuffer requires a non-zero chunkPoints.");
+  }
+  const NumaTopology& topology = executor_.getTopology();
+  std::size_t nodes = topology.getNodes().size();
+  std::size_t count = (size_ + chunkPoints_ - 1) / chunkPoints_;
+  chunks_.reserve(count);
+  try {
+    for (std::size_t c = 0; c < count; ++c) {
+      // ノード k には連続したチャンクの区間 [k*count/nodes, (k+1)*count/nodes)
+      std::size_t node = c * nodes / count;
+      std::size_t points = std::min(chunkPoints_, size_ - c * chunkPoints_);
+      chunks_.push_back({allocateChunk(points, topology.getNodes()[node].id,
+                                       topology.usesLibnuma()),
+                         points, node});
+    }
+  } catch (...) {
+    for (const Chunk& chunk : chunks_) {
+      freeChunk(chunk.data, chunk.points, topology.usesLibnuma());
+    }
+    throw;
+  }
+
+  // 各ノードのスレッドが最初に書き込み、ページをそのノードに置く
+  forEachLocalChunk([](const Chunk& chunk, std::size_t begin, std::size_t end) {
+    for (std::size_t k = 0; k < 3; ++k) {
+      std::fill(chunk.data + k * chunk.points + begin,
+                chunk.data + k * chunk.points + end, 0.0);
+    }
+  });
+}
+
+NumaPointBuffer::~NumaPointBuffer() {
+  for (const Chunk& chunk : chunks_) {
+    freeChunk(chunk.data, chunk.points, executor_.getTopology().usesLibnuma());
+  }
+}
+
+PointView NumaPointBuffer::chunk(std::size_t chunk) noexcept {
+  const Chunk& c = chunks_[chunk];
+  return PointView::columns(c.data, c.data + c.points, c.data + 2 * c.points,
+                            c.points);
+}
+
+ConstPointView NumaPointBuffer::chunk(std::size_t chunk) const noexcept {
+  const Chunk& c = chunks_[chunk];
+  return ConstPointView::columns(c.data, c.data + c.points,
+                                 c.data + 2 * c.points, c.points);
+}
+
+std::array<double, 3> NumaPointBuffer::get(std::size_t i) const noexcept {
+  return chunk(i / chunkPoints_).get(i % chunkPoints_);
+}
+
+void NumaPointBuffer::set(std::size_t i,
+                          const std::array<double, 3>& values) noexcept {
+  chunk(i / chunkPoints_).set(i % chunkPoints_, values);
+}
+
+void NumaPointBuffer::assign(ConstPointView source) {
+  if (source.size() != size_) {
+    throw std::invalid_argument("NumaPointBuffer::assign size mismatch.");
+  }
+  forEachLocalChunk([&](const Chunk& chunk, std::size_t begin,
+                        std::size_t end) {
+    std::size_t first = static_cast<std::size_t>(&chunk - chunks_.data()) *
+                        chunkPoints_;
+    for (std::size_t k = 0; k < 3; ++k) {
+      for (std::size_t i = begin; i < end; ++i) {
+        chunk.data[k * chunk.points + i] = source(first + i, k);
+      }
+    }
+  });
+}
+
+void NumaPointBuffer::copyTo(PointView destination) const {
+  if (destination.size() != size_) {
+    throw std::invalid_argument("NumaPointBuffer::copyTo size mismatch.");
+  }
+  forEachLocalChunk([&](const Chunk& chunk, std::size_t begin,
+                        std::size_t end) {
+    std::size_t first = static_cast<std::size_t>(&chunk - chunks_.data()) *
+                        chunkPoints_;
+    for (std::size_t k = 0; k < 3; ++k) {
+      for (std::size_t i = begin; i < end; ++i) {
+        destination(first + i, k) = chunk.data[k * chunk.points + i];
+      }
+    }
+  });
+}
+
+}  // namespace trans_geo::parallel
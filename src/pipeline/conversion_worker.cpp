@@ -0,0 +1,89 @@
+#include "pipeline/conversion_worker.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+#include "converter/conversion_status.hpp"  // ConversionStatus の定義
+#include "coordinate/point_buffer.hpp"      // PointBuffer の定義
+
+namespace trans_geo::pipeline {
+
+ConversionWorker::ConversionWorker(
+    const trans_geo::conversion::ICoordinateConverter& converter,
+    MpscRing<TaggedPoint>& input, SpscRing<TaggedPoint>& output,
+    std::size_t maxBatch)
+    : converter_(converter),
+      input_(input),
+      output_(output),
+      maxBatch_(maxBatch) {
+  if (maxBatch == 0) {
+    throw std::invalid_argument(
+        "ConversionWorker requires a positive batch size.");
+  }
+}
+
+ConversionWorker::~ConversionWorker() { stop(); }
+
+void ConversionWorker::start() {
+  if (thread_.joinable()) {
+    return;
+  }
+  thread_ = std::jthread([this](std::stop_token token) { run(token); });
+}
+
+void ConversionWorker::stop() {
+  if (thread_.joinable()) {
+    thread_.request_stop();
+    thread_.join();
+  }
+}
+
+std::uint64_t ConversionWorker::getConvertedCount() const noexcept {
+  return converted_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t ConversionWorker::getDroppedCount() const noexcept {
+  return dropped_.load(std::memory_order_relaxed);
+}
+
+void ConversionWorker::run(std::stop_token stopToken) {
+  // 作業領域はスレッド起動時に一度だけ確保する
+  std::vector<TaggedPoint> batch(maxBatch_);
+  trans_geo::coordinate::PointBuffer points(maxBatch_);
+
+  for (;;) {
+    std::size_t n = input_.popBatch(batch.data(), maxBatch_);
+    if (n == 0) {
+      if (stopToken.stop_requested()) {
+        return;
+      }
+      std::this_thread::yield();
+      continue;
+    }
+
+    trans_geo::coordinate::PointView view = points.view().subview(0, n);
+    for (std::size_t i = 0; i < n; ++i) {
+      view.set(i, batch[i].values);
+    }
+    if (converter_.convertBatch(view, view) !=
+        trans_geo::conversion::ConversionStatus::Ok) {
+      dropped_.fetch_add(n, std::memory_order_relaxed);
+      continue;
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+      TaggedPoint result{view.get(i), batch[i].tag};
+      while (!output_.tryPush(result)) {
+        if (stopToken.stop_requested()) {
+          converted_.fetch_add(i, std::memory_order_relaxed);
+          dropped_.fetch_add(n - i, std::memory_order_relaxed);
+          return;
+        }
+        std::this_thread::yield();
+      }
+    }
+    converted_.fetch_add(n, std::memory_order_relaxed);
+  }
+}
+
+}  // namespace trans_geo::pipeline
@@ -0,0 +1,93 @@
+#include "pipeline/point_channel.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace trans_geo::pipeline {
+
+PointChannel::PointChannel(std::size_t capacity) : ring_(capacity) {
+  if (capacity == 0) {
+    throw std::invalid_argument("PointChannel requires a positive capacity.");
+  }
+}
+
+bool PointChannel::push(const std::array<double, 3>& point) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  notFull_.wait(lock, [this] { return closed_ || count_ < ring_.size(); });
+  if (closed_) {
+    return false;
+  }
+  ring_.view().set((head_ + count_) % ring_.size(), point);
+  ++count_;
+  lock.unlock();
+  notEmpty_.notify_one();
+  return true;
+}
+
+std::size_t PointChannel::push(trans_geo::coordinate::ConstPointView points) {
+  std::size_t pushed = 0;
+  while (pushed < points.size()) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    notFull_.wait(lock, [this] { return closed_ || count_ < ring_.size(); });
+    if (closed_) {
+      break;
+    }
+    // 空きの分だけまとめて書き込む
+    std::size_t n = std::min(ring_.size() - count_, points.size() - pushed);
+    trans_geo::coordinate::PointView ring = ring_.view();
+    for (std::size_t i = 0; i < n; ++i) {
+      ring.set((head_ + count_ + i) % ring_.size(), points.get(pushed + i));
+    }
+    count_ += n;
+    pushed += n;
+    lock.unlock();
+    notEmpty_.notify_one();
+  }
+  return pushed;
+}
+
+bool PointChannel::tryPush(const std::array<double, 3>& point) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_ || count_ == ring_.size()) {
+      return false;
+    }
+    ring_.view().set((head_ + count_) % ring_.size(), point);
+    ++count_;
+  }
+  notEmpty_.notify_one();
+  return true;
+}
+
+void PointChannel::close() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+  }
+  notEmpty_.notify_all();
+  notFull_.notify_all();
+}
+
+std::size_t PointChannel::pop(trans_geo::coordinate::PointView output) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  notEmpty_.wait(lock, [this] { return closed_ || count_ > 0; });
+  std::size_t n = std::min(count_, output.size());
+  trans_geo::coordinate::ConstPointView ring = ring_.view();
+  for (std::size_t i = 0; i < n; ++i) {
+    output.set(i, ring.get((head_ + i) % ring_.size()));
+  }
+  head_ = (head_ + n) % ring_.size();
+  count_ -= n;
+  lock.unlock();
+  notFull_.notify_all();
+  return n;
+}
+
+std::size_t PointChannel::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return count_;
+}
+
+std::size_t PointChannel::capacity() const noexcept { return ring_.size(); }
+
+}  // namespace trans_geo::pipeline
@@ -0,0 +1,90 @@
+#include "pipeline/stages.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "converter/conversion_status.hpp"  // ConversionStatus の定義
+#include "coordinate/point_buffer.hpp"      // PointBuffer の定義
+
+namespace trans_geo::pipeline {
+
+using trans_geo::coordinate::ConstPointView;
+using trans_geo::coordinate::PointBuffer;
+using trans_geo::coordinate::PointView;
+
+BatchStream viewSource(ConstPointView points, std::size_t batchSize) {
+  if (batchSize == 0) {
+    throw std::invalid_argument("viewSource requires a positive batch size.");
+  }
+  for (std::size_t offset = 0; offset < points.size(); offset += batchSize) {
+    co_yield points.subview(offset,
+                            std::min(batchSize, points.size() - offset));
+  }
+}
+
+BatchStream channelSource(PointChannel& channel, std::size_t maxBatch) {
+  if (maxBatch == 0) {
+    throw std::invalid_argument(
+        "channelSource requires a positive batch size.");
+  }
+  PointBuffer buffer(maxBatch);
+  while (std::size_t n = channel.pop(buffer.view())) {
+    co_yield ConstPointView(buffer.view()).subview(0, n);
+  }
+}
+
+BatchStream coalesce(BatchStream source, std::size_t batchSize) {
+  if (batchSize == 0) {
+    throw std::invalid_argument("coalesce requires a positive batch size.");
+  }
+  PointBuffer pending(batchSize);
+  std::size_t filled = 0;
+  for (ConstPointView batch : source) {
+    std::size_t offset = 0;
+    while (offset < batch.size()) {
+      std::size_t remaining = batch.size() - offset;
+      if (filled == 0 && remaining >= batchSize) {
+        // 満杯のバッチはコピーせずにそのまま流す
+        co_yield batch.subview(offset, batchSize);
+        offset += batchSize;
+        continue;
+      }
+      std::size_t take = std::min(batchSize - filled, remaining);
+      PointView target = pending.view();
+      for (std::size_t i = 0; i < take; ++i) {
+        target.set(filled + i, batch.get(offset + i));
+      }
+      filled += take;
+      offset += take;
+      if (filled == batchSize) {
+        co_yield ConstPointView(pending.view());
+        filled = 0;
+      }
+    }
+  }
+  if (filled > 0) {
+    co_yield ConstPointView(pending.view()).subview(0, filled);
+  }
+}
+
+BatchStream convertStage(
+    BatchStream source,
+    const trans_geo::conversion::ICoordinateConverter& converter) {
+  PointBuffer output;
+  for (ConstPointView batch : source) {
+    if (output.size() < batch.size()) {
+      output.resize(batch.size());
+    }
+    PointView target = output.view().subview(0, batch.size());
+    trans_geo::conversion::ConversionStatus status =
+        converter.convertBatch(batch, target);
+    if (status != trans_geo::conversion::ConversionStatus::Ok) {
+      throw std::invalid_argument(std::string("convertStage: ") +
+                                  trans_geo::conversion::toString(status));
+    }
+    co_yield ConstPointView(target);
+  }
+}
+
+}  // namespace trans_geo::pipeline
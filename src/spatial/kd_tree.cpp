@@ -0,0 +1,295 @@
+#include "spatial/kd_tree.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+
+namespace trans_geo::spatial {
+namespace {
+using trans_geo::conversion::ConversionStatus;
+using trans_geo::coordinate::ConstPointView;
+using trans_geo::coordinate::PointBuffer;
+
+/// 探索スタックの深さ（点数 2^32 未満の平衡木には十分）
+constexpr std::size_t kStackDepth = 64;
+
+/**
+ * @brief 探索スタックの要素（ノードと、そのノードまでの距離の下限の 2 乗）
+ */
+struct StackEntry {
+  std::uint32_t node;
+  double bound;
+};
+
+/**
+ * @brief 距離の 2 乗が小さい順に k 件を保持する（挿入ソート）
+ */
+std::size_t insertCandidate(std::span<Neighbor> best, std::size_t count,
+                            std::size_t index, double squared) noexcept {
+  std::size_t pos = count < best.size() ? count++ : best.size() - 1;
+  while (pos > 0 && best[pos - 1].distance > squared) {
+    best[pos] = best[pos - 1];
+    --pos;
+  }
+  best[pos] = Neighbor{index, squared};
+  return count;
+}
+}  // namespace
+
+/**
+ * @brief 構築中の点（座標と元の番号を連続して置き、分割時の参照を局所化する）
+ */
+struct KdTree::BuildEntry {
+  std::array<double, 3> position;
+  std::uint32_t index;
+};
+
+KdTree::KdTree(ConstPointView ecef, std::size_t leafSize)
+    : leafSize_(leafSize) {
+  if (leafSize == 0) {
+    throw std::invalid_argument("KdTree::KdTree leafSize must be positive");
+  }
+  if (ecef.size() >= std::numeric_limits<std::uint32_t>::max()) {
+    throw std::invalid_argument("KdTree::KdTree too many points");
+  }
+  std::size_t n = ecef.hasData() ? ecef.size() : 0;
+
+  std::vector<BuildEntry> entries(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    entries[i] = BuildEntry{ecef.get(i), static_cast<std::uint32_t>(i)};
+  }
+  if (n > 0) {
+    nodes_.reserve(4 * (n / leafSize_ + 1));
+    build(entries, 0, static_cast<std::uint32_t>(n));
+  }
+
+  // 葉の点が連続するように並べ替えた順で SoA に格納する
+  points_.resize(n);
+  indices_.resize(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    points_.view().set(i, entries[i].position);
+    indices_[i] = entries[i].index;
+  }
+}
+
+std::uint32_t KdTree::build(std::vector<BuildEntry>& entries,
+                            std::uint32_t begin, std::uint32_t end) {
+  std::uint32_t id = static_cast<std::uint32_t>(nodes_.size());
+  nodes_.push_back(Node{0.0, begin, end, 0, 3});
+  if (end - begin <= leafSize_) {
+    return id;
+  }
+
+  // 広がりが最大の軸で中央値により分割する
+  std::array<double, 3> lo = entries[begin].position;
+  std::array<double, 3> hi = lo;
+  for (std::uint32_t i = begin + 1; i < end; ++i) {
+    for (std::size_t k = 0; k < 3; ++k) {
+      lo[k] = std::min(lo[k], entries[i].position[k]);
+      hi[k] = std::max(hi[k], entries[i].position[k]);
+    }
+  }
+  std::uint32_t axis = 0;
+  for (std::uint32_t k = 1; k < 3; ++k) {
+    if (hi[k] - lo[k] > hi[axis] - lo[axis]) {
+      axis = k;
+    }
+  }
+  std::uint32_t mid = begin + (end - begin) / 2;
+  std::nth_element(entries.begin() + begin, entries.begin() + mid,
+                   entries.begin() + end,
+                   [axis](const BuildEntry& a, const BuildEntry& b) {
+                     return a.position[axis] < b.position[axis];
+                   });
+  double split = entries[mid].position[axis];
+
+  build(entries, begin, mid);
+  std::uint32_t right = build(entries, mid, end);
+  nodes_[id].split = split;
+  nodes_[id].right = right;
+  nodes_[id].axis = axis;
+  return id;
+}
+
+std::size_t KdTree::size() const noexcept { return indices_.size(); }
+
+std::size_t KdTree::nearest(const std::array<double, 3>& query,
+                            std::span<Neighbor> out) const noexcept {
+  std::fill(out.begin(), out.end(), Neighbor{});
+  if (out.empty() || nodes_.empty()) {
+    return 0;
+  }
+  const double* x = points_.component(0).data();
+  const double* y = points_.component(1).data();
+  const double* z = points_.component(2).data();
+
+  // 探索中は distance に距離の 2 乗を保持する
+  std::size_t count = 0;
+  double worst = std::numeric_limits<double>::infinity();
+  std::array<StackEntry, kStackDepth> stack;
+  std::size_t top = 0;
+  stack[top++] = StackEntry{0, 0.0};
+  while (top > 0) {
+    StackEntry entry = stack[--top];
+    if (entry.bound >= worst) {
+      continue;
+    }
+    std::uint32_t id = entry.node;
+    // 葉に着くまで近い側の子へ下り、遠い側をスタックに積む
+    while (nodes_[id].axis != 3) {
+      const Node& node = nodes_[id];
+      double diff = query[node.axis] - node.split;
+      std::uint32_t nearChild = diff < 0.0 ? id + 1 : node.right;
+      std::uint32_t farChild = diff < 0.0 ? node.right : id + 1;
+      double bound = diff * diff;
+      if (bound < worst) {
+        stack[top++] = StackEntry{farChild, bound};
+      }
+      id = nearChild;
+    }
+    const Node& leaf = nodes_[id];
+    for (std::uint32_t i = leaf.begin; i < leaf.end; ++i) {
+      double dx = x[i] - query[0];
+      double dy = y[i] - query[1];
+      double dz = z[i] - query[2];
+      double squared = dx * dx + dy * dy + dz * dz;
+      if (count < out.size() || squared < worst) {
+        count = insertCandidate(out, count, indices_[i], squared);
+        if (count == out.size()) {
+          worst = out[count - 1].distance;
+        }
+      }
+    }
+  }
+  for (std::size_t i = 0; i < count; ++i) {
+    out[i].distance = std::sqrt(out[i].distance);
+  }
+  return count;
+}
+
+std::size_t KdTree::nearest(
+    const std::array<double, 3>& query,
+    const trans_geo::conversion::ICoordinateConverter& toEcef,
+    std::span<Neighbor> out) const noexcept {
+  std::array<double, 3> ecef{};
+  if (toEcef.convertPoint(query, ecef) != ConversionStatus::Ok) {
+    std::fill(out.begin(), out.end(), Neighbor{});
+    return 0;
+  }
+  return nearest(ecef, out);
+}
+
+void KdTree::withinRadius(const std::array<double, 3>& query, double radius,
+                          std::vector<Neighbor>& out) const {
+  out.clear();
+  if (nodes_.empty() || !(radius >= 0.0)) {
+    return;
+  }
+  const double* x = points_.component(0).data();
+  const double* y = points_.component(1).data();
+  const double* z = points_.component(2).data();
+  double limit = radius * radius;
+
+  std::array<std::uint32_t, kStackDepth> stack;
+  std::size_t top = 0;
+  stack[top++] = 0;
+  while (top > 0) {
+    std::uint32_t id = stack[--top];
+    while (nodes_[id].axis != 3) {
+      const Node& node = nodes_[id];
+      double diff = query[node.axis] - node.split;
+      std::uint32_t nearChild = diff < 0.0 ? id + 1 : node.right;
+      std::uint32_t farChild = diff < 0.0 ? node.right : id + 1;
+      if (diff * diff <= limit) {
+        stack[top++] = farChild;
+      }
+      id = nearChild;
+    }
+    const Node& leaf = nodes_[id];
+    for (std::uint32_t i = leaf.begin; i < leaf.end; ++i) {
+      double dx = x[i] - query[0];
+      double dy = y[i] - query[1];
+      double dz = z[i] - query[2];
+      double squared = dx * dx + dy * dy + dz * dz;
+      if (squared <= limit) {
+        out.push_back(Neighbor{indices_[i], squared});
+      }
+    }
+  }
+  std::sort(out.begin(), out.end(), [](const Neighbor& a, const Neighbor& b) {
+    return a.distance < b.distance;
+  });
+  for (Neighbor& neighbor : out) {
+    neighbor.distance = std::sqrt(neighbor.distance);
+  }
+}
+
+void KdTree::withinRadius(
+    const std::array<double, 3>& query,
+    const trans_geo::conversion::ICoordinateConverter& toEcef, double radius,
+    std::vector<Neighbor>& out) const {
+  std::array<double, 3> ecef{};
+  if (toEcef.convertPoint(query, ecef) != ConversionStatus::Ok) {
+    out.clear();
+    return;
+  }
+  withinRadius(ecef, radius, out);
+}
+
+void KdTree::nearestBatch(ConstPointView queries, std::size_t k,
+                          std::span<Neighbor> out,
+                          std::size_t threadCount) const {
+  std::size_t n = queries.hasData() ? queries.size() : 0;
+  if (out.size() != n * k) {
+    throw std::invalid_argument(
+        "KdTree::nearestBatch output size must be queries.size() * k");
+  }
+  if (n == 0 || k == 0) {
+    return;
+  }
+  if (threadCount == 0) {
+    threadCount = std::max(1u, std::thread::hardware_concurrency());
+  }
+  threadCount = std::min(threadCount, n);
+
+  auto run = [&](std::size_t first, std::size_t last) {
+    for (std::size_t i = first; i < last; ++i) {
+      nearest(queries.get(i), out.subspan(i * k, k));
+    }
+  };
+  if (threadCount == 1) {
+    run(0, n);
+    return;
+  }
+  // 問い合わせ点を連続した区間に分けて各スレッドに割り当てる
+  std::vector<std::jthread> workers;
+  workers.reserve(threadCount - 1);
+  std::size_t chunk = (n + threadCount - 1) / threadCount;
+  for (std::size_t t = 1; t < threadCount; ++t) {
+    std::size_t first = std::min(n, t * chunk);
+    std::size_t last = std::min(n, first + chunk);
+    workers.emplace_back(run, first, last);
+  }
+  run(0, std::min(n, chunk));
+}
+
+ConversionStatus KdTree::nearestBatch(
+    ConstPointView queries,
+    const trans_geo::conversion::ICoordinateConverter& toEcef, std::size_t k,
+    std::span<Neighbor> out, std::size_t threadCount) const {
+  std::size_t n = queries.hasData() ? queries.size() : 0;
+  if (out.size() != n * k) {
+    throw std::invalid_argument(
+        "KdTree::nearestBatch output size must be queries.size() * k");
+  }
+  PointBuffer ecef(n);
+  ConversionStatus status = toEcef.convertBatch(queries, ecef.view());
+  if (status != ConversionStatus::Ok) {
+    return status;
+  }
+  nearestBatch(ecef.view(), k, out, threadCount);
+  return ConversionStatus::Ok;
+}
+
+}  // namespace trans_geo::spatial
@@ -0,0 +1,201 @@
+#include "trajectory/trajectory.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace trans_geo::trajectory {
+namespace {
+using trans_geo::coordinate::ConstPointView;
+using trans_geo::coordinate::PointBuffer;
+using trans_geo::coordinate::PointView;
+
+/**
+ * @brief 差分で各サンプルの接線（速度）を推定する
+ *
+ * 内部の点は前後の区間の傾きの平均、端点は片側の傾きを使います。
+ */
+void estimateTangents(const std::vector<double>& t, ConstPointView p,
+                      PointView m) {
+  std::size_t n = t.size();
+  for (std::size_t k = 0; k < 3; ++k) {
+    double back = (p(1, k) - p(0, k)) / (t[1] - t[0]);
+    m(0, k) = back;
+    for (std::size_t i = 1; i + 1 < n; ++i) {
+      double forward = (p(i + 1, k) - p(i, k)) / (t[i + 1] - t[i]);
+      m(i, k) = 0.5 * (back + forward);
+      back = forward;
+    }
+    m(n - 1, k) = back;
+  }
+}
+
+/**
+ * @brief 自然 3 次スプラインの各サンプルの 2 階微分を求める
+ *
+ * 3 重対角の連立方程式を Thomas 法で解きます（両端の 2 階微分は 0）。
+ */
+void solveSplineSecondDerivatives(const std::vector<double>& t,
+                                  ConstPointView p, PointView second) {
+  std::size_t n = t.size();
+  std::vector<double> upper(n, 0.0);
+  for (std::size_t k = 0; k < 3; ++k) {
+    second(0, k) = 0.0;
+    second(n - 1, k) = 0.0;
+    // 前進消去
+    double prevUpper = 0.0;
+    double prevRhs = 0.0;
+    for (std::size_t i = 1; i + 1 < n; ++i) {
+      double h0 = t[i] - t[i - 1];
+      double h1 = t[i + 1] - t[i];
+      double rhs = 6.0 * ((p(i + 1, k) - p(i, k)) / h1 -
+                          (p(i, k) - p(i - 1, k)) / h0);
+      double diag = 2.0 * (h0 + h1) - h0 * prevUpper;
+      upper[i] = h1 / diag;
+      second(i, k) = (rhs - h0 * prevRhs) / diag;
+      prevUpper = upper[i];
+      prevRhs = second(i, k);
+    }
+    // 後退代入
+    for (std::size_t i = n - 2; i >= 1; --i) {
+      second(i, k) -= upper[i] * second(i + 1, k);
+    }
+  }
+}
+}  // namespace
+
+void Trajectory::appendTime(double time, bool withVelocity) {
+  if (!times_.empty()) {
+    if (!(time > times_.back())) {
+      throw std::invalid_argument(
+          "Trajectory::append requires strictly increasing times.");
+    }
+    if (withVelocity != (velocities_.size() == times_.size())) {
+      throw std::invalid_argument(
+          "Trajectory::append cannot mix samples with and without velocity.");
+    }
+  }
+  times_.push_back(time);
+}
+
+void Trajectory::append(double time, const std::array<double, 3>& position) {
+  appendTime(time, false);
+  positions_.push_back(position);
+}
+
+void Trajectory::append(double time, const std::array<double, 3>& position,
+                        const std::array<double, 3>& velocity) {
+  appendTime(time, true);
+  positions_.push_back(position);
+  velocities_.push_back(velocity);
+}
+
+std::size_t Trajectory::size() const noexcept { return times_.size(); }
+
+double Trajectory::getStartTime() const noexcept { return times_.front(); }
+
+double Trajectory::getEndTime() const noexcept { return times_.back(); }
+
+std::size_t Trajectory::interpolate(std::span<const double> times,
+                                    PointView output,
+                                    InterpolationMethod method) const {
+  std::size_t n = times_.size();
+  if (n < 2) {
+    throw std::invalid_argument(
+        "Trajectory::interpolate requires at least two samples.");
+  }
+  if (output.size() != times.size()) {
+    throw std::invalid_argument(
+        "Trajectory::interpolate requires output of the same size as times.");
+  }
+
+  // 接線（Hermite）または 2 階微分（スプライン）を一度だけ求める
+  ConstPointView p = positions_.view();
+  PointBuffer derivatives;
+  ConstPointView d;
+  if (method == InterpolationMethod::Hermite) {
+    if (velocities_.size() == n) {
+      d = velocities_.view();
+    } else {
+      derivatives.resize(n);
+      estimateTangents(times_, p, derivatives.view());
+      d = derivatives.view();
+    }
+  } else if (method == InterpolationMethod::CubicSpline) {
+    derivatives.resize(n);
+    solveSplineSecondDerivatives(times_, p, derivatives.view());
+    d = derivatives.view();
+  }
+
+  constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+  std::size_t interpolated = 0;
+  std::size_t segment = 0;  // times_[segment] <= t <= times_[segment + 1]
+  for (std::size_t q = 0; q < times.size(); ++q) {
+    double t = times[q];
+    if (!(t >= times_.front() && t <= times_.back())) {
+      output.set(q, {kNaN, kNaN, kNaN});
+      continue;
+    }
+    if (t < times_[segment]) {
+      // 前の区間に戻る場合のみ二分探索する
+      auto it = std::upper_bound(times_.begin(), times_.end(), t);
+      segment = static_cast<std::size_t>(it - times_.begin()) - 1;
+    }
+    while (segment + 2 < n && t > times_[segment + 1]) {
+      ++segment;
+    }
+    if (segment + 1 == n) {
+      segment = n - 2;
+    }
+
+    std::size_t i = segment;
+    double h = times_[i + 1] - times_[i];
+    double s = (t - times_[i]) / h;
+    std::array<double, 3> value{};
+    switch (method) {
+      case InterpolationMethod::Linear:
+        for (std::size_t k = 0; k < 3; ++k) {
+          value[k] = p(i, k) + (p(i + 1, k) - p(i, k)) * s;
+        }
+        break;
+      case InterpolationMethod::Hermite: {
+        double s2 = s * s;
+        double s3 = s2 * s;
+        double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+        double h10 = (s3 - 2.0 * s2 + s) * h;
+        double h01 = -2.0 * s3 + 3.0 * s2;
+        double h11 = (s3 - s2) * h;
+        for (std::size_t k = 0; k < 3; ++k) {
+          value[k] = h00 * p(i, k) + h10 * d(i, k) + h01 * p(i + 1, k) +
+                     h11 * d(i + 1, k);
+        }
+        break;
+      }
+      case InterpolationMethod::CubicSpline: {
+        double a = 1.0 - s;
+        double b = s;
+        double c = (a * a * a - a) * h * h / 6.0;
+        double e = (b * b * b - b) * h * h / 6.0;
+        for (std::size_t k = 0; k < 3; ++k) {
+          value[k] =
+              a * p(i, k) + b * p(i + 1, k) + c * d(i, k) + e * d(i + 1, k);
+        }
+        break;
+      }
+    }
+    output.set(q, value);
+    ++interpolated;
+  }
+  return interpolated;
+}
+
+InterpolationResult Trajectory::interpolate(
+    std::span<const double> times, PointView output, InterpolationMethod method,
+    const trans_geo::conversion::ICoordinateConverter& converter) const {
+  InterpolationResult result;
+  result.interpolated = interpolate(times, output, method);
+  result.status = converter.convertBatch(output, output);
+  return result;
+}
+
+}  // namespace trans_geo::trajectory
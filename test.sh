@@ -1,15 +1,31 @@
 #!/bin/bash
 set -e
 
+# 使い方:
+#   ./test.sh                            単体テスト（CTest）
+#   ./test.sh --perf                     性能の回帰テスト（ベースラインと比較）
+#   ./test.sh --perf --update-baseline   現在の計測値をベースラインとして保存
+# --perf の後の引数は perf_regression にそのまま渡す
+# （--threshold 0.05 など。既定のしきい値は 10%）
+
 ./build.sh
 
+ROOT_DIR=$(pwd)
+
 # ビルドディレクトリに移動
 cd build
 
+if [ "$1" == "--perf" ]; then
+    shift
+    # ベースラインは CPU 機種ごとに bench/baselines/ に保存する
+    ./bench/perf_regression --baseline-dir "$ROOT_DIR/bench/baselines" "$@"
+    exit $?
+fi
+
 # 論理コア数を取得（macOS/Linux 両対応）
 NUM_CORES=$(nproc 2>/dev/null || sysctl -n hw.logicalcpu)
 
 # テスト実行（CTest使用）
 ctest --output-on-failure -j "$NUM_CORES"
 
-echo "✅ All tests passed!"
\ No newline at end of file
+echo "✅ All tests passed!"
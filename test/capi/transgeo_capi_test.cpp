@@ -0,0 +1,137 @@
+#include "capi/transgeo.h"  // C API の定義
+
+#include <array>
+#include <vector>
+
+#include "converter/ECEF_to_ENU_converter.hpp"  // ECEFToENUConverter の定義
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "gtest/gtest.h"
+
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+namespace trans_geo::capi::test {
+/**
+ * @brief ABI バージョンと結果コードの名前を取得できる
+ */
+TEST(CApiTest, VersionAndStatusString) {
+  EXPECT_EQ(tg_abi_version(), TG_ABI_VERSION);
+  EXPECT_STREQ(tg_status_string(TG_OK), "TG_OK");
+  EXPECT_STREQ(tg_status_string(TG_INVALID_STRIDE), "TG_INVALID_STRIDE");
+  EXPECT_DOUBLE_EQ(tg_ellipsoid_wgs84().f, WGS84.f);
+  EXPECT_DOUBLE_EQ(tg_ellipsoid_grs80().f, GRS80.f);
+}
+
+/**
+ * @brief EPSG コードから楕円体を取得できる
+ */
+TEST(CApiTest, EllipsoidFromEpsg) {
+  tg_ellipsoid ellipsoid{};
+  ASSERT_EQ(tg_ellipsoid_from_epsg(6668, &ellipsoid), TG_OK);
+  EXPECT_DOUBLE_EQ(ellipsoid.a, GRS80.a);
+  EXPECT_DOUBLE_EQ(ellipsoid.f, GRS80.f);
+  EXPECT_EQ(tg_ellipsoid_from_epsg(1, &ellipsoid), TG_INVALID_ARGUMENT);
+  EXPECT_EQ(tg_ellipsoid_from_epsg(4326, nullptr), TG_NULL_BUFFER);
+}
+
+/**
+ * @brief AoS 配列の一括変換が C++ の変換器と一致する
+ */
+TEST(CApiTest, InterleavedMatchesConverter) {
+  tg_ellipsoid wgs84 = tg_ellipsoid_wgs84();
+  tg_converter* converter = nullptr;
+  ASSERT_EQ(tg_converter_create(TG_GEO_TO_ECEF, &wgs84, nullptr, &converter),
+            TG_OK);
+
+  std::vector<double> geo = {35.0, 139.0, 10.0, -33.9, 151.2, 50.0};
+  std::vector<double> ecef(geo.size(), 0.0);
+  ASSERT_EQ(tg_convert_interleaved(converter, 2, geo.data(), ecef.data()),
+            TG_OK);
+
+  trans_geo::conversion::GeoToECEFConverter reference(WGS84);
+  std::array<double, 3> expected{};
+  reference.convertPoint({-33.9, 151.2, 50.0}, expected);
+  EXPECT_DOUBLE_EQ(ecef[3], expected[0]);
+  EXPECT_DOUBLE_EQ(ecef[4], expected[1]);
+  EXPECT_DOUBLE_EQ(ecef[5], expected[2]);
+  tg_converter_destroy(converter);
+}
+
+/**
+ * @brief SoA 配列を間隔指定でその場変換し、往復で元に戻る
+ */
+TEST(CApiTest, StridedRoundTripInPlace) {
+  tg_ellipsoid wgs84 = tg_ellipsoid_wgs84();
+  double origin[3] = {35.0, 139.0, 0.0};
+  tg_converter* toENU = nullptr;
+  tg_converter* toECEF = nullptr;
+  ASSERT_EQ(tg_converter_create(TG_ECEF_TO_ENU, &wgs84, origin, &toENU),
+            TG_OK);
+  ASSERT_EQ(tg_converter_create(TG_ENU_TO_ECEF, &wgs84, origin, &toECEF),
+            TG_OK);
+
+  std::array<double, 3> start{};
+  trans_geo::conversion::GeoToECEFConverter(WGS84).convertPoint(
+      {35.001, 139.002, 12.0}, start);
+  std::vector<double> x = {start[0], start[0] + 10.0};
+  std::vector<double> y = {start[1], start[1] - 5.0};
+  std::vector<double> z = {start[2], start[2] + 1.0};
+
+  ASSERT_EQ(tg_convert_strided(toENU, 2, x.data(), y.data(), z.data(), 1,
+                               x.data(), y.data(), z.data(), 1),
+            TG_OK);
+  trans_geo::conversion::ECEFToENUConverter reference(
+      WGS84, GeoCoordinate(35.0, 139.0, 0.0));
+  std::array<double, 3> enu{};
+  reference.convertPoint(start, enu);
+  EXPECT_DOUBLE_EQ(x[0], enu[0]);
+  EXPECT_DOUBLE_EQ(y[0], enu[1]);
+  EXPECT_DOUBLE_EQ(z[0], enu[2]);
+
+  ASSERT_EQ(tg_convert_strided(toECEF, 2, x.data(), y.data(), z.data(), 1,
+                               x.data(), y.data(), z.data(), 1),
+            TG_OK);
+  EXPECT_NEAR(x[1], start[0] + 10.0, 1e-6);
+  EXPECT_NEAR(y[1], start[1] - 5.0, 1e-6);
+  EXPECT_NEAR(z[1], start[2] + 1.0, 1e-6);
+  tg_converter_destroy(toENU);
+  tg_converter_destroy(toECEF);
+}
+
+/**
+ * @brief 不正な引数は例外ではなく結果コードで報告する
+ */
+TEST(CApiTest, ReportsErrorsAsStatus) {
+  tg_ellipsoid wgs84 = tg_ellipsoid_wgs84();
+  tg_ellipsoid broken = {-1.0, 0.0};
+  tg_converter* converter = nullptr;
+
+  EXPECT_EQ(tg_converter_create(TG_GEO_TO_ENU, &wgs84, nullptr, &converter),
+            TG_INVALID_ARGUMENT);
+  EXPECT_EQ(tg_converter_create(TG_GEO_TO_ECEF, &broken, nullptr, &converter),
+            TG_INVALID_ARGUMENT);
+  EXPECT_EQ(tg_converter_create(static_cast<tg_conversion>(99), &wgs84,
+                                nullptr, &converter),
+            TG_INVALID_ARGUMENT);
+  EXPECT_EQ(tg_ecef_to_geo_create(
+                &wgs84, static_cast<tg_geodetic_precision>(7), &converter),
+            TG_INVALID_ARGUMENT);
+  EXPECT_EQ(converter, nullptr);
+
+  ASSERT_EQ(tg_ecef_to_geo_create(&wgs84, TG_PRECISION_MILLIMETRE,
+                                  &converter),
+            TG_OK);
+  std::vector<double> buffer(6, 1.0);
+  EXPECT_EQ(tg_convert_interleaved(nullptr, 2, buffer.data(), buffer.data()),
+            TG_INVALID_ARGUMENT);
+  EXPECT_EQ(tg_convert_interleaved(converter, 2, nullptr, buffer.data()),
+            TG_NULL_BUFFER);
+  EXPECT_EQ(tg_convert_interleaved(converter, 0, nullptr, nullptr), TG_OK);
+  EXPECT_EQ(tg_convert_strided(converter, 2, buffer.data(), buffer.data(),
+                               buffer.data(), 0, buffer.data(),
+                               buffer.data(), buffer.data(), 1),
+            TG_INVALID_STRIDE);
+  tg_converter_destroy(converter);
+  tg_converter_destroy(nullptr);
+}
+}  // namespace trans_geo::capi::test
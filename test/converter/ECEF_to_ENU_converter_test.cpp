@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 #include "coordinate/ECEF_coordinate.hpp"  // ECEFCoordinate の定義
 #include "coordinate/ENU_coordinate.hpp"   // ENUcoordinateの定義
@@ -76,3 +77,107 @@ TEST_F(ECEFToENUConverterTest, InvalidInputThrows) {
   GeoCoordinate geo(10.0, 20.0, 0.0);
   EXPECT_THROW(converter->convert(geo), std::invalid_argument);
 }
+
+/**
+ * @brief 速度・加速度の変換テスト
+ *
+ * 原点 (0, 0) では ECEF の X 軸が Up、Y 軸が East、Z 軸が North に対応する。
+ * 速度は純粋な回転で変換されるため、原点オフセットの影響を受けない。
+ */
+TEST_F(ECEFToENUConverterTest, ConvertVelocityAndAcceleration) {
+  auto velocity = converter->convertVelocity({10.0, 20.0, 30.0});
+  EXPECT_NEAR(velocity[0], 20.0, 1e-9);
+  EXPECT_NEAR(velocity[1], 30.0, 1e-9);
+  EXPECT_NEAR(velocity[2], 10.0, 1e-9);
+
+  auto acceleration = converter->convertAcceleration({0.0, 0.0, -9.8});
+  EXPECT_NEAR(acceleration[0], 0.0, 1e-9);
+  EXPECT_NEAR(acceleration[1], -9.8, 1e-9);
+  EXPECT_NEAR(acceleration[2], 0.0, 1e-9);
+}
+
+/**
+ * @brief 状態ベクトル（位置 + 速度）の一括変換テスト
+ *
+ * 単点の convert() / convertVelocity() と同じ結果になることを確認する。
+ */
+TEST_F(ECEFToENUConverterTest, ConvertStatesMatchesSinglePoint) {
+  std::vector<double> states = {WGS84.a + 100.0, 0.0, 0.0,  1.0, 2.0, 3.0,
+                                WGS84.a,         50.0, 25.0, 0.0, 0.0, -1.0};
+  std::vector<double> enuStates(states.size());
+  converter->convertStates(states, enuStates);
+
+  for (std::size_t i = 0; i < states.size(); i += kStateVectorSize) {
+    ECEFCoordinate ecef(states[i], states[i + 1], states[i + 2]);
+    auto result = converter->convert(ecef);
+    auto enu = dynamic_cast<ENUCoordinate*>(result.get());
+    ASSERT_NE(enu, nullptr);
+    auto velocity = converter->convertVelocity(
+        {states[i + 3], states[i + 4], states[i + 5]});
+    EXPECT_NEAR(enuStates[i + 0], enu->getEast(), 1e-9);
+    EXPECT_NEAR(enuStates[i + 1], enu->getNorth(), 1e-9);
+    EXPECT_NEAR(enuStates[i + 2], enu->getUp(), 1e-9);
+    EXPECT_NEAR(enuStates[i + 3], velocity[0], 1e-12);
+    EXPECT_NEAR(enuStates[i + 4], velocity[1], 1e-12);
+    EXPECT_NEAR(enuStates[i + 5], velocity[2], 1e-12);
+  }
+
+  // 同じ領域への上書き変換でも結果は変わらない
+  converter->convertStates(states, states);
+  for (std::size_t i = 0; i < states.size(); ++i) {
+    EXPECT_DOUBLE_EQ(states[i], enuStates[i]);
+  }
+}
+
+/**
+ * @brief 状態ベクトルの要素数が不正な場合のテスト
+ */
+TEST_F(ECEFToENUConverterTest, ConvertStatesInvalidSizeThrows) {
+  std::vector<double> states(7, 0.0);
+  std::vector<double> out(7, 0.0);
+  EXPECT_THROW(converter->convertStates(states, out), std::invalid_argument);
+
+  std::vector<double> shortOut(6, 0.0);
+  std::vector<double> twelve(12, 0.0);
+  EXPECT_THROW(converter->convertStates(twelve, shortOut),
+               std::invalid_argument);
+}
+
+/**
+ * @brief 状態ベクトル列の位置成分のみを間隔指定で一括変換する
+ */
+TEST_F(ECEFToENUConverterTest, ConvertBatchStridedPositions) {
+  // origin (0, 0, 0) では East = +Y, North = +Z, Up = +X
+  double a = WGS84.a;
+  std::vector<double> states = {a + 1.0, 2.0, 3.0, 7.0, 8.0, 9.0,
+                                a,       0.0, 0.0, 7.0, 8.0, 9.0};
+  PointView positions = PointView::interleaved(states.data(), 2, 6);
+  ASSERT_EQ(converter->convertBatch(positions, positions),
+            ConversionStatus::Ok);
+
+  EXPECT_NEAR(states[0], 2.0, 1e-6);
+  EXPECT_NEAR(states[1], 3.0, 1e-6);
+  EXPECT_NEAR(states[2], 1.0, 1e-6);
+  EXPECT_NEAR(states[6], 0.0, 1e-6);
+  EXPECT_NEAR(states[7], 0.0, 1e-6);
+  EXPECT_NEAR(states[8], 0.0, 1e-6);
+  // 速度成分は変更されない
+  EXPECT_DOUBLE_EQ(states[3], 7.0);
+  EXPECT_DOUBLE_EQ(states[11], 9.0);
+}
+
+/**
+ * @brief 変換結果の ENU 座標はすべて同じ原点を共有する
+ */
+TEST_F(ECEFToENUConverterTest, ResultsShareOrigin) {
+  auto first = converter->convert(ECEFCoordinate(WGS84.a, 0.0, 0.0));
+  auto second = converter->convert(ECEFCoordinate(WGS84.a, 1.0, 0.0));
+  auto* firstEnu = dynamic_cast<ENUCoordinate*>(first.get());
+  auto* secondEnu = dynamic_cast<ENUCoordinate*>(second.get());
+  ASSERT_NE(firstEnu, nullptr);
+  ASSERT_NE(secondEnu, nullptr);
+  EXPECT_EQ(firstEnu->getOriginHandle().get(),
+            converter->getOriginHandle().get());
+  EXPECT_EQ(secondEnu->getOriginHandle().get(),
+            converter->getOriginHandle().get());
+}
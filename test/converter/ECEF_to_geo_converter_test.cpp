@@ -1,6 +1,7 @@
 #include "converter/ECEF_to_geo_converter.hpp"  // ECEFToGeoConverter の定義
 
 #include <cmath>
+#include <vector>
 
 #include "converter/geo_to_ECEF_converter.hpp"  // ラウンドトリップ用に Geo→ECEF 変換器を利用
 #include "coordinate/ECEF_coordinate.hpp"  // ECEFCoordinate の定義
@@ -97,4 +98,121 @@ TEST_F(ECEFToGeoConverterTest, RoundTripTest) {
 TEST_F(ECEFToGeoConverterTest, InvalidInputThrows) {
   GeoCoordinate geo(10.0, 20.0, 0.0);
   EXPECT_THROW(converter->convert(geo), std::invalid_argument);
-}
\ No newline at end of file
+}
+
+/**
+ * @brief 精度プリセットごとのラウンドトリップ誤差のテスト
+ *
+ * 各プリセットが、文書化した最悪誤差以内で元の Geo 座標を復元することを
+ * 地表付近から静止軌道高度まで検証します。
+ */
+TEST_F(ECEFToGeoConverterTest, PrecisionPresetsMeetTarget) {
+  GeoToECEFConverter geo2ecef(ellipsoid);
+  struct Case {
+    GeodeticPrecision precision;
+    double tolerance;  // メートル
+  };
+  for (Case c : {Case{GeodeticPrecision::Micrometre, 1e-6},
+                 Case{GeodeticPrecision::Millimetre, 1e-3},
+                 Case{GeodeticPrecision::Decimetre, 1e-1}}) {
+    ECEFToGeoConverter preset(ellipsoid, c.precision);
+    EXPECT_EQ(preset.getPrecision(), c.precision);
+    for (double lat : {-89.9, -60.0, -1.0, 0.0, 35.6895, 45.0, 80.0, 90.0}) {
+      for (double h : {-500.0, 0.0, 8848.0, 400e3, 35786e3}) {
+        auto ecef = geo2ecef.convert(GeoCoordinate(lat, 139.7, h));
+        auto result = preset.convert(*ecef);
+        auto geo = dynamic_cast<GeoCoordinate*>(result.get());
+        ASSERT_NE(geo, nullptr);
+        double metresPerDegree = (ellipsoid.a + h) * M_PI / 180.0;
+        EXPECT_NEAR(geo->getLatitude(), lat, c.tolerance / metresPerDegree)
+            << "lat=" << lat << " h=" << h;
+        EXPECT_NEAR(geo->getLongitude(), 139.7, 1e-9);
+        EXPECT_NEAR(geo->getAltitude().value_or(0.0), h, c.tolerance)
+            << "lat=" << lat << " h=" << h;
+      }
+    }
+  }
+}
+
+/**
+ * @brief 極上の点で高度が正しく求まることのテスト
+ *
+ * 北極 (0, 0, b + 100) は緯度 90°、高度 100 m となるはずです。
+ */
+TEST_F(ECEFToGeoConverterTest, ConvertAtPole) {
+  double b = ellipsoid.a * (1.0 - ellipsoid.f);
+  ECEFCoordinate ecef(0.0, 0.0, b + 100.0);
+  for (GeodeticPrecision precision :
+       {GeodeticPrecision::Reference, GeodeticPrecision::Micrometre,
+        GeodeticPrecision::Decimetre}) {
+    ECEFToGeoConverter preset(ellipsoid, precision);
+    auto result = preset.convert(ecef);
+    auto geo = dynamic_cast<GeoCoordinate*>(result.get());
+    ASSERT_NE(geo, nullptr);
+    EXPECT_NEAR(geo->getLatitude(), 90.0, 1e-9);
+    EXPECT_NEAR(geo->getAltitude().value_or(0.0), 100.0, 1e-6);
+  }
+}
+
+/**
+ * @brief 収束条件を指定した反復法のテスト
+ *
+ * 許容誤差を緩めても、指定した許容誤差相当の精度は保たれることを検証します。
+ */
+TEST_F(ECEFToGeoConverterTest, CustomTolerance) {
+  GeoToECEFConverter geo2ecef(ellipsoid);
+  auto ecef = geo2ecef.convert(GeoCoordinate(45.0, 45.0, 1000.0));
+
+  // 1.5e-8 rad はおよそ 10 cm に相当
+  ECEFToGeoConverter coarse(ellipsoid, 1.5e-8, 10);
+  auto result = coarse.convert(*ecef);
+  auto geo = dynamic_cast<GeoCoordinate*>(result.get());
+  ASSERT_NE(geo, nullptr);
+  EXPECT_NEAR(geo->getLatitude(), 45.0, 1e-6);
+  EXPECT_NEAR(geo->getAltitude().value_or(0.0), 1000.0, 0.1);
+}
+
+/**
+ * @brief 不正な収束条件の場合のテスト
+ */
+TEST_F(ECEFToGeoConverterTest, InvalidToleranceThrows) {
+  EXPECT_THROW(ECEFToGeoConverter(ellipsoid, -1.0, 10), std::invalid_argument);
+  EXPECT_THROW(ECEFToGeoConverter(ellipsoid, 1e-12, 0), std::invalid_argument);
+}
+
+/**
+ * @brief 一括の上書き変換の結果が単点変換と一致する（全精度プリセット）
+ */
+TEST_F(ECEFToGeoConverterTest, ConvertBatchInPlaceMatchesConvert) {
+  std::vector<double> ecef = {6378137.0, 0.0,       0.0,
+                              -2.0e6,    3.0e6,     5.0e6,
+                              1.0e5,     -1.0e5,    6356752.3};
+  for (GeodeticPrecision precision :
+       {GeodeticPrecision::Reference, GeodeticPrecision::Micrometre,
+        GeodeticPrecision::Millimetre, GeodeticPrecision::Decimetre}) {
+    ECEFToGeoConverter preset(ellipsoid, precision);
+    std::vector<double> values = ecef;
+    PointView view = PointView::interleaved(values.data(), 3);
+    ASSERT_EQ(preset.convertBatch(view, view), ConversionStatus::Ok);
+
+    for (std::size_t i = 0; i < 3; ++i) {
+      auto result = preset.convert(
+          ECEFCoordinate(ecef[3 * i], ecef[3 * i + 1], ecef[3 * i + 2]));
+      auto geo = dynamic_cast<GeoCoordinate*>(result.get());
+      ASSERT_NE(geo, nullptr);
+      EXPECT_DOUBLE_EQ(values[3 * i], geo->getLatitude());
+      EXPECT_DOUBLE_EQ(values[3 * i + 1], geo->getLongitude());
+      EXPECT_DOUBLE_EQ(values[3 * i + 2], geo->getAltitude().value());
+    }
+  }
+}
+
+/**
+ * @brief nullptr を含むビューでは NullBuffer を返す
+ */
+TEST_F(ECEFToGeoConverterTest, ConvertBatchRejectsNullBuffer) {
+  std::vector<double> out(3, 0.0);
+  EXPECT_EQ(converter->convertBatch(ConstPointView::interleaved(nullptr, 1),
+                                    PointView::interleaved(out.data(), 1)),
+            ConversionStatus::NullBuffer);
+}
@@ -0,0 +1,68 @@
+#include "converter/ENU_frame.hpp"  // ENUFrame の定義
+
+#include <array>
+#include <cmath>
+
+#include "coordinate/geo_coordinate.hpp"  // GeoCoordinate の定義
+#include "ellipsoid/ellipsoid.hpp"        // Ellipsoid 構造体の定義
+#include "gtest/gtest.h"
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+/**
+ * @brief 原点 (0, 0, 0) のフレームでは原点の ECEF 座標が (a, 0, 0) となる
+ */
+TEST(ENUFrameTest, OriginAtEquator) {
+  ENUFrame frame(WGS84, GeoCoordinate(0.0, 0.0));
+  const auto& p0 = frame.getOriginECEF();
+  EXPECT_NEAR(p0[0], WGS84.a, 1e-6);
+  EXPECT_NEAR(p0[1], 0.0, 1e-6);
+  EXPECT_NEAR(p0[2], 0.0, 1e-6);
+}
+
+/**
+ * @brief 回転行列が直交行列であることの確認（R * R^T = I）
+ */
+TEST(ENUFrameTest, RotationIsOrthonormal) {
+  ENUFrame frame(WGS84, GeoCoordinate(35.6895, 139.6917, 40.0));
+  const auto& R = frame.getRotation();
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      double dot = R[i * 3 + 0] * R[j * 3 + 0] + R[i * 3 + 1] * R[j * 3 + 1] +
+                   R[i * 3 + 2] * R[j * 3 + 2];
+      EXPECT_NEAR(dot, i == j ? 1.0 : 0.0, 1e-12);
+    }
+  }
+}
+
+/**
+ * @brief 位置の往復変換（ENU→ECEF→ENU）で元の値に戻ることの確認
+ */
+TEST(ENUFrameTest, PositionRoundTrip) {
+  ENUFrame frame(WGS84, GeoCoordinate(35.6895, 139.6917, 40.0));
+  std::array<double, 3> enu{123.0, -456.0, 78.9};
+  std::array<double, 3> back = frame.toENU(frame.toECEF(enu));
+  EXPECT_NEAR(back[0], enu[0], 1e-6);
+  EXPECT_NEAR(back[1], enu[1], 1e-6);
+  EXPECT_NEAR(back[2], enu[2], 1e-6);
+}
+
+/**
+ * @brief ベクトルの回転は原点オフセットを含まないことの確認
+ *
+ * 原点 (0, 0) では ECEF の X 軸が Up、Y 軸が East、Z 軸が North に対応する。
+ */
+TEST(ENUFrameTest, VectorRotationHasNoOffset) {
+  ENUFrame frame(WGS84, GeoCoordinate(0.0, 0.0, 100.0));
+  std::array<double, 3> v = frame.rotateToENU({1.0, 2.0, 3.0});
+  EXPECT_NEAR(v[0], 2.0, 1e-12);
+  EXPECT_NEAR(v[1], 3.0, 1e-12);
+  EXPECT_NEAR(v[2], 1.0, 1e-12);
+
+  std::array<double, 3> back = frame.rotateToECEF(v);
+  EXPECT_NEAR(back[0], 1.0, 1e-12);
+  EXPECT_NEAR(back[1], 2.0, 1e-12);
+  EXPECT_NEAR(back[2], 3.0, 1e-12);
+}
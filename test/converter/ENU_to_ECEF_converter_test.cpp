@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 #include "converter/i_coordiante_converter.hpp"  // ICoordinateConverter の定義
 #include "coordinate/ECEF_coordinate.hpp"        // ECEFCoordinate の定義
@@ -51,9 +52,8 @@ TEST_F(ENUToECEFConverterTest, ZeroENUReturnsOriginECEF) {
 /**
  * @brief ENU 座標 (100, 0, 0) を入力した場合のテスト
  *
- * 原点が GeoCoordinate(0,0,0) の場合、計算上の回転行列により、
- * delta = (N, U, E) = (0, 0, 100) となるため、最終 ECEF 座標は (6378137, 0,
- * 100) となるはず。
+ * 原点が GeoCoordinate(0,0,0) の場合、East は ECEF の Y 軸方向となるため、
+ * delta = (0, 100, 0) となり、最終 ECEF 座標は (6378137, 100, 0) となるはず。
  */
 TEST_F(ENUToECEFConverterTest, EastOffset) {
   ENUCoordinate enu(100.0, 0.0, 0.0, origin);
@@ -61,39 +61,39 @@ TEST_F(ENUToECEFConverterTest, EastOffset) {
   auto ecef = dynamic_cast<ECEFCoordinate*>(result.get());
   ASSERT_NE(ecef, nullptr);
   EXPECT_NEAR(ecef->getX(), 6378137.0, 1e-3);
-  EXPECT_NEAR(ecef->getY(), 0.0, 1e-3);
-  EXPECT_NEAR(ecef->getZ(), 100.0, 1e-3);
+  EXPECT_NEAR(ecef->getY(), 100.0, 1e-3);
+  EXPECT_NEAR(ecef->getZ(), 0.0, 1e-3);
 }
 
 /**
  * @brief ENU 座標 (0, 50, 0) を入力した場合のテスト
  *
- * 入力 ENU (0,50,0) では delta = (50, 0, 0) となるため、
- * 出力 ECEF 座標は (6378137+50, 0, 0) となるはず。
+ * North は ECEF の Z 軸方向となるため delta = (0, 0, 50) となり、
+ * 出力 ECEF 座標は (6378137, 0, 50) となるはず。
  */
 TEST_F(ENUToECEFConverterTest, NorthOffset) {
   ENUCoordinate enu(0.0, 50.0, 0.0, origin);
   auto result = converter->convert(enu);
   auto ecef = dynamic_cast<ECEFCoordinate*>(result.get());
   ASSERT_NE(ecef, nullptr);
-  EXPECT_NEAR(ecef->getX(), 6378137.0 + 50.0, 1e-3);
+  EXPECT_NEAR(ecef->getX(), 6378137.0, 1e-3);
   EXPECT_NEAR(ecef->getY(), 0.0, 1e-3);
-  EXPECT_NEAR(ecef->getZ(), 0.0, 1e-3);
+  EXPECT_NEAR(ecef->getZ(), 50.0, 1e-3);
 }
 
 /**
  * @brief ENU 座標 (0, 0, 30) を入力した場合のテスト
  *
- * 入力 ENU (0,0,30) では delta = (0, 30, 0) となるため、
- * 出力 ECEF 座標は (6378137, 30, 0) となるはず。
+ * Up は ECEF の X 軸方向となるため delta = (30, 0, 0) となり、
+ * 出力 ECEF 座標は (6378137+30, 0, 0) となるはず。
  */
 TEST_F(ENUToECEFConverterTest, UpOffset) {
   ENUCoordinate enu(0.0, 0.0, 30.0, origin);
   auto result = converter->convert(enu);
   auto ecef = dynamic_cast<ECEFCoordinate*>(result.get());
   ASSERT_NE(ecef, nullptr);
-  EXPECT_NEAR(ecef->getX(), 6378137.0, 1e-3);
-  EXPECT_NEAR(ecef->getY(), 30.0, 1e-3);
+  EXPECT_NEAR(ecef->getX(), 6378137.0 + 30.0, 1e-3);
+  EXPECT_NEAR(ecef->getY(), 0.0, 1e-3);
   EXPECT_NEAR(ecef->getZ(), 0.0, 1e-3);
 }
 
@@ -106,4 +106,72 @@ TEST_F(ENUToECEFConverterTest, UpOffset) {
 TEST_F(ENUToECEFConverterTest, InvalidInputThrows) {
   GeoCoordinate geo(10.0, 20.0, 0.0);
   EXPECT_THROW(converter->convert(geo), std::invalid_argument);
-}
\ No newline at end of file
+}
+
+/**
+ * @brief 速度・加速度の変換テスト
+ *
+ * 原点 (0, 0) では East が ECEF の Y 軸、North が Z 軸、Up が X 軸に対応する。
+ */
+TEST_F(ENUToECEFConverterTest, ConvertVelocityAndAcceleration) {
+  auto velocity = converter->convertVelocity({1.0, 2.0, 3.0});
+  EXPECT_NEAR(velocity[0], 3.0, 1e-9);
+  EXPECT_NEAR(velocity[1], 1.0, 1e-9);
+  EXPECT_NEAR(velocity[2], 2.0, 1e-9);
+
+  auto acceleration = converter->convertAcceleration({0.0, 0.0, -9.8});
+  EXPECT_NEAR(acceleration[0], -9.8, 1e-9);
+  EXPECT_NEAR(acceleration[1], 0.0, 1e-9);
+  EXPECT_NEAR(acceleration[2], 0.0, 1e-9);
+}
+
+/**
+ * @brief 状態ベクトル（位置 + 速度）の一括変換テスト
+ */
+TEST_F(ENUToECEFConverterTest, ConvertStates) {
+  std::vector<double> states = {0.0, 0.0, 30.0, 1.0, 2.0, 3.0,
+                                100.0, 50.0, 0.0, 0.0, 0.0, 0.0};
+  std::vector<double> ecefStates(states.size());
+  converter->convertStates(states, ecefStates);
+
+  EXPECT_NEAR(ecefStates[0], 6378137.0 + 30.0, 1e-3);
+  EXPECT_NEAR(ecefStates[1], 0.0, 1e-3);
+  EXPECT_NEAR(ecefStates[2], 0.0, 1e-3);
+  EXPECT_NEAR(ecefStates[3], 3.0, 1e-9);
+  EXPECT_NEAR(ecefStates[4], 1.0, 1e-9);
+  EXPECT_NEAR(ecefStates[5], 2.0, 1e-9);
+
+  EXPECT_NEAR(ecefStates[6], 6378137.0, 1e-3);
+  EXPECT_NEAR(ecefStates[7], 100.0, 1e-3);
+  EXPECT_NEAR(ecefStates[8], 50.0, 1e-3);
+}
+
+/**
+ * @brief 状態ベクトルの要素数が不正な場合のテスト
+ */
+TEST_F(ENUToECEFConverterTest, ConvertStatesInvalidSizeThrows) {
+  std::vector<double> states(5, 0.0);
+  std::vector<double> out(5, 0.0);
+  EXPECT_THROW(converter->convertStates(states, out), std::invalid_argument);
+}
+
+/**
+ * @brief 一括変換の結果が単点変換と一致する
+ */
+TEST_F(ENUToECEFConverterTest, ConvertBatchMatchesConvert) {
+  std::vector<double> enu = {100.0, -50.0, 10.0, 0.0, 0.0, 0.0};
+  std::vector<double> out(6, 0.0);
+  ASSERT_EQ(converter->convertBatch(ConstPointView::interleaved(enu.data(), 2),
+                                    PointView::interleaved(out.data(), 2)),
+            ConversionStatus::Ok);
+
+  for (std::size_t i = 0; i < 2; ++i) {
+    auto result = converter->convert(
+        ENUCoordinate(enu[3 * i], enu[3 * i + 1], enu[3 * i + 2], origin));
+    auto ecef = dynamic_cast<ECEFCoordinate*>(result.get());
+    ASSERT_NE(ecef, nullptr);
+    EXPECT_DOUBLE_EQ(out[3 * i], ecef->getX());
+    EXPECT_DOUBLE_EQ(out[3 * i + 1], ecef->getY());
+    EXPECT_DOUBLE_EQ(out[3 * i + 2], ecef->getZ());
+  }
+}
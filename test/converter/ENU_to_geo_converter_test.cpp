@@ -3,6 +3,7 @@
 #include <cmath>
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 #include "coordinate/ENU_coordinate.hpp"  // ENUCoordinate の定義
 #include "coordinate/geo_coordinate.hpp"  // GeoCoordinate の定義
@@ -80,4 +81,25 @@ TEST_F(ENUToGeoConverterTest, NonZeroInputProducesOffsetGeo) {
 TEST_F(ENUToGeoConverterTest, InvalidInputThrows) {
   GeoCoordinate geo(10.0, 20.0, 0.0);
   EXPECT_THROW(converter->convert(geo), std::invalid_argument);
-}
\ No newline at end of file
+}
+
+/**
+ * @brief 一括変換の結果が単点変換と一致する
+ */
+TEST_F(ENUToGeoConverterTest, ConvertBatchMatchesConvert) {
+  std::vector<double> enu = {100.0, 200.0, 30.0, -1000.0, 500.0, 0.0};
+  std::vector<double> out(6, 0.0);
+  ASSERT_EQ(converter->convertBatch(ConstPointView::interleaved(enu.data(), 2),
+                                    PointView::interleaved(out.data(), 2)),
+            ConversionStatus::Ok);
+
+  for (std::size_t i = 0; i < 2; ++i) {
+    auto result = converter->convert(
+        ENUCoordinate(enu[3 * i], enu[3 * i + 1], enu[3 * i + 2], origin));
+    auto geo = dynamic_cast<GeoCoordinate*>(result.get());
+    ASSERT_NE(geo, nullptr);
+    EXPECT_NEAR(out[3 * i], geo->getLatitude(), 1e-12);
+    EXPECT_NEAR(out[3 * i + 1], geo->getLongitude(), 1e-12);
+    EXPECT_NEAR(out[3 * i + 2], geo->getAltitude().value(), 1e-6);
+  }
+}
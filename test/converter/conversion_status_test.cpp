@@ -0,0 +1,65 @@
+#include "converter/conversion_status.hpp"  // ConversionStatus の定義
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+
+/**
+ * @brief 点数と間隔が揃った入出力は検証を通過する
+ */
+TEST(ConversionStatusTest, ValidBatch) {
+  std::vector<double> in(6, 0.0), out(6, 0.0);
+  EXPECT_EQ(validateBatch(ConstPointView::interleaved(in.data(), 2),
+                          PointView::interleaved(out.data(), 2)),
+            ConversionStatus::Ok);
+  // 上書き変換
+  EXPECT_EQ(validateBatch(ConstPointView::interleaved(in.data(), 2),
+                          PointView::interleaved(in.data(), 2)),
+            ConversionStatus::Ok);
+  // 空の一括変換は nullptr でも成功とする
+  EXPECT_EQ(validateBatch(ConstPointView(), PointView()),
+            ConversionStatus::Ok);
+}
+
+/**
+ * @brief 入出力の点数が異なる場合は SizeMismatch
+ */
+TEST(ConversionStatusTest, SizeMismatch) {
+  std::vector<double> in(6, 0.0), out(3, 0.0);
+  EXPECT_EQ(validateBatch(ConstPointView::interleaved(in.data(), 2),
+                          PointView::interleaved(out.data(), 1)),
+            ConversionStatus::SizeMismatch);
+}
+
+/**
+ * @brief 成分のポインタが nullptr の場合は NullBuffer
+ */
+TEST(ConversionStatusTest, NullBuffer) {
+  std::vector<double> out(3, 0.0);
+  EXPECT_EQ(validateBatch(ConstPointView::interleaved(nullptr, 1),
+                          PointView::interleaved(out.data(), 1)),
+            ConversionStatus::NullBuffer);
+}
+
+/**
+ * @brief 2 点以上で間隔が 0 の場合は InvalidStride
+ */
+TEST(ConversionStatusTest, InvalidStride) {
+  std::vector<double> in(6, 0.0), out(6, 0.0);
+  EXPECT_EQ(validateBatch(ConstPointView::interleaved(in.data(), 2, 0),
+                          PointView::interleaved(out.data(), 2)),
+            ConversionStatus::InvalidStride);
+}
+
+/**
+ * @brief 結果コードの名前
+ */
+TEST(ConversionStatusTest, ToString) {
+  EXPECT_EQ(std::string(toString(ConversionStatus::Ok)), "Ok");
+  EXPECT_EQ(std::string(toString(ConversionStatus::SizeMismatch)),
+            "SizeMismatch");
+}
@@ -1,6 +1,8 @@
 #include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
 
+#include <array>
 #include <cmath>
+#include <vector>
 
 #include "coordinate/ECEF_coordinate.hpp"  // ECEFCoordinate の定義
 #include "coordinate/geo_coordinate.hpp"   // GeoCoordinate の定義
@@ -85,3 +87,50 @@ TEST_F(GeoToECEFConverterTest, InvalidInputThrows) {
   ECEFCoordinate ecef(1.0, 2.0, 3.0);
   EXPECT_THROW(converter->convert(ecef), std::invalid_argument);
 }
+
+/**
+ * @brief 一括変換の結果が単点変換と一致する（SoA 入力、AoS 出力）
+ */
+TEST_F(GeoToECEFConverterTest, ConvertBatchMatchesConvert) {
+  std::vector<double> lat = {0.0, 35.0, -60.0};
+  std::vector<double> lon = {0.0, 139.0, -75.0};
+  std::vector<double> h = {0.0, 100.0, -20.0};
+  std::vector<double> out(9, 0.0);
+  ConversionStatus status = converter->convertBatch(
+      ConstPointView::columns(lat.data(), lon.data(), h.data(), 3),
+      PointView::interleaved(out.data(), 3));
+  ASSERT_EQ(status, ConversionStatus::Ok);
+
+  for (std::size_t i = 0; i < 3; ++i) {
+    auto result = converter->convert(GeoCoordinate(lat[i], lon[i], h[i]));
+    auto ecef = dynamic_cast<ECEFCoordinate*>(result.get());
+    ASSERT_NE(ecef, nullptr);
+    EXPECT_DOUBLE_EQ(out[3 * i], ecef->getX());
+    EXPECT_DOUBLE_EQ(out[3 * i + 1], ecef->getY());
+    EXPECT_DOUBLE_EQ(out[3 * i + 2], ecef->getZ());
+  }
+}
+
+/**
+ * @brief 1 点の変換（convertPoint）
+ */
+TEST_F(GeoToECEFConverterTest, ConvertPoint) {
+  std::array<double, 3> ecef{};
+  ASSERT_EQ(converter->convertPoint({0.0, 0.0, 100.0}, ecef),
+            ConversionStatus::Ok);
+  EXPECT_NEAR(ecef[0], 6378137.0 + 100.0, 1e-3);
+  EXPECT_NEAR(ecef[1], 0.0, 1e-3);
+  EXPECT_NEAR(ecef[2], 0.0, 1e-3);
+}
+
+/**
+ * @brief 不正な入出力では例外を送出せず、出力にも書き込まない
+ */
+TEST_F(GeoToECEFConverterTest, ConvertBatchRejectsSizeMismatch) {
+  std::vector<double> in(6, 0.0);
+  std::vector<double> out(3, -1.0);
+  EXPECT_EQ(converter->convertBatch(ConstPointView::interleaved(in.data(), 2),
+                                    PointView::interleaved(out.data(), 1)),
+            ConversionStatus::SizeMismatch);
+  EXPECT_DOUBLE_EQ(out[0], -1.0);
+}
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 #include "coordinate/ECEF_coordinate.hpp"  // ECEFCoordinate の定義（不正入力テスト用）
 #include "coordinate/ENU_coordinate.hpp"  // ENUCoordinate の定義
@@ -68,4 +69,37 @@ TEST_F(GeoToENUConverterTest, NonZeroInputProducesNonZeroENU) {
 TEST_F(GeoToENUConverterTest, InvalidInputThrows) {
   ECEFCoordinate ecef(1000.0, 2000.0, 3000.0);
   EXPECT_THROW(converter->convert(ecef), std::invalid_argument);
-}
\ No newline at end of file
+}
+
+/**
+ * @brief 一括変換の結果が単点変換と一致する
+ */
+TEST_F(GeoToENUConverterTest, ConvertBatchMatchesConvert) {
+  std::vector<double> geo = {0.001, 0.002, 10.0, -0.01, 0.005, -3.0};
+  std::vector<double> out(6, 0.0);
+  ASSERT_EQ(converter->convertBatch(ConstPointView::interleaved(geo.data(), 2),
+                                    PointView::interleaved(out.data(), 2)),
+            ConversionStatus::Ok);
+
+  for (std::size_t i = 0; i < 2; ++i) {
+    auto result = converter->convert(
+        GeoCoordinate(geo[3 * i], geo[3 * i + 1], geo[3 * i + 2]));
+    auto enu = dynamic_cast<ENUCoordinate*>(result.get());
+    ASSERT_NE(enu, nullptr);
+    EXPECT_NEAR(out[3 * i], enu->getEast(), 1e-9);
+    EXPECT_NEAR(out[3 * i + 1], enu->getNorth(), 1e-9);
+    EXPECT_NEAR(out[3 * i + 2], enu->getUp(), 1e-9);
+  }
+}
+
+/**
+ * @brief 検証に失敗した場合は内部の変換器を呼び出さない
+ */
+TEST_F(GeoToENUConverterTest, ConvertBatchRejectsSizeMismatch) {
+  std::vector<double> in(6, 0.0);
+  std::vector<double> out(3, -1.0);
+  EXPECT_EQ(converter->convertBatch(ConstPointView::interleaved(in.data(), 2),
+                                    PointView::interleaved(out.data(), 1)),
+            ConversionStatus::SizeMismatch);
+  EXPECT_DOUBLE_EQ(out[0], -1.0);
+}
@@ -0,0 +1,255 @@
+#include "converter/quantized_batch.hpp"  // 量子化入出力の汎用の一括変換
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "common/sample_points.hpp"             // テスト用の決定的な点列
+#include "converter/ECEF_to_ENU_converter.hpp"  // ECEFToENUConverter の定義
+#include "converter/ECEF_to_geo_converter.hpp"  // ECEFToGeoConverter の定義
+#include "converter/ENU_to_ECEF_converter.hpp"  // ENUToECEFConverter の定義
+#include "converter/ENU_to_geo_converter.hpp"   // ENUToGeoConverter の定義
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "converter/geo_to_ENU_converter.hpp"   // GeoToENUConverter の定義
+#include "coordinate/point_buffer.hpp"          // PointBuffer の定義
+#include "gtest/gtest.h"
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+namespace {
+/// 1 ブロック（256 点）の倍数でない点数
+constexpr std::size_t kPoints = 1000;
+
+const GeoCoordinate kOrigin{35.0, 139.0, 40.0};
+
+/// ECEF はセンチメートル、ENU はミリメートルで量子化する
+const Quantization kEcefQuantization = Quantization::uniform(1e-2);
+const Quantization kEnuQuantization = Quantization::uniform(1e-3, {0, 0, 50});
+
+/**
+ * @brief 原点の周囲 ±1 度の緯度・経度・高度
+ */
+PointBuffer geoSamples() {
+  return trans_geo::test::geoSamples(kPoints, {34.0, 36.0}, {138.0, 140.0},
+                                     {0.0, 3000.0});
+}
+
+PointBuffer convert(const ICoordinateConverter& converter,
+                    ConstPointView input) {
+  PointBuffer output(input.size());
+  EXPECT_EQ(converter.convertBatch(input, output.view()),
+            ConversionStatus::Ok);
+  return output;
+}
+
+/**
+ * @brief convertBatch() の結果を quantize() した値
+ */
+std::vector<std::int32_t> quantizeReference(
+    const ICoordinateConverter& converter, ConstPointView input,
+    const Quantization& quantization) {
+  PointBuffer converted = convert(converter, input);
+  std::vector<std::int32_t> quantized(3 * input.size());
+  bool saturated = false;
+  for (std::size_t i = 0; i < input.size(); ++i) {
+    for (std::size_t k = 0; k < 3; ++k) {
+      quantized[3 * i + k] =
+          quantize(converted.view()(i, k), quantization.scale[k],
+                   quantization.offset[k], saturated);
+    }
+  }
+  return quantized;
+}
+
+/**
+ * @brief 入力を dequantize() してから convertBatch() した値
+ */
+PointBuffer dequantizeReference(const ICoordinateConverter& converter,
+                                const std::vector<std::int32_t>& input,
+                                const Quantization& quantization) {
+  std::size_t size = input.size() / 3;
+  PointBuffer restored(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    for (std::size_t k = 0; k < 3; ++k) {
+      restored.view()(i, k) = dequantize(
+          input[3 * i + k], quantization.scale[k], quantization.offset[k]);
+    }
+  }
+  return convert(converter, restored.view());
+}
+
+/**
+ * @brief 融合した版・汎用の版とも、変換してから量子化した値と一致する
+ */
+template <typename Converter>
+void expectQuantizedMatches(const Converter& converter, ConstPointView input,
+                            const Quantization& quantization) {
+  std::vector<std::int32_t> expected =
+      quantizeReference(converter, input, quantization);
+  std::vector<std::int32_t> fused(expected.size());
+  std::vector<std::int32_t> generic(expected.size());
+  QuantizedPointView fusedView =
+      QuantizedPointView::interleaved(fused.data(), input.size());
+  ASSERT_EQ(converter.convertBatchQuantized(input, fusedView, quantization),
+            ConversionStatus::Ok);
+  ASSERT_EQ(convertBatchQuantized(
+                converter, input,
+                QuantizedPointView::interleaved(generic.data(), input.size()),
+                quantization),
+            ConversionStatus::Ok);
+  EXPECT_EQ(fused, expected);
+  EXPECT_EQ(generic, expected);
+}
+
+/**
+ * @brief 融合した版・汎用の版とも、逆量子化してから変換した値と一致する
+ */
+template <typename Converter>
+void expectDequantizedMatches(const Converter& converter,
+                              const std::vector<std::int32_t>& input,
+                              const Quantization& quantization) {
+  std::size_t size = input.size() / 3;
+  ConstQuantizedPointView inputView =
+      ConstQuantizedPointView::interleaved(input.data(), size);
+  PointBuffer expected = dequantizeReference(converter, input, quantization);
+  PointBuffer fused(size);
+  PointBuffer generic(size);
+  ASSERT_EQ(
+      converter.convertBatchDequantized(inputView, quantization, fused.view()),
+      ConversionStatus::Ok);
+  ASSERT_EQ(convertBatchDequantized(converter, inputView, quantization,
+                                    generic.view()),
+            ConversionStatus::Ok);
+  for (std::size_t i = 0; i < size; ++i) {
+    ASSERT_EQ(fused.view().get(i), expected.view().get(i)) << i;
+    ASSERT_EQ(generic.view().get(i), expected.view().get(i)) << i;
+  }
+}
+}  // namespace
+
+/**
+ * @brief Geo → ECEF → ENU の量子化出力と、その逆変換の逆量子化入力
+ */
+TEST(QuantizedBatchTest, FusedMatchesConvertThenQuantize) {
+  PointBuffer geo = geoSamples();
+  GeoToECEFConverter geoToEcef(WGS84);
+  ECEFToENUConverter ecefToEnu(WGS84, kOrigin);
+  ENUToECEFConverter enuToEcef(WGS84, kOrigin);
+  PointBuffer ecef = convert(geoToEcef, geo.view());
+  PointBuffer enu = convert(ecefToEnu, ecef.view());
+
+  expectQuantizedMatches(geoToEcef, geo.view(), kEcefQuantization);
+  expectQuantizedMatches(ecefToEnu, ecef.view(), kEnuQuantization);
+  expectQuantizedMatches(enuToEcef, enu.view(), kEcefQuantization);
+
+  std::vector<std::int32_t> ecefQuantized =
+      quantizeReference(geoToEcef, geo.view(), kEcefQuantization);
+  std::vector<std::int32_t> enuQuantized =
+      quantizeReference(ecefToEnu, ecef.view(), kEnuQuantization);
+  expectDequantizedMatches(ecefToEnu, ecefQuantized, kEcefQuantization);
+  expectDequantizedMatches(enuToEcef, enuQuantized, kEnuQuantization);
+  for (GeodeticPrecision precision :
+       {GeodeticPrecision::Reference, GeodeticPrecision::Micrometre,
+        GeodeticPrecision::Millimetre, GeodeticPrecision::Decimetre}) {
+    expectDequantizedMatches(ECEFToGeoConverter(WGS84, precision),
+                             ecefQuantized, kEcefQuantization);
+  }
+}
+
+/**
+ * @brief 融合した版を持たない変換器も汎用の版で量子化できる
+ */
+TEST(QuantizedBatchTest, GenericConvertersRoundTrip) {
+  PointBuffer geo = geoSamples();
+  GeoToENUConverter geoToEnu(WGS84, kOrigin);
+  ENUToGeoConverter enuToGeo(WGS84, kOrigin);
+  std::vector<std::int32_t> enu(3 * kPoints);
+  ASSERT_EQ(convertBatchQuantized(
+                geoToEnu, geo.view(),
+                QuantizedPointView::interleaved(enu.data(), kPoints),
+                kEnuQuantization),
+            ConversionStatus::Ok);
+  EXPECT_EQ(enu, quantizeReference(geoToEnu, geo.view(), kEnuQuantization));
+
+  PointBuffer back(kPoints);
+  ASSERT_EQ(convertBatchDequantized(
+                enuToGeo, ConstQuantizedPointView::interleaved(enu.data(),
+                                                               kPoints),
+                kEnuQuantization, back.view()),
+            ConversionStatus::Ok);
+  for (std::size_t i = 0; i < kPoints; ++i) {
+    // ミリメートルの量子化誤差（0.5 mm）は緯度・経度で 1e-8 度未満
+    EXPECT_NEAR(back.view()(i, 0), geo.view()(i, 0), 1e-8);
+    EXPECT_NEAR(back.view()(i, 1), geo.view()(i, 1), 1e-8);
+    EXPECT_NEAR(back.view()(i, 2), geo.view()(i, 2), 1e-3);
+  }
+}
+
+/**
+ * @brief 範囲外・NaN の成分は飽和し、全点を書き込んだうえで Saturated を返す
+ */
+TEST(QuantizedBatchTest, SaturationIsReported) {
+  constexpr std::int32_t kMin = std::numeric_limits<std::int32_t>::min();
+  constexpr std::int32_t kMax = std::numeric_limits<std::int32_t>::max();
+  ECEFToENUConverter converter(WGS84, kOrigin);
+  PointBuffer ecef = convert(GeoToECEFConverter(WGS84), geoSamples().view());
+  // ミリメートルでは原点から 2147 km を超える点は飽和する
+  ecef.view().set(10, {0.0, 0.0, 0.0});
+  ecef.view().set(700, {NAN, 0.0, 0.0});
+  std::vector<std::int32_t> expected =
+      quantizeReference(converter, ecef.view(), kEnuQuantization);
+
+  std::vector<std::int32_t> fused(3 * kPoints);
+  std::vector<std::int32_t> generic(3 * kPoints);
+  EXPECT_EQ(converter.convertBatchQuantized(
+                ecef.view(), QuantizedPointView::interleaved(fused.data(),
+                                                             kPoints),
+                kEnuQuantization),
+            ConversionStatus::Saturated);
+  EXPECT_EQ(convertBatchQuantized(
+                converter, ecef.view(),
+                QuantizedPointView::interleaved(generic.data(), kPoints),
+                kEnuQuantization),
+            ConversionStatus::Saturated);
+  EXPECT_EQ(fused, expected);
+  EXPECT_EQ(generic, expected);
+  EXPECT_EQ(fused[3 * 10 + 2], kMin);
+  EXPECT_EQ(fused[3 * 700], kMin);
+  EXPECT_NE(fused[3 * 11], kMin);
+  EXPECT_NE(fused[3 * 11], kMax);
+}
+
+/**
+ * @brief 不正な換算と入出力は変換前に検出する
+ */
+TEST(QuantizedBatchTest, RejectsInvalidArguments) {
+  ENUToECEFConverter converter(WGS84, kOrigin);
+  std::vector<double> in(6, 0.0);
+  std::vector<std::int32_t> out(6, 0);
+  ConstPointView input = ConstPointView::interleaved(in.data(), 2);
+  QuantizedPointView output = QuantizedPointView::interleaved(out.data(), 2);
+  EXPECT_EQ(converter.convertBatchQuantized(input, output,
+                                            Quantization::uniform(0.0)),
+            ConversionStatus::InvalidQuantization);
+  EXPECT_EQ(convertBatchQuantized(converter, input, output,
+                                  Quantization::uniform(-1.0)),
+            ConversionStatus::InvalidQuantization);
+  EXPECT_EQ(converter.convertBatchQuantized(
+                input, QuantizedPointView::interleaved(out.data(), 1),
+                kEcefQuantization),
+            ConversionStatus::SizeMismatch);
+  EXPECT_EQ(converter.convertBatchDequantized(
+                ConstQuantizedPointView::interleaved(nullptr, 2),
+                kEnuQuantization, PointView::interleaved(in.data(), 2)),
+            ConversionStatus::NullBuffer);
+  EXPECT_EQ(ECEFToGeoConverter(WGS84).convertBatchDequantized(
+                ConstQuantizedPointView::interleaved(out.data(), 2),
+                Quantization::uniform(NAN),
+                PointView::interleaved(in.data(), 2)),
+            ConversionStatus::InvalidQuantization);
+  EXPECT_EQ(std::string(toString(ConversionStatus::Saturated)), "Saturated");
+}
@@ -0,0 +1,150 @@
+#include "converter/tiled_ENU_frames.hpp"  // TiledENUFrames の定義
+
+#include <array>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+#include "converter/ENU_frame.hpp"              // ENUFrame の定義
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "coordinate/point_buffer.hpp"          // PointBuffer の定義
+#include "gtest/gtest.h"
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+/**
+ * @brief タイル番号の割り当て（正規化・丸め・端）
+ */
+TEST(TiledENUFramesTest, TileAssignment) {
+  TiledENUFrames frames(WGS84, 1.0);
+  EXPECT_EQ(frames.getRowCount(), 180u);
+  EXPECT_EQ(frames.getColumnCount(), 360u);
+
+  EXPECT_EQ(frames.tileOf(-90.0, -180.0), 0u);
+  EXPECT_EQ(frames.tileOf(-89.5, -179.5), 0u);
+  EXPECT_EQ(frames.tileOf(-90.0, -179.0), 1u);
+  EXPECT_EQ(frames.tileOf(90.0, 179.999), 180u * 360u - 1u);
+  EXPECT_EQ(frames.tileOf(95.0, 0.0), frames.tileOf(90.0, 0.0));
+  EXPECT_EQ(frames.tileOf(35.5, 180.0), frames.tileOf(35.5, -180.0));
+  EXPECT_EQ(frames.tileOf(35.5, 539.5), frames.tileOf(35.5, 179.5));
+  EXPECT_EQ(frames.tileOf(35.5, 139.5), 125u * 360u + 319u);
+  // NaN・無限大はタイル 0、極端に大きな経度も範囲内のタイルになる
+  EXPECT_EQ(frames.tileOf(NAN, 139.5), 0u);
+  EXPECT_EQ(frames.tileOf(35.5, INFINITY), 0u);
+  EXPECT_EQ(frames.tileOf(-INFINITY, 0.0), 0u);
+  EXPECT_LT(frames.tileOf(35.5, 1e300), 180u * 360u);
+  EXPECT_LT(frames.tileOf(35.5, -1e300), 180u * 360u);
+
+  GeoCoordinate origin = frames.getTileOrigin(frames.tileOf(35.2, 139.7));
+  EXPECT_DOUBLE_EQ(origin.getLatitude(), 35.5);
+  EXPECT_DOUBLE_EQ(origin.getLongitude(), 139.5);
+  EXPECT_THROW(frames.getTileOrigin(180u * 360u), std::out_of_range);
+
+  // 割り切れない大きさでは北端・東端のタイルが小さくなる
+  TiledENUFrames uneven(WGS84, 7.0);
+  EXPECT_EQ(uneven.getRowCount(), 26u);
+  EXPECT_EQ(uneven.getColumnCount(), 52u);
+  GeoCoordinate last = uneven.getTileOrigin(26u * 52u - 1u);
+  EXPECT_DOUBLE_EQ(last.getLatitude(), 87.5);
+  EXPECT_DOUBLE_EQ(last.getLongitude(), 178.5);
+
+  EXPECT_THROW(TiledENUFrames(WGS84, 0.0), std::invalid_argument);
+  EXPECT_THROW(TiledENUFrames(WGS84, 91.0), std::invalid_argument);
+}
+
+/**
+ * @brief タイルの座標系がタイル中心を原点とする ENUFrame と一致する
+ */
+TEST(TiledENUFramesTest, TileFrameMatchesENUFrame) {
+  TiledENUFrames frames(WGS84);
+  for (std::uint32_t tile : {0u, frames.tileOf(35.6, 139.7),
+                             frames.tileOf(-33.9, 18.4)}) {
+    ENUFrame expected(WGS84, frames.getTileOrigin(tile));
+    TileFrame frame = frames.getTileFrame(tile);
+    for (std::size_t k = 0; k < 3; ++k) {
+      EXPECT_DOUBLE_EQ(frame.originEcef[k], expected.getOriginECEF()[k]);
+    }
+    for (std::size_t k = 0; k < 9; ++k) {
+      EXPECT_DOUBLE_EQ(frame.rotation[k], expected.getRotation()[k]);
+    }
+  }
+}
+
+/**
+ * @brief 大陸規模の点列を float で往復してもミリメートル精度を保つ
+ */
+TEST(TiledENUFramesTest, RoundTripKeepsMillimetrePrecision) {
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<double> lat(-60.0, 70.0);
+  std::uniform_real_distribution<double> lon(-180.0, 180.0);
+  std::uniform_real_distribution<double> h(-100.0, 4000.0);
+  PointBuffer geo(5000);
+  for (std::size_t i = 0; i < geo.size(); ++i) {
+    geo.view().set(i, {lat(rng), lon(rng), h(rng)});
+  }
+  PointBuffer ecef(geo.size());
+  GeoToECEFConverter(WGS84).convertBatch(geo.view(), ecef.view());
+
+  TiledENUFrames frames(WGS84);
+  TiledENUBatch batch;
+  ASSERT_EQ(frames.fromGeo(geo.view(), batch), ConversionStatus::Ok);
+  ASSERT_EQ(batch.size(), geo.size());
+  ASSERT_EQ(batch.offsets.size(), batch.groupCount() + 1);
+  EXPECT_GT(batch.groupCount(), 1000u);
+
+  for (std::size_t g = 0; g < batch.groupCount(); ++g) {
+    if (g > 0) {
+      EXPECT_LT(batch.tiles[g - 1], batch.tiles[g]);
+    }
+    for (std::size_t j = batch.offsets[g]; j < batch.offsets[g + 1]; ++j) {
+      std::size_t i = batch.order[j];
+      EXPECT_EQ(batch.tiles[g], frames.tileOf(geo.view()(i, 0),
+                                              geo.view()(i, 1)));
+      // 各点はタイル中心から 0.5° 以内
+      EXPECT_LT(std::abs(batch.enu[0][j]), 30000.0f);
+      EXPECT_LT(std::abs(batch.enu[1][j]), 30000.0f);
+    }
+  }
+
+  PointBuffer back(geo.size());
+  ASSERT_EQ(frames.toECEF(batch, back.view()), ConversionStatus::Ok);
+  for (std::size_t i = 0; i < geo.size(); ++i) {
+    for (std::size_t k = 0; k < 3; ++k) {
+      EXPECT_NEAR(back.view()(i, k), ecef.view()(i, k), 5e-3);
+    }
+  }
+
+  // ECEF 入力でも同じタイル・同じ ENU 座標になる
+  TiledENUBatch fromEcef;
+  ASSERT_EQ(frames.fromECEF(ecef.view(), fromEcef), ConversionStatus::Ok);
+  ASSERT_EQ(fromEcef.size(), batch.size());
+  EXPECT_EQ(fromEcef.tiles, batch.tiles);
+  EXPECT_EQ(fromEcef.order, batch.order);
+  for (std::size_t j = 0; j < batch.size(); ++j) {
+    EXPECT_NEAR(fromEcef.enu[0][j], batch.enu[0][j], 1e-2);
+  }
+}
+
+/**
+ * @brief 不正なビューと空の入力
+ */
+TEST(TiledENUFramesTest, InvalidViews) {
+  TiledENUFrames frames(WGS84);
+  TiledENUBatch batch;
+  EXPECT_EQ(frames.fromGeo(ConstPointView::columns(nullptr, nullptr, nullptr,
+                                                   3),
+                           batch),
+            ConversionStatus::NullBuffer);
+  EXPECT_EQ(frames.fromGeo(ConstPointView{}, batch), ConversionStatus::Ok);
+  EXPECT_EQ(batch.size(), 0u);
+  EXPECT_EQ(batch.groupCount(), 0u);
+
+  std::array<double, 3> geo = {35.0, 139.0, 0.0};
+  ASSERT_EQ(frames.fromGeo(ConstPointView::interleaved(geo.data(), 1), batch),
+            ConversionStatus::Ok);
+  PointBuffer tooLarge(2);
+  EXPECT_EQ(frames.toECEF(batch, tooLarge.view()),
+            ConversionStatus::SizeMismatch);
+}
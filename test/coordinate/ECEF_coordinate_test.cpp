@@ -44,6 +44,17 @@ TEST_F(ECEFCoordinateTest, GetValues) {
   EXPECT_DOUBLE_EQ(values[2], 3000.0);
 }
 
+/**
+ * @brief getValueArray() / valueCount() のテスト
+ */
+TEST_F(ECEFCoordinateTest, GetValueArray) {
+  EXPECT_EQ(coord->valueCount(), 3u);
+  std::array<double, 3> values = coord->getValueArray();
+  EXPECT_DOUBLE_EQ(values[0], 1000.0);
+  EXPECT_DOUBLE_EQ(values[1], 2000.0);
+  EXPECT_DOUBLE_EQ(values[2], 3000.0);
+}
+
 /**
  * @brief 有効な 3 要素ベクトルによる setValues() のテスト
  */
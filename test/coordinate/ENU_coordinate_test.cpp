@@ -52,6 +52,17 @@ TEST_F(ENUCoordinateTest, GetValues) {
   EXPECT_DOUBLE_EQ(vals[2], 300.0);
 }
 
+/**
+ * @brief getValueArray() / valueCount() のテスト
+ */
+TEST_F(ENUCoordinateTest, GetValueArray) {
+  EXPECT_EQ(enu->valueCount(), 3u);
+  std::array<double, 3> vals = enu->getValueArray();
+  EXPECT_DOUBLE_EQ(vals[0], 100.0);
+  EXPECT_DOUBLE_EQ(vals[1], 200.0);
+  EXPECT_DOUBLE_EQ(vals[2], 300.0);
+}
+
 /**
  * @brief toString() の出力形式テスト
  */
@@ -135,4 +146,20 @@ TEST_F(ENUCoordinateTest, CloneTest) {
   enuCloneBase->setValues({700.0, 800.0, 900.0});
   EXPECT_NE(enuCloneBase->toString(), enu->toString());
 }
+
+/**
+ * @brief clone() とハンドル指定のコンストラクタは原点を共有する
+ */
+TEST_F(ENUCoordinateTest, SharesOriginHandle) {
+  std::unique_ptr<ICoordinate> copy = enu->clone();
+  auto* copyEnu = dynamic_cast<ENUCoordinate*>(copy.get());
+  ASSERT_NE(copyEnu, nullptr);
+  EXPECT_EQ(copyEnu->getOriginHandle().get(), enu->getOriginHandle().get());
+
+  ENUCoordinate other(1.0, 2.0, 3.0, enu->getOriginHandle());
+  EXPECT_EQ(other.getOriginHandle().get(), enu->getOriginHandle().get());
+
+  EXPECT_THROW(ENUCoordinate(1.0, 2.0, 3.0, OriginHandle()),
+               std::invalid_argument);
+}
 }  // namespace trans_geo::coordinate::test
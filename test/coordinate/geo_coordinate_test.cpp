@@ -50,6 +50,21 @@ TEST_F(GeoCoordinateTest, GetValuesThreeElement) {
   EXPECT_DOUBLE_EQ(coord3->getAltitude().value(), 100.0);
 }
 
+/**
+ * @brief getValueArray() / valueCount() が getValues() と一致するテスト
+ */
+TEST_F(GeoCoordinateTest, GetValueArray) {
+  EXPECT_EQ(coord2->valueCount(), 2u);
+  std::array<double, 3> values2 = coord2->getValueArray();
+  EXPECT_DOUBLE_EQ(values2[0], 35.6895);
+  EXPECT_DOUBLE_EQ(values2[1], 139.6917);
+  EXPECT_DOUBLE_EQ(values2[2], 0.0);  // 高度なしは 0
+
+  EXPECT_EQ(coord3->valueCount(), 3u);
+  std::array<double, 3> values3 = coord3->getValueArray();
+  EXPECT_DOUBLE_EQ(values3[2], 100.0);
+}
+
 /**
  * @brief setValues() で2要素のベクトルを設定するテスト
  */
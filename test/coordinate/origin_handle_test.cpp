@@ -0,0 +1,59 @@
+#include "coordinate/origin_handle.hpp"  // OriginHandle の定義
+
+#include <memory>
+#include <stdexcept>
+
+#include "coordinate/ECEF_coordinate.hpp"  // ECEFCoordinate クラスのヘッダ
+#include "coordinate/geo_coordinate.hpp"   // GeoCoordinate クラスのヘッダ
+#include "gtest/gtest.h"
+
+namespace trans_geo::coordinate::test {
+/**
+ * @brief makeOriginHandle() は原点を複製したハンドルを返す
+ */
+TEST(OriginHandleTest, MakeOriginHandleClones) {
+  GeoCoordinate origin(35.0, 139.0, 50.0);
+  OriginHandle handle = makeOriginHandle(origin);
+  ASSERT_NE(handle, nullptr);
+  EXPECT_NE(handle.get(), &origin);
+  EXPECT_EQ(handle->toString(), origin.toString());
+}
+
+/**
+ * @brief 型と座標値が等しい原点は同じハンドルにインターンされる
+ */
+TEST(OriginHandleTest, InternSharesEqualOrigins) {
+  OriginHandle first = internOrigin(GeoCoordinate(35.0, 139.0, 50.0));
+  OriginHandle second = internOrigin(GeoCoordinate(35.0, 139.0, 50.0));
+  EXPECT_EQ(first.get(), second.get());
+
+  // 値・要素数・型が異なる原点は別のハンドルとなる
+  EXPECT_NE(internOrigin(GeoCoordinate(35.0, 139.0, 51.0)).get(),
+            first.get());
+  EXPECT_NE(internOrigin(GeoCoordinate(35.0, 139.0)).get(), first.get());
+  EXPECT_NE(internOrigin(ECEFCoordinate(35.0, 139.0, 50.0)).get(),
+            first.get());
+}
+
+/**
+ * @brief 参照されなくなった原点は解放される
+ */
+TEST(OriginHandleTest, InternDoesNotKeepOriginsAlive) {
+  std::weak_ptr<const trans_geo::interface::ICoordinate> weak =
+      internOrigin(GeoCoordinate(-12.0, 34.0, 5.0));
+  EXPECT_TRUE(weak.expired());
+}
+
+/**
+ * @brief 要素数が不正な原点は拒否される
+ */
+TEST(OriginHandleTest, RejectsInvalidOrigin) {
+  class EmptyCoordinate : public GeoCoordinate {
+   public:
+    EmptyCoordinate() : GeoCoordinate(0.0, 0.0) {}
+    std::size_t valueCount() const noexcept override { return 1; }
+  };
+  EXPECT_THROW(makeOriginHandle(EmptyCoordinate()), std::invalid_argument);
+  EXPECT_THROW(internOrigin(EmptyCoordinate()), std::invalid_argument);
+}
+}  // namespace trans_geo::coordinate::test
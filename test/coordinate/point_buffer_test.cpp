@@ -0,0 +1,34 @@
+#include "coordinate/point_buffer.hpp"  // PointBuffer クラスのヘッダ
+
+#include "gtest/gtest.h"
+
+namespace trans_geo::coordinate::test {
+/**
+ * @brief 追加した点を成分ごとの配列とビューから参照できる
+ */
+TEST(PointBufferTest, PushBackAndView) {
+  PointBuffer buffer;
+  buffer.push_back({1.0, 2.0, 3.0});
+  buffer.push_back({4.0, 5.0, 6.0});
+  ASSERT_EQ(buffer.size(), 2u);
+  EXPECT_DOUBLE_EQ(buffer.component(1)[1], 5.0);
+
+  PointView view = buffer.view();
+  EXPECT_EQ(view.size(), 2u);
+  EXPECT_EQ(view.stride(), 1u);
+  view.set(0, {7.0, 8.0, 9.0});
+  EXPECT_DOUBLE_EQ(buffer.component(2)[0], 9.0);
+}
+
+/**
+ * @brief サイズ変更で追加した点は 0 で初期化される
+ */
+TEST(PointBufferTest, ResizeAndClear) {
+  PointBuffer buffer(2);
+  EXPECT_DOUBLE_EQ(buffer.component(0)[1], 0.0);
+  buffer.resize(5);
+  EXPECT_EQ(buffer.view().size(), 5u);
+  buffer.clear();
+  EXPECT_EQ(buffer.size(), 0u);
+}
+}  // namespace trans_geo::coordinate::test
@@ -0,0 +1,84 @@
+#include "coordinate/point_view.hpp"  // PointView クラスのヘッダ
+
+#include <array>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace trans_geo::coordinate::test {
+/**
+ * @brief AoS 配列から作成したビューで各点の成分を参照できる
+ */
+TEST(PointViewTest, InterleavedAccess) {
+  std::vector<double> data = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+  PointView view = PointView::interleaved(data.data(), 2);
+  EXPECT_EQ(view.size(), 2u);
+  EXPECT_EQ(view.stride(), 3u);
+  EXPECT_DOUBLE_EQ(view(1, 0), 4.0);
+  EXPECT_DOUBLE_EQ(view(1, 2), 6.0);
+
+  std::array<double, 3> first = view.get(0);
+  EXPECT_DOUBLE_EQ(first[0], 1.0);
+  EXPECT_DOUBLE_EQ(first[1], 2.0);
+  EXPECT_DOUBLE_EQ(first[2], 3.0);
+}
+
+/**
+ * @brief SoA 配列から作成したビューへの書き込みが各配列に反映される
+ */
+TEST(PointViewTest, ColumnsWrite) {
+  std::vector<double> x(3, 0.0), y(3, 0.0), z(3, 0.0);
+  PointView view = PointView::columns(x.data(), y.data(), z.data(), 3);
+  view.set(2, {7.0, 8.0, 9.0});
+  EXPECT_DOUBLE_EQ(x[2], 7.0);
+  EXPECT_DOUBLE_EQ(y[2], 8.0);
+  EXPECT_DOUBLE_EQ(z[2], 9.0);
+}
+
+/**
+ * @brief 間隔を指定すると状態ベクトル列の位置成分のみを指せる
+ */
+TEST(PointViewTest, StridedStateVectors) {
+  std::vector<double> states = {1.0, 2.0, 3.0, 10.0, 20.0, 30.0,
+                                4.0, 5.0, 6.0, 40.0, 50.0, 60.0};
+  ConstPointView positions = ConstPointView::interleaved(states.data(), 2, 6);
+  ConstPointView velocities =
+      ConstPointView::interleaved(states.data() + 3, 2, 6);
+  EXPECT_DOUBLE_EQ(positions.get(1)[0], 4.0);
+  EXPECT_DOUBLE_EQ(velocities.get(1)[2], 60.0);
+}
+
+/**
+ * @brief 部分ビューは元のビューの範囲内の点を指す
+ */
+TEST(PointViewTest, Subview) {
+  std::vector<double> data = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0};
+  PointView view = PointView::interleaved(data.data(), 3);
+  PointView tail = view.subview(1, 2);
+  EXPECT_EQ(tail.size(), 2u);
+  EXPECT_DOUBLE_EQ(tail(0, 0), 4.0);
+  EXPECT_DOUBLE_EQ(tail(1, 1), 8.0);
+}
+
+/**
+ * @brief 可変ビューは読み取り専用ビューに暗黙変換できる
+ */
+TEST(PointViewTest, ConvertsToConstView) {
+  std::vector<double> data = {1.0, 2.0, 3.0};
+  PointView view = PointView::interleaved(data.data(), 1);
+  ConstPointView constView = view;
+  EXPECT_EQ(constView.component(0), data.data());
+  EXPECT_EQ(constView.size(), 1u);
+}
+
+/**
+ * @brief nullptr を含むビューは点数が 0 の場合のみ有効とみなされる
+ */
+TEST(PointViewTest, HasData) {
+  EXPECT_TRUE(PointView().hasData());
+  EXPECT_FALSE(PointView::interleaved(nullptr, 1).hasData());
+  double x = 0.0;
+  EXPECT_FALSE(PointView::columns(&x, &x, nullptr, 1).hasData());
+  EXPECT_TRUE(PointView::columns(&x, &x, &x, 1).hasData());
+}
+}  // namespace trans_geo::coordinate::test
@@ -0,0 +1,62 @@
+#include "coordinate/quantization.hpp"  // quantize / dequantize の定義
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "gtest/gtest.h"
+
+using namespace trans_geo::coordinate;
+
+/**
+ * @brief 最近接偶数丸めで量子化し、q * scale + offset で戻す
+ */
+TEST(QuantizationTest, RoundsToNearestEven) {
+  bool saturated = false;
+  EXPECT_EQ(quantize(2.5, 1.0, 0.0, saturated), 2);
+  EXPECT_EQ(quantize(3.5, 1.0, 0.0, saturated), 4);
+  EXPECT_EQ(quantize(-2.5, 1.0, 0.0, saturated), -2);
+  EXPECT_EQ(quantize(-2.6, 1.0, 0.0, saturated), -3);
+  EXPECT_EQ(quantize(1234.5678, 1e-3, 1000.0, saturated), 234568);
+  EXPECT_FALSE(saturated);
+  EXPECT_DOUBLE_EQ(dequantize(234568, 1e-3, 1000.0), 1234.568);
+  EXPECT_EQ(dequantize(-7, 0.5, 0.0), -3.5);
+}
+
+/**
+ * @brief int32 の範囲を超える値と NaN は飽和し、saturated を設定する
+ */
+TEST(QuantizationTest, Saturates) {
+  constexpr std::int32_t kMin = std::numeric_limits<std::int32_t>::min();
+  constexpr std::int32_t kMax = std::numeric_limits<std::int32_t>::max();
+  bool saturated = false;
+  EXPECT_EQ(quantize(2147483647.0, 1.0, 0.0, saturated), kMax);
+  EXPECT_EQ(quantize(-2147483648.0, 1.0, 0.0, saturated), kMin);
+  EXPECT_FALSE(saturated);
+
+  EXPECT_EQ(quantize(2147483647.6, 1.0, 0.0, saturated), kMax);
+  EXPECT_TRUE(saturated);
+  saturated = false;
+  EXPECT_EQ(quantize(-1e20, 1.0, 0.0, saturated), kMin);
+  EXPECT_TRUE(saturated);
+  saturated = false;
+  EXPECT_EQ(quantize(INFINITY, 1.0, 0.0, saturated), kMax);
+  EXPECT_TRUE(saturated);
+  saturated = false;
+  EXPECT_EQ(quantize(NAN, 1.0, 0.0, saturated), kMin);
+  EXPECT_TRUE(saturated);
+}
+
+/**
+ * @brief scale は正の有限値、offset は有限値でなければならない
+ */
+TEST(QuantizationTest, Validity) {
+  EXPECT_TRUE(kMillimetreQuantization.isValid());
+  EXPECT_EQ(kMillimetreQuantization.scale[2], 1e-3);
+  EXPECT_EQ(kMillimetreQuantization.offset[0], 0.0);
+  EXPECT_TRUE(Quantization::uniform(0.01, {-3.9e6, 3.3e6, 3.7e6}).isValid());
+  EXPECT_FALSE(Quantization::uniform(0.0).isValid());
+  EXPECT_FALSE(Quantization::uniform(-1e-3).isValid());
+  EXPECT_FALSE(Quantization::uniform(NAN).isValid());
+  EXPECT_FALSE(Quantization::uniform(1e-3, {0.0, INFINITY, 0.0}).isValid());
+}
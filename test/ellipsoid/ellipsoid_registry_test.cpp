@@ -0,0 +1,44 @@
+#include "ellipsoid/ellipsoid_registry.hpp"  // findEllipsoid の定義
+
+#include <set>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+namespace trans_geo::ellipsoid::test {
+/**
+ * @brief 楕円体・測地座標系のコードから楕円体を引ける
+ */
+TEST(EllipsoidRegistryTest, LookupByCode) {
+  static_assert(findEllipsoid(7030) == &kEllipsoidRegistry[0].ellipsoid);
+  static_assert(findEllipsoid(7030)->a == WGS84.a);
+
+  EXPECT_DOUBLE_EQ(ellipsoidFromEpsg(4326).f, WGS84.f);
+  EXPECT_DOUBLE_EQ(ellipsoidFromEpsg(6668).f, GRS80.f);
+  EXPECT_DOUBLE_EQ(ellipsoidFromEpsg(4301).a, Bessel1841.a);
+  EXPECT_DOUBLE_EQ(ellipsoidFromEpsg(4277).a, Airy1830.a);
+  EXPECT_DOUBLE_EQ(ellipsoidFromEpsg(4267).b, Clarke1866.b);
+
+  // 同じコードは常に同じ要素を返す
+  EXPECT_EQ(&ellipsoidFromEpsg(7019), findEllipsoid(7019));
+}
+
+/**
+ * @brief 未登録のコードは nullptr または例外になる
+ */
+TEST(EllipsoidRegistryTest, UnknownCode) {
+  EXPECT_EQ(findEllipsoid(0), nullptr);
+  EXPECT_THROW(ellipsoidFromEpsg(9999), std::out_of_range);
+}
+
+/**
+ * @brief 登録表のコードに重複がない
+ */
+TEST(EllipsoidRegistryTest, CodesAreUnique) {
+  std::set<int> codes;
+  for (const EllipsoidDefinition& definition : registeredEllipsoids()) {
+    EXPECT_TRUE(codes.insert(definition.epsgCode).second)
+        << definition.epsgCode;
+  }
+}
+}  // namespace trans_geo::ellipsoid::test
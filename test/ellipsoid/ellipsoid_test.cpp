@@ -30,4 +30,22 @@ TEST(EllipsoidTest, SphericalModel) {
   // 球体の場合、扁平率 f=0 なので離心率² は 0 となる
   EXPECT_DOUBLE_EQ(ellipsoid.e2, 0.0);
 }
+
+// 派生定数が定義どおりの値を持つことのテスト
+TEST(EllipsoidTest, DerivedConstants) {
+  const Ellipsoid& e = WGS84;
+  EXPECT_DOUBLE_EQ(e.b, 6356752.314245179);
+  EXPECT_DOUBLE_EQ(e.oneMinusE2, 1.0 - e.e2);
+  EXPECT_NEAR(e.oneMinusE2, (e.b / e.a) * (e.b / e.a), 1e-15);
+  EXPECT_DOUBLE_EQ(e.ep2, e.e2 / (1.0 - e.e2));
+  EXPECT_DOUBLE_EQ(e.a2, e.a * e.a);
+  EXPECT_DOUBLE_EQ(e.b2, e.b * e.b);
+  EXPECT_DOUBLE_EQ(e.invA * e.a, 1.0);
+  EXPECT_DOUBLE_EQ(e.aE2, e.a * e.e2);
+  EXPECT_DOUBLE_EQ(e.bEp2, e.b * e.ep2);
+
+  // コンパイル時に計算できる
+  static_assert(GRS80.b < GRS80.a);
+  static_assert(Ellipsoid(1.0, 0.0).ep2 == 0.0);
+}
 }  // namespace trans_geo::ellipsoid::test
\ No newline at end of file
@@ -0,0 +1,261 @@
+#include "geoid/geoid_grid.hpp"  // GeoidGrid の定義
+
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "converter/ECEF_to_geo_converter.hpp"  // ECEFToGeoConverter の定義
+#include "converter/ENU_to_geo_converter.hpp"   // ENUToGeoConverter の定義
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "converter/geo_to_ENU_converter.hpp"   // GeoToENUConverter の定義
+#include "coordinate/point_buffer.hpp"          // PointBuffer の定義
+#include "gtest/gtest.h"
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+namespace trans_geo::geoid::test {
+namespace {
+/**
+ * @brief 格子点の値を関数 f(緯度, 経度) から作る
+ */
+template <typename F>
+std::vector<std::byte> makeGrid(const GeoidGridLayout& layout, F f) {
+  std::vector<float> values;
+  for (std::uint32_t r = 0; r < layout.rows; ++r) {
+    for (std::uint32_t c = 0; c < layout.columns; ++c) {
+      values.push_back(static_cast<float>(
+          f(layout.south + r * layout.latitudeSpacing,
+            layout.west + c * layout.longitudeSpacing)));
+    }
+  }
+  return serializeGtx(layout, values);
+}
+
+/// 日本付近の 0.25° 格子
+const GeoidGridLayout kJapan{30.0, 128.0, 0.25, 0.25, 41, 57};
+
+double linear(double lat, double lon) {
+  return 30.0 + 0.5 * (lat - 30.0) - 0.25 * (lon - 128.0);
+}
+
+double quadratic(double lat, double lon) {
+  double y = lat - 35.0;
+  double x = lon - 135.0;
+  return 36.0 + 0.3 * y * y - 0.2 * x * y + 0.1 * x * x;
+}
+}  // namespace
+
+/**
+ * @brief ヘッダの読み出しと不正なバイト列
+ */
+TEST(GeoidGridTest, ParsesGtxHeader) {
+  std::vector<std::byte> bytes = makeGrid(kJapan, linear);
+  EXPECT_EQ(bytes.size(), kGtxHeaderSize + 41u * 57u * sizeof(float));
+  GeoidGrid grid{std::span<const std::byte>(bytes)};
+  const GeoidGridLayout& layout = grid.getLayout();
+  EXPECT_DOUBLE_EQ(layout.south, 30.0);
+  EXPECT_DOUBLE_EQ(layout.west, 128.0);
+  EXPECT_DOUBLE_EQ(layout.latitudeSpacing, 0.25);
+  EXPECT_EQ(layout.rows, 41u);
+  EXPECT_EQ(layout.columns, 57u);
+
+  std::span<const std::byte> truncated(bytes.data(), bytes.size() - 1);
+  EXPECT_THROW(GeoidGrid{truncated}, std::invalid_argument);
+  std::span<const std::byte> headerOnly(bytes.data(), 20);
+  EXPECT_THROW(GeoidGrid{headerOnly}, std::invalid_argument);
+  std::vector<float> one(1);
+  std::vector<std::byte> tiny =
+      serializeGtx({0.0, 0.0, 1.0, 1.0, 1, 1}, one);
+  EXPECT_THROW(GeoidGrid{std::span<const std::byte>(tiny)},
+               std::invalid_argument);
+  EXPECT_THROW(serializeGtx(kJapan, one), std::invalid_argument);
+}
+
+/**
+ * @brief 双線形補間は 1 次関数を、双 3 次補間は 2 次関数を再現する
+ */
+TEST(GeoidGridTest, InterpolatesPolynomials) {
+  std::vector<std::byte> linearBytes = makeGrid(kJapan, linear);
+  std::vector<std::byte> quadraticBytes = makeGrid(kJapan, quadratic);
+  GeoidGrid linearGrid{std::span<const std::byte>(linearBytes)};
+  GeoidGrid quadraticGrid{std::span<const std::byte>(quadraticBytes)};
+
+  for (double lat : {30.0, 33.13, 35.5, 39.99, 40.0}) {
+    for (double lon : {128.0, 131.37, 139.77, 142.0}) {
+      EXPECT_NEAR(linearGrid.undulation(lat, lon), linear(lat, lon), 1e-5);
+      EXPECT_NEAR(linearGrid.undulation(lat, lon, GeoidInterpolation::Bicubic),
+                  linear(lat, lon), 1e-5);
+    }
+  }
+  // 端の格子点を複製する境界を避けた内側の点
+  for (double lat : {31.1, 34.62, 37.9}) {
+    for (double lon : {129.3, 135.01, 140.8}) {
+      EXPECT_NEAR(
+          quadraticGrid.undulation(lat, lon, GeoidInterpolation::Bicubic),
+          quadratic(lat, lon), 1e-5);
+    }
+  }
+}
+
+/**
+ * @brief 範囲外と値のない格子点は NaN
+ */
+TEST(GeoidGridTest, OutOfRangeAndNoDataAreNaN) {
+  std::vector<std::byte> bytes =
+      makeGrid(kJapan, [](double lat, double lon) {
+        return lat == 35.0 && lon == 135.0 ? kGtxNoData : 40.0;
+      });
+  GeoidGrid grid{std::span<const std::byte>(bytes)};
+  EXPECT_TRUE(std::isnan(grid.undulation(29.9, 135.0)));
+  EXPECT_TRUE(std::isnan(grid.undulation(35.0, 142.1)));
+  EXPECT_TRUE(std::isnan(grid.undulation(35.0, -140.0)));
+  EXPECT_TRUE(std::isnan(grid.undulation(NAN, 135.0)));
+  EXPECT_TRUE(std::isnan(grid.undulation(35.1, 135.1)));
+  EXPECT_TRUE(std::isnan(
+      grid.undulation(35.4, 135.4, GeoidInterpolation::Bicubic)));
+  EXPECT_DOUBLE_EQ(grid.undulation(36.0, 136.0), 40.0);
+}
+
+/**
+ * @brief 360° を覆う格子は経度を周期的に扱う
+ */
+TEST(GeoidGridTest, GlobalGridWrapsLongitude) {
+  GeoidGridLayout global{-90.0, 0.0, 1.0, 1.0, 181, 360};
+  auto f = [](double lat, double lon) {
+    return 10.0 * std::cos(lon * M_PI / 180.0) + 0.1 * lat;
+  };
+  std::vector<std::byte> bytes = makeGrid(global, f);
+  GeoidGrid grid{std::span<const std::byte>(bytes)};
+
+  EXPECT_DOUBLE_EQ(grid.undulation(10.0, -0.5), grid.undulation(10.0, 359.5));
+  EXPECT_DOUBLE_EQ(grid.undulation(10.0, 720.25),
+                   grid.undulation(10.0, 0.25));
+  // 西端と東端の格子点の間
+  EXPECT_NEAR(grid.undulation(10.0, 359.5),
+              0.5 * (f(10.0, 359.0) + f(10.0, 0.0)), 1e-5);
+  EXPECT_NEAR(grid.undulation(0.0, -179.7, GeoidInterpolation::Bicubic),
+              f(0.0, 180.3), 2e-3);
+  EXPECT_NEAR(grid.undulation(90.0, 45.0), f(90.0, 45.0), 1e-5);
+}
+
+/**
+ * @brief 一括補間が 1 点ずつの補間と一致する（ブロック境界をまたぐ点数）
+ */
+TEST(GeoidGridTest, BatchMatchesScalar) {
+  std::vector<std::byte> bytes = makeGrid(kJapan, quadratic);
+  GeoidGrid grid{std::span<const std::byte>(bytes)};
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<double> lat(29.0, 41.0);
+  std::uniform_real_distribution<double> lon(127.0, 143.0);
+  PointBuffer geo(1000);
+  for (std::size_t i = 0; i < geo.size(); ++i) {
+    geo.view().set(i, {lat(rng), lon(rng), 0.0});
+  }
+
+  for (GeoidInterpolation method :
+       {GeoidInterpolation::Bilinear, GeoidInterpolation::Bicubic}) {
+    std::vector<double> fromView(geo.size());
+    std::vector<double> fromSpans(geo.size());
+    grid.undulations(geo.view(), fromView, method);
+    grid.undulations(geo.component(0), geo.component(1), fromSpans, method);
+    for (std::size_t i = 0; i < geo.size(); ++i) {
+      double expected =
+          grid.undulation(geo.view()(i, 0), geo.view()(i, 1), method);
+      if (std::isnan(expected)) {
+        EXPECT_TRUE(std::isnan(fromView[i]));
+        EXPECT_TRUE(std::isnan(fromSpans[i]));
+      } else {
+        EXPECT_DOUBLE_EQ(fromView[i], expected);
+        EXPECT_DOUBLE_EQ(fromSpans[i], expected);
+      }
+    }
+  }
+}
+
+/**
+ * @brief GTX ファイルをメモリマップして読む
+ */
+TEST(GeoidGridTest, MapsGtxFile) {
+  std::string path = ::testing::TempDir() + "geoid_grid_test.gtx";
+  std::vector<std::byte> bytes = makeGrid(kJapan, linear);
+  {
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(bytes.data()),
+              static_cast<std::streamsize>(bytes.size()));
+  }
+  GeoidGrid mapped(path);
+  GeoidGrid moved(std::move(mapped));
+  EXPECT_EQ(moved.getLayout().columns, 57u);
+  EXPECT_NEAR(moved.undulation(35.68, 139.77), linear(35.68, 139.77), 1e-5);
+  std::remove(path.c_str());
+
+  EXPECT_THROW(GeoidGrid(::testing::TempDir() + "missing.gtx"),
+               std::system_error);
+}
+
+/**
+ * @brief Geo の変換器で標高を扱う
+ */
+TEST(GeoidGridTest, ConvertersUseOrthometricHeights) {
+  static const std::vector<std::byte> bytes = makeGrid(kJapan, linear);
+  auto grid =
+      std::make_shared<const GeoidGrid>(std::span<const std::byte>(bytes));
+  double lat = 35.68;
+  double lon = 139.77;
+  double H = 40.0;
+  double N = linear(lat, lon);
+
+  GeoToECEFConverter ellipsoidal(WGS84);
+  GeoToECEFConverter orthometric(WGS84, grid);
+  std::array<double, 3> expected{};
+  std::array<double, 3> actual{};
+  ellipsoidal.convertPoint({lat, lon, H + N}, expected);
+  orthometric.convertPoint({lat, lon, H}, actual);
+  for (std::size_t k = 0; k < 3; ++k) {
+    EXPECT_NEAR(actual[k], expected[k], 1e-4);
+  }
+  auto object = orthometric.convert(GeoCoordinate(lat, lon, H));
+  EXPECT_NEAR(object->getValues()[0], expected[0], 1e-4);
+
+  ECEFToGeoConverter toGeo(WGS84, GeodeticPrecision::Reference, grid);
+  std::array<double, 3> geo{};
+  toGeo.convertPoint(actual, geo);
+  EXPECT_NEAR(geo[2], H, 1e-4);
+
+  // 複数ブロックの上書き一括変換と範囲外の点
+  PointBuffer points(600);
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    points.view().set(i, {31.0 + 0.01 * i, 130.0 + 0.015 * i, 0.1 * i});
+  }
+  points.view().set(599, {20.0, 130.0, 5.0});
+  PointBuffer original = points;
+  ASSERT_EQ(orthometric.convertBatch(points.view(), points.view()),
+            ConversionStatus::Ok);
+  ASSERT_EQ(toGeo.convertBatch(points.view(), points.view()),
+            ConversionStatus::Ok);
+  for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+    EXPECT_NEAR(points.view()(i, 0), original.view()(i, 0), 1e-9);
+    EXPECT_NEAR(points.view()(i, 2), original.view()(i, 2), 1e-4);
+  }
+  EXPECT_TRUE(std::isnan(points.view()(599, 2)));
+
+  // ENU を介した往復
+  GeoCoordinate origin(35.0, 135.0, 0.0);
+  GeoToENUConverter toEnu(WGS84, origin, grid, GeoidInterpolation::Bicubic);
+  ENUToGeoConverter fromEnu(WGS84, origin, grid, GeoidInterpolation::Bicubic);
+  std::array<double, 3> enu{};
+  toEnu.convertPoint({lat, lon, H}, enu);
+  fromEnu.convertPoint(enu, geo);
+  EXPECT_NEAR(geo[0], lat, 1e-9);
+  EXPECT_NEAR(geo[2], H, 1e-4);
+}
+
+}  // namespace trans_geo::geoid::test
@@ -0,0 +1,152 @@
+#include "instrumentation/instrumentation.hpp"
+
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "converter/ECEF_to_ENU_converter.hpp"  // ECEFToENUConverter の定義
+#include "converter/ECEF_to_geo_converter.hpp"  // ECEFToGeoConverter の定義
+#include "coordinate/ECEF_coordinate.hpp"       // ECEFCoordinate の定義
+#include "coordinate/geo_coordinate.hpp"        // GeoCoordinate の定義
+#include "ellipsoid/ellipsoid.hpp"              // Ellipsoid 構造体の定義
+#include "gtest/gtest.h"
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+namespace trans_geo::instrumentation::test {
+/**
+ * @brief 計測テスト用のフィクスチャ（各テスト前に計測値をリセット）
+ */
+class InstrumentationTest : public ::testing::Test {
+ protected:
+  void SetUp() override { reset(); }
+};
+
+/**
+ * @brief 計測が無効なビルドではスナップショットがすべて 0 となる
+ */
+TEST_F(InstrumentationTest, DisabledBuildReportsZero) {
+  if (kEnabled) {
+    GTEST_SKIP() << "instrumentation is enabled in this build";
+  }
+  ECEFToGeoConverter converter(WGS84);
+  converter.convert(ECEFCoordinate(WGS84.a, 0.0, 0.0));
+
+  Snapshot snap = snapshot();
+  EXPECT_FALSE(snap.enabled);
+  EXPECT_EQ(snap[ConverterId::ECEFToGeo][Operation::Convert].calls, 0u);
+}
+
+/**
+ * @brief 単点変換の呼び出し回数・レイテンシ・反復回数が記録される
+ */
+TEST_F(InstrumentationTest, RecordsConvertCallsAndIterations) {
+  if (!kEnabled) {
+    GTEST_SKIP() << "instrumentation is disabled in this build";
+  }
+  ECEFToGeoConverter converter(WGS84);
+  for (int i = 0; i < 5; ++i) {
+    converter.convert(ECEFCoordinate(WGS84.a + i, 100.0, 1000.0));
+  }
+
+  Snapshot snap = snapshot();
+  EXPECT_TRUE(snap.enabled);
+  const auto& stats = snap[ConverterId::ECEFToGeo];
+  EXPECT_EQ(stats[Operation::Convert].calls, 5u);
+  EXPECT_EQ(stats[Operation::Convert].points, 5u);
+  EXPECT_EQ(std::accumulate(stats[Operation::Convert].latency.begin(),
+                            stats[Operation::Convert].latency.end(),
+                            std::uint64_t{0}),
+            5u);
+  EXPECT_EQ(std::accumulate(stats.latitudeIterations.begin(),
+                            stats.latitudeIterations.end(), std::uint64_t{0}),
+            5u);
+  // 反復法は必ず 1 回以上反復する
+  EXPECT_EQ(stats.latitudeIterations[0], 0u);
+}
+
+/**
+ * @brief Bowring 法の一括変換は地心距離から決まるステップ数を点ごとに記録する
+ */
+TEST_F(InstrumentationTest, RecordsBowringStepsForBatch) {
+  if (!kEnabled) {
+    GTEST_SKIP() << "instrumentation is disabled in this build";
+  }
+  ECEFToGeoConverter converter(WGS84, GeodeticPrecision::Millimetre);
+  // 地表付近の 2 点は 1 ステップ、高度 1000 km の 1 点は 2 ステップ
+  std::vector<double> ecef = {WGS84.a, 0.0, 0.0, 0.0, WGS84.a, 0.0};
+  ecef.insert(ecef.end(), {WGS84.a + 1000e3, 0.0, 0.0});
+  ASSERT_EQ(converter.convertBatch(ConstPointView::interleaved(ecef.data(), 3),
+                                   PointView::interleaved(ecef.data(), 3)),
+            ConversionStatus::Ok);
+
+  Snapshot snap = snapshot();
+  const auto& stats = snap[ConverterId::ECEFToGeo];
+  EXPECT_EQ(stats[Operation::Batch].points, 3u);
+  EXPECT_EQ(stats.latitudeIterations[1], 2u);
+  EXPECT_EQ(stats.latitudeIterations[2], 1u);
+}
+
+/**
+ * @brief 一括変換では呼び出し回数と点数が別々に記録される
+ */
+TEST_F(InstrumentationTest, RecordsBatchPoints) {
+  if (!kEnabled) {
+    GTEST_SKIP() << "instrumentation is disabled in this build";
+  }
+  ECEFToENUConverter converter(WGS84, GeoCoordinate(0.0, 0.0));
+  std::vector<double> states(kStateVectorSize * 4, 0.0);
+  converter.convertStates(states, states);
+
+  Snapshot snap = snapshot();
+  const auto& stats = snap[ConverterId::ECEFToENU][Operation::Batch];
+  EXPECT_EQ(stats.calls, 1u);
+  EXPECT_EQ(stats.points, 4u);
+}
+
+/**
+ * @brief 終了済みスレッドの計測値もスナップショットに含まれる
+ */
+TEST_F(InstrumentationTest, AggregatesAcrossThreads) {
+  if (!kEnabled) {
+    GTEST_SKIP() << "instrumentation is disabled in this build";
+  }
+  constexpr int kThreads = 4;
+  constexpr int kCallsPerThread = 100;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([] {
+      ECEFToGeoConverter converter(WGS84);
+      for (int i = 0; i < kCallsPerThread; ++i) {
+        converter.convert(ECEFCoordinate(WGS84.a, 0.0, 0.0));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  Snapshot snap = snapshot();
+  const auto& stats = snap[ConverterId::ECEFToGeo][Operation::Convert];
+  EXPECT_EQ(stats.calls,
+            static_cast<std::uint64_t>(kThreads * kCallsPerThread));
+}
+
+/**
+ * @brief Prometheus テキスト形式の出力に主要な系列が含まれる
+ */
+TEST_F(InstrumentationTest, PrometheusTextContainsSeries) {
+  Snapshot snap;
+  snap.converters[static_cast<std::size_t>(ConverterId::GeoToECEF)]
+      .operations[static_cast<std::size_t>(Operation::Convert)]
+      .calls = 3;
+  std::string text = toPrometheusText(snap);
+  EXPECT_NE(text.find("transgeo_calls_total{converter=\"GeoToECEF\","
+                      "operation=\"convert\"} 3"),
+            std::string::npos);
+  EXPECT_NE(text.find("transgeo_latency_nanoseconds_count"),
+            std::string::npos);
+}
+}  // namespace trans_geo::instrumentation::test
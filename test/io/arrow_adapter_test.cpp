@@ -0,0 +1,190 @@
+#include "io/arrow_adapter.hpp"  // Arrow 連携の定義
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "gtest/gtest.h"
+
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+namespace trans_geo::io::test {
+namespace {
+/**
+ * @brief テスト用に手組みした float64 列 3 本のレコードバッチ
+ */
+struct ManualBatch {
+  std::array<std::vector<double>, 3> values;
+  std::array<std::array<const void*, 2>, 3> buffers{};
+  std::array<ArrowSchema, 3> childSchemas{};
+  std::array<ArrowSchema*, 3> childSchemaPointers{};
+  std::array<ArrowArray, 3> childArrays{};
+  std::array<ArrowArray*, 3> childArrayPointers{};
+  std::array<const void*, 1> parentBuffers{nullptr};
+  ArrowSchema schema{};
+  ArrowArray array{};
+
+  ManualBatch(std::array<std::vector<double>, 3> columns, int64_t offset,
+              int64_t childOffset)
+      : values(std::move(columns)) {
+    static const char* const kNames[] = {"lon", "lat", "h"};
+    auto noopSchema = [](ArrowSchema* s) { s->release = nullptr; };
+    auto noopArray = [](ArrowArray* a) { a->release = nullptr; };
+    int64_t childLength = static_cast<int64_t>(values[0].size());
+    for (std::size_t k = 0; k < 3; ++k) {
+      buffers[k] = {nullptr, values[k].data()};
+      childSchemas[k] = ArrowSchema{"g",     kNames[k], nullptr,
+                                    0,       0,         nullptr,
+                                    nullptr, noopSchema, nullptr};
+      childSchemaPointers[k] = &childSchemas[k];
+      childArrays[k] = ArrowArray{childLength, 0,       childOffset,
+                                  2,           0,       buffers[k].data(),
+                                  nullptr,     nullptr, noopArray,
+                                  nullptr};
+      childArrayPointers[k] = &childArrays[k];
+    }
+    schema = ArrowSchema{"+s",
+                         "",
+                         nullptr,
+                         0,
+                         3,
+                         childSchemaPointers.data(),
+                         nullptr,
+                         noopSchema,
+                         nullptr};
+    array = ArrowArray{childLength - childOffset - offset,
+                       0,
+                       offset,
+                       1,
+                       3,
+                       parentBuffers.data(),
+                       childArrayPointers.data(),
+                       nullptr,
+                       noopArray,
+                       nullptr};
+  }
+};
+}  // namespace
+
+/**
+ * @brief 親・子のオフセットを反映し、名前で列を対応付けて参照する
+ */
+TEST(ArrowAdapterTest, ViewsColumnsWithOffsets) {
+  ManualBatch batch({std::vector<double>{0, 0, 139.0, 140.0},
+                     std::vector<double>{0, 0, 35.0, 36.0},
+                     std::vector<double>{0, 0, 10.0, 20.0}},
+                    1, 1);
+  std::array<std::size_t, 3> columns = {findArrowColumn(batch.schema, "lat"),
+                                        findArrowColumn(batch.schema, "lon"),
+                                        findArrowColumn(batch.schema, "h")};
+  ConstPointView view = arrowPoints(batch.schema, batch.array, columns);
+  ASSERT_EQ(view.size(), 2u);
+  EXPECT_DOUBLE_EQ(view(0, 0), 35.0);
+  EXPECT_DOUBLE_EQ(view(0, 1), 139.0);
+  EXPECT_DOUBLE_EQ(view(1, 2), 20.0);
+  EXPECT_EQ(&view(0, 0), batch.values[1].data() + 2);
+
+  EXPECT_THROW(findArrowColumn(batch.schema, "z"), std::invalid_argument);
+}
+
+/**
+ * @brief 列のバッファをその場で変換できる
+ */
+TEST(ArrowAdapterTest, ConvertsInPlace) {
+  ManualBatch batch({std::vector<double>{35.0, -10.0},
+                     std::vector<double>{139.0, 20.0},
+                     std::vector<double>{10.0, 0.0}},
+                    0, 0);
+  trans_geo::conversion::GeoToECEFConverter converter(WGS84);
+  std::array<double, 3> expected{};
+  converter.convertPoint({35.0, 139.0, 10.0}, expected);
+
+  PointView view = arrowMutablePoints(batch.schema, batch.array);
+  ASSERT_EQ(converter.convertBatch(view, view),
+            trans_geo::conversion::ConversionStatus::Ok);
+  EXPECT_DOUBLE_EQ(batch.values[0][0], expected[0]);
+  EXPECT_DOUBLE_EQ(batch.values[1][0], expected[1]);
+  EXPECT_DOUBLE_EQ(batch.values[2][0], expected[2]);
+}
+
+/**
+ * @brief 参照できないレコードバッチを拒否する
+ */
+TEST(ArrowAdapterTest, RejectsUnsupportedBatches) {
+  std::array<std::vector<double>, 3> columns = {
+      std::vector<double>{1.0}, std::vector<double>{2.0},
+      std::vector<double>{3.0}};
+
+  ManualBatch wrongType(columns, 0, 0);
+  wrongType.childSchemas[1].format = "f";
+  EXPECT_THROW(arrowPoints(wrongType.schema, wrongType.array),
+               std::invalid_argument);
+
+  ManualBatch withNulls(columns, 0, 0);
+  std::uint8_t validity = 0;
+  withNulls.buffers[2][0] = &validity;
+  withNulls.childArrays[2].null_count = 1;
+  EXPECT_THROW(arrowPoints(withNulls.schema, withNulls.array),
+               std::invalid_argument);
+
+  ManualBatch outOfRange(columns, 0, 0);
+  EXPECT_THROW(arrowPoints(outOfRange.schema, outOfRange.array, {0, 1, 3}),
+               std::invalid_argument);
+
+  ManualBatch released(columns, 0, 0);
+  released.array.release(&released.array);
+  EXPECT_THROW(arrowPoints(released.schema, released.array),
+               std::invalid_argument);
+}
+
+/**
+ * @brief 座標列を列名付きのレコードバッチとして公開し、解放できる
+ */
+TEST(ArrowAdapterTest, ExportsWithoutCopy) {
+  PointBuffer points;
+  points.push_back({1.0, 2.0, 3.0});
+  points.push_back({4.0, 5.0, 6.0});
+  const double* data = points.component(1).data();
+
+  ArrowSchema schema;
+  ArrowArray array;
+  exportArrowPoints(std::move(points), CoordinateFrame::ECEF, &schema,
+                    &array);
+  ASSERT_EQ(array.length, 2);
+  EXPECT_STREQ(schema.children[1]->name, "y");
+  EXPECT_EQ(array.children[1]->buffers[1], data);
+
+  ConstPointView view = arrowPoints(schema, array);
+  EXPECT_DOUBLE_EQ(view(1, 2), 6.0);
+
+  schema.release(&schema);
+  array.release(&array);
+  EXPECT_EQ(schema.release, nullptr);
+  EXPECT_EQ(array.release, nullptr);
+}
+
+/**
+ * @brief 子列を移動した後も、親とは独立して解放できる
+ */
+TEST(ArrowAdapterTest, ExportedChildOutlivesParent) {
+  PointBuffer points;
+  points.push_back({1.0, 2.0, 3.0});
+  ArrowSchema schema;
+  ArrowArray array;
+  exportArrowPoints(std::move(points), CoordinateFrame::Geo, &schema, &array);
+  EXPECT_STREQ(schema.children[0]->name, "lat");
+
+  ArrowArray moved = *array.children[2];
+  array.children[2]->release = nullptr;
+  array.release(&array);
+  schema.release(&schema);
+
+  EXPECT_DOUBLE_EQ(static_cast<const double*>(moved.buffers[1])[0], 3.0);
+  moved.release(&moved);
+  EXPECT_EQ(moved.release, nullptr);
+}
+}  // namespace trans_geo::io::test
@@ -0,0 +1,97 @@
+#include "io/async_file_io.hpp"  // IAsyncFileIo の定義
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace trans_geo::io::test {
+namespace {
+/**
+ * @brief 実行中の環境で使える実装（Auto を除く）
+ */
+std::vector<AsyncIoBackend> availableBackends() {
+  std::vector<AsyncIoBackend> backends = {AsyncIoBackend::Threads};
+  if (asyncIoBackendAvailable(AsyncIoBackend::IoUring)) {
+    backends.push_back(AsyncIoBackend::IoUring);
+  }
+  return backends;
+}
+}  // namespace
+
+/**
+ * @brief 書き込んだ範囲を読み戻せ、完了は登録した tag ごとに 1 回ずつ届く
+ */
+TEST(AsyncFileIoTest, WriteThenReadBack) {
+  std::string path = ::testing::TempDir() + "async_file_io_test.bin";
+  for (AsyncIoBackend backend : availableBackends()) {
+    SCOPED_TRACE(asyncIoBackendName(backend));
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    ASSERT_GE(fd, 0);
+    std::unique_ptr<IAsyncFileIo> io = makeAsyncFileIo(backend, 4);
+    EXPECT_EQ(io->getBackend(), backend);
+
+    // 4 つのブロックを逆順の位置に書き込む（長さ 0 の要求を含む）
+    constexpr std::size_t kBlock = 10000;
+    std::vector<double> data(4 * kBlock);
+    std::iota(data.begin(), data.end(), 0.5);
+    for (std::size_t b = 0; b < 4; ++b) {
+      io->write(fd, data.data() + b * kBlock, sizeof(double) * kBlock,
+                sizeof(double) * kBlock * (3 - b), b);
+    }
+    EXPECT_EQ(io->pending(), 4u);
+    EXPECT_THROW(io->write(fd, data.data(), 0, 0, 9), std::length_error);
+    std::set<std::uint64_t> tags;
+    for (int i = 0; i < 4; ++i) {
+      tags.insert(io->wait());
+    }
+    EXPECT_EQ(tags, (std::set<std::uint64_t>{0, 1, 2, 3}));
+    EXPECT_EQ(io->pending(), 0u);
+    EXPECT_THROW(io->wait(), std::logic_error);
+
+    std::vector<double> back(4 * kBlock);
+    io->read(fd, back.data(), sizeof(double) * 4 * kBlock, 0, 7);
+    io->read(fd, back.data(), 0, 0, 8);
+    tags = {io->wait(), io->wait()};
+    EXPECT_EQ(tags, (std::set<std::uint64_t>{7, 8}));
+    for (std::size_t b = 0; b < 4; ++b) {
+      for (std::size_t i = 0; i < kBlock; ++i) {
+        ASSERT_EQ(back[(3 - b) * kBlock + i], data[b * kBlock + i]);
+      }
+    }
+
+    // ファイル末尾を超えた読み込みは EIO
+    io->read(fd, back.data(), sizeof(double), sizeof(double) * 4 * kBlock, 5);
+    EXPECT_THROW(io->wait(), std::system_error);
+    EXPECT_EQ(io->pending(), 0u);
+    ::close(fd);
+  }
+  std::remove(path.c_str());
+}
+
+/**
+ * @brief 不正な記述子への要求は wait() で std::system_error を送出する
+ */
+TEST(AsyncFileIoTest, BadDescriptorThrows) {
+  for (AsyncIoBackend backend : availableBackends()) {
+    SCOPED_TRACE(asyncIoBackendName(backend));
+    std::unique_ptr<IAsyncFileIo> io = makeAsyncFileIo(backend, 1);
+    double value = 0.0;
+    io->read(-1, &value, sizeof(value), 0, 0);
+    EXPECT_THROW(io->wait(), std::system_error);
+  }
+  EXPECT_THROW(makeAsyncFileIo(AsyncIoBackend::Threads, 0),
+               std::invalid_argument);
+  EXPECT_NE(makeAsyncFileIo(AsyncIoBackend::Auto, 1)->getBackend(),
+            AsyncIoBackend::Auto);
+}
+
+}  // namespace trans_geo::io::test
@@ -0,0 +1,145 @@
+#include "io/chunked_conversion.hpp"  // convertColumnarFile の定義
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "common/sample_points.hpp"             // テスト用の決定的な点列
+#include "converter/ECEF_to_geo_converter.hpp"  // ECEFToGeoConverter の定義
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "coordinate/point_buffer.hpp"          // PointBuffer の定義
+#include "gtest/gtest.h"
+#include "io/mapped_file.hpp"  // MappedFile の定義
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+namespace trans_geo::io::test {
+namespace {
+constexpr std::size_t kPoints = 10007;
+
+/**
+ * @brief 極付近を除く全球の緯度・経度・高度
+ */
+PointBuffer geoSamples(std::size_t size) {
+  return trans_geo::test::geoSamples(size, {-80.0, 80.0}, {-180.0, 180.0},
+                                     {0.0, 9000.0});
+}
+}  // namespace
+
+/**
+ * @brief チャンクの大きさ・キューの深さ・実装によらず、ファイル全体を
+ *        一度に convertBatch した結果と一致する
+ */
+TEST(ChunkedConversionTest, MatchesWholeFileConversion) {
+  std::string inputPath = ::testing::TempDir() + "chunked_input.tgeo";
+  std::string outputPath = ::testing::TempDir() + "chunked_output.tgeo";
+  PointBuffer geo = geoSamples(kPoints);
+  writeColumnarFile(inputPath, {CoordinateFrame::Geo, GRS80, std::nullopt},
+                    geo.view());
+  GeoToECEFConverter converter(GRS80);
+  PointBuffer expected(kPoints);
+  ASSERT_EQ(converter.convertBatch(geo.view(), expected.view()),
+            ConversionStatus::Ok);
+
+  std::vector<AsyncIoBackend> backends = {AsyncIoBackend::Threads};
+  if (asyncIoBackendAvailable(AsyncIoBackend::IoUring)) {
+    backends.push_back(AsyncIoBackend::IoUring);
+  }
+  for (AsyncIoBackend backend : backends) {
+    for (std::size_t chunkPoints : {std::size_t{1000}, kPoints, kPoints * 2}) {
+      for (std::size_t queueDepth : {1, 2, 3, 5}) {
+        SCOPED_TRACE(std::string(asyncIoBackendName(backend)) + " chunk " +
+                     std::to_string(chunkPoints) + " depth " +
+                     std::to_string(queueDepth));
+        ChunkedConversionReport report = convertColumnarFile(
+            inputPath, outputPath, converter,
+            {CoordinateFrame::ECEF, GRS80, std::nullopt},
+            {chunkPoints, queueDepth, backend});
+        EXPECT_EQ(report.backend, backend);
+        EXPECT_EQ(report.points, kPoints);
+        EXPECT_EQ(report.chunks, (kPoints + chunkPoints - 1) / chunkPoints);
+
+        MappedFile file(outputPath);
+        ColumnarReader reader(file.bytes());
+        EXPECT_EQ(reader.getFrame(), CoordinateFrame::ECEF);
+        EXPECT_EQ(reader.getEllipsoid().a, GRS80.a);
+        EXPECT_EQ(file.size(), columnarByteSize(kPoints));
+        ASSERT_EQ(reader.size(), kPoints);
+        for (std::size_t i = 0; i < kPoints; ++i) {
+          ASSERT_EQ(reader.getPoints().get(i), expected.view().get(i)) << i;
+        }
+      }
+    }
+  }
+  std::remove(inputPath.c_str());
+  std::remove(outputPath.c_str());
+}
+
+/**
+ * @brief 点のないファイルはヘッダだけを書き出す
+ */
+TEST(ChunkedConversionTest, EmptyFile) {
+  std::string inputPath = ::testing::TempDir() + "chunked_empty.tgeo";
+  std::string outputPath = ::testing::TempDir() + "chunked_empty_out.tgeo";
+  writeColumnarFile(inputPath, {CoordinateFrame::ECEF, WGS84, std::nullopt},
+                    ConstPointView::columns(nullptr, nullptr, nullptr, 0));
+  ChunkedConversionReport report =
+      convertColumnarFile(inputPath, outputPath, ECEFToGeoConverter(WGS84),
+                          {CoordinateFrame::Geo, WGS84, std::nullopt});
+  EXPECT_EQ(report.points, 0u);
+  EXPECT_EQ(report.chunks, 0u);
+  MappedFile file(outputPath);
+  EXPECT_EQ(ColumnarReader(file.bytes()).getFrame(), CoordinateFrame::Geo);
+  std::remove(inputPath.c_str());
+  std::remove(outputPath.c_str());
+}
+
+/**
+ * @brief 不正な設定・ファイルは例外を送出する
+ */
+TEST(ChunkedConversionTest, RejectsInvalidArguments) {
+  std::string inputPath = ::testing::TempDir() + "chunked_invalid.tgeo";
+  std::string outputPath = ::testing::TempDir() + "chunked_invalid_out.tgeo";
+  PointBuffer geo = geoSamples(10);
+  writeColumnarFile(inputPath, {CoordinateFrame::Geo, WGS84, std::nullopt},
+                    geo.view());
+  GeoToECEFConverter converter(WGS84);
+  ColumnarMetadata ecef{CoordinateFrame::ECEF, WGS84, std::nullopt};
+
+  EXPECT_THROW(convertColumnarFile(inputPath, outputPath, converter, ecef,
+                                   {0, 3, AsyncIoBackend::Auto}),
+               std::invalid_argument);
+  EXPECT_THROW(convertColumnarFile(inputPath, outputPath, converter, ecef,
+                                   {16, 0, AsyncIoBackend::Auto}),
+               std::invalid_argument);
+  EXPECT_THROW(convertColumnarFile(inputPath, inputPath, converter, ecef),
+               std::invalid_argument);
+  EXPECT_THROW(
+      convertColumnarFile(inputPath, outputPath, converter,
+                          {CoordinateFrame::ENU, WGS84, std::nullopt}),
+      std::invalid_argument);
+  EXPECT_THROW(convertColumnarFile(::testing::TempDir() + "no_such.tgeo",
+                                   outputPath, converter, ecef),
+               std::system_error);
+
+  // 列の途中で切れたファイル
+  std::string truncatedPath = ::testing::TempDir() + "chunked_truncated.tgeo";
+  {
+    MappedFile file(inputPath);
+    std::FILE* out = std::fopen(truncatedPath.c_str(), "wb");
+    std::fwrite(file.bytes().data(), 1, file.size() - 128, out);
+    std::fclose(out);
+  }
+  EXPECT_THROW(
+      convertColumnarFile(truncatedPath, outputPath, converter, ecef),
+      std::invalid_argument);
+  std::remove(inputPath.c_str());
+  std::remove(outputPath.c_str());
+  std::remove(truncatedPath.c_str());
+}
+
+}  // namespace trans_geo::io::test
@@ -0,0 +1,153 @@
+#include "io/columnar_format.hpp"  // ColumnarReader の定義
+
+#include <cstdio>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "converter/ECEF_to_geo_converter.hpp"  // ECEFToGeoConverter の定義
+#include "gtest/gtest.h"
+#include "io/mapped_file.hpp"  // MappedFile の定義
+
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+namespace trans_geo::io::test {
+/**
+ * @brief ECEF 座標列を書き込み、同じ値と楕円体を読み出せる
+ */
+TEST(ColumnarFormatTest, RoundTripECEF) {
+  std::vector<double> aos = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0};
+  std::vector<std::byte> buffer =
+      serializeColumnar({CoordinateFrame::ECEF, GRS80, std::nullopt},
+                        ConstPointView::interleaved(aos.data(), 3));
+
+  ColumnarReader reader(buffer);
+  EXPECT_EQ(reader.getFrame(), CoordinateFrame::ECEF);
+  EXPECT_DOUBLE_EQ(reader.getEllipsoid().a, GRS80.a);
+  EXPECT_DOUBLE_EQ(reader.getEllipsoid().f, GRS80.f);
+  EXPECT_FALSE(reader.getOrigin().has_value());
+  ASSERT_EQ(reader.size(), 3u);
+  EXPECT_DOUBLE_EQ(reader.getColumn(0)[2], 7.0);
+  EXPECT_DOUBLE_EQ(reader.getColumn(2)[1], 6.0);
+
+  // 列はバッファを直接参照し、64 バイトに整列している
+  ConstPointView points = reader.getPoints();
+  const auto* first = reinterpret_cast<const std::byte*>(points.component(0));
+  EXPECT_GE(first, buffer.data());
+  EXPECT_LT(first, buffer.data() + buffer.size());
+  EXPECT_EQ((first - buffer.data()) % kColumnAlignment, 0);
+  EXPECT_DOUBLE_EQ(points(1, 1), 5.0);
+}
+
+/**
+ * @brief ENU の原点はヘッダに一度だけ記録され、読み出せる
+ */
+TEST(ColumnarFormatTest, RoundTripENUOrigin) {
+  std::vector<double> e = {1.0}, n = {2.0}, u = {3.0};
+  std::vector<std::byte> buffer = serializeColumnar(
+      {CoordinateFrame::ENU, WGS84, GeoCoordinate(35.0, 139.0, 40.0)},
+      ConstPointView::columns(e.data(), n.data(), u.data(), 1));
+
+  ColumnarReader reader(buffer);
+  ASSERT_TRUE(reader.getOrigin().has_value());
+  EXPECT_DOUBLE_EQ(reader.getOrigin()->getLatitude(), 35.0);
+  EXPECT_DOUBLE_EQ(reader.getOrigin()->getLongitude(), 139.0);
+  EXPECT_DOUBLE_EQ(reader.getOrigin()->getAltitude().value(), 40.0);
+
+  // 原点なしの ENU は書き込めない
+  EXPECT_THROW(serializeColumnar({CoordinateFrame::ENU, WGS84, std::nullopt},
+                                 ConstPointView::columns(e.data(), n.data(),
+                                                         u.data(), 1)),
+               std::invalid_argument);
+}
+
+/**
+ * @brief 不正なバッファは検証で拒否される
+ */
+TEST(ColumnarFormatTest, RejectsCorruptBuffers) {
+  std::vector<double> aos = {1.0, 2.0, 3.0};
+  std::vector<std::byte> buffer =
+      serializeColumnar({CoordinateFrame::Geo, WGS84, std::nullopt},
+                        ConstPointView::interleaved(aos.data(), 1));
+
+  // ヘッダより短い
+  EXPECT_THROW(ColumnarReader(std::span(buffer).first(16)),
+               std::invalid_argument);
+
+  // 識別子の破損
+  std::vector<std::byte> badMagic = buffer;
+  badMagic[0] = std::byte{'X'};
+  EXPECT_THROW(ColumnarReader{badMagic}, std::invalid_argument);
+
+  // 点数がバッファを超える
+  std::vector<std::byte> badCount = buffer;
+  std::uint64_t hugeCount = 1u << 20;
+  std::memcpy(badCount.data() + offsetof(ColumnarHeader, pointCount),
+              &hugeCount, sizeof(hugeCount));
+  EXPECT_THROW(ColumnarReader{badCount}, std::invalid_argument);
+
+  // 最後の列の途中で途切れている
+  ColumnarHeader header;
+  std::memcpy(&header, buffer.data(), sizeof(header));
+  EXPECT_THROW(
+      ColumnarReader(std::span(buffer).first(header.columnOffsets[2] + 4)),
+      std::invalid_argument);
+}
+
+/**
+ * @brief 単独で作成したヘッダは serializeColumnar() の先頭と一致し、
+ *        parseColumnarHeader() で同じ配置として読み戻せる
+ */
+TEST(ColumnarFormatTest, HeaderOnlyLayout) {
+  std::vector<double> aos(3 * 5, 1.0);
+  ColumnarMetadata metadata{CoordinateFrame::ENU, GRS80,
+                            trans_geo::coordinate::GeoCoordinate(35.0, 139.0)};
+  std::vector<std::byte> buffer =
+      serializeColumnar(metadata, ConstPointView::interleaved(aos.data(), 5));
+  ColumnarHeader header = makeColumnarHeader(metadata, 5);
+  EXPECT_EQ(buffer.size(), columnarByteSize(5));
+  EXPECT_EQ(std::memcmp(buffer.data(), &header, sizeof(header)), 0);
+
+  ColumnarLayout layout = parseColumnarHeader(
+      std::span(buffer).first(sizeof(ColumnarHeader)), buffer.size());
+  EXPECT_EQ(layout.pointCount, 5u);
+  EXPECT_EQ(layout.metadata.frame, CoordinateFrame::ENU);
+  EXPECT_DOUBLE_EQ(layout.metadata.ellipsoid.f, GRS80.f);
+  ASSERT_TRUE(layout.metadata.origin.has_value());
+  EXPECT_DOUBLE_EQ(layout.metadata.origin->getLongitude(), 139.0);
+  for (std::size_t k = 0; k < kColumnCount; ++k) {
+    EXPECT_EQ(layout.columnOffsets[k], header.columnOffsets[k]);
+  }
+  // ファイルの大きさが列の末尾に届かない場合は不正
+  EXPECT_THROW(parseColumnarHeader(buffer, header.columnOffsets[2]),
+               std::invalid_argument);
+  EXPECT_THROW(
+      makeColumnarHeader({CoordinateFrame::ENU, GRS80, std::nullopt}, 5),
+      std::invalid_argument);
+}
+
+/**
+ * @brief マップしたファイルの列をそのまま一括変換に渡せる
+ */
+TEST(ColumnarFormatTest, MappedFileFeedsConverter) {
+  std::string path = ::testing::TempDir() + "columnar_format_test.tgeo";
+  std::vector<double> aos = {WGS84.a, 0.0, 0.0, 0.0, WGS84.a, 0.0};
+  writeColumnarFile(path, {CoordinateFrame::ECEF, WGS84, std::nullopt},
+                    ConstPointView::interleaved(aos.data(), 2));
+
+  MappedFile file(path);
+  ColumnarReader reader(file.bytes());
+  trans_geo::conversion::ECEFToGeoConverter converter(reader.getEllipsoid());
+  std::vector<double> geo(6, 0.0);
+  ASSERT_EQ(converter.convertBatch(reader.getPoints(),
+                                   PointView::interleaved(geo.data(), 2)),
+            trans_geo::conversion::ConversionStatus::Ok);
+  EXPECT_NEAR(geo[0], 0.0, 1e-9);
+  EXPECT_NEAR(geo[1], 0.0, 1e-9);
+  EXPECT_NEAR(geo[4], 90.0, 1e-9);
+  EXPECT_NEAR(geo[5], 0.0, 1e-6);
+  std::remove(path.c_str());
+}
+}  // namespace trans_geo::io::test
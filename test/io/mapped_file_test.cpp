@@ -0,0 +1,53 @@
+#include "io/mapped_file.hpp"  // MappedFile の定義
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+namespace trans_geo::io::test {
+/**
+ * @brief 書き込んだ内容をマップして読み出せる
+ */
+TEST(MappedFileTest, MapsFileContents) {
+  std::string path = ::testing::TempDir() + "mapped_file_test.bin";
+  {
+    std::ofstream out(path, std::ios::binary);
+    out << "TransGeo";
+  }
+  MappedFile file(path);
+  ASSERT_EQ(file.size(), 8u);
+  EXPECT_EQ(static_cast<char>(file.bytes()[0]), 'T');
+  EXPECT_EQ(static_cast<char>(file.bytes()[7]), 'o');
+
+  // ムーブ後も同じ領域を参照する
+  const std::byte* data = file.bytes().data();
+  MappedFile moved(std::move(file));
+  EXPECT_EQ(moved.bytes().data(), data);
+  EXPECT_TRUE(file.bytes().empty());
+  std::remove(path.c_str());
+}
+
+/**
+ * @brief 空ファイルは空の領域としてマップされる
+ */
+TEST(MappedFileTest, EmptyFile) {
+  std::string path = ::testing::TempDir() + "mapped_file_empty.bin";
+  { std::ofstream out(path, std::ios::binary); }
+  MappedFile file(path);
+  EXPECT_EQ(file.size(), 0u);
+  EXPECT_TRUE(file.bytes().empty());
+  std::remove(path.c_str());
+}
+
+/**
+ * @brief 存在しないファイルは std::system_error を送出する
+ */
+TEST(MappedFileTest, MissingFileThrows) {
+  EXPECT_THROW(MappedFile(::testing::TempDir() + "no_such_file.bin"),
+               std::system_error);
+}
+}  // namespace trans_geo::io::test
@@ -0,0 +1,76 @@
+#include "io/text_format.hpp"  // formatPoints の定義
+
+#include <string>
+#include <vector>
+
+#include "coordinate/ECEF_coordinate.hpp"  // ECEFCoordinate の定義
+#include "gtest/gtest.h"
+
+using namespace trans_geo::coordinate;
+
+namespace trans_geo::io::test {
+/**
+ * @brief 既定の書式は toString() と同じ固定小数点 6 桁の CSV となる
+ */
+TEST(TextFormatTest, DefaultMatchesToStringDigits) {
+  std::vector<double> aos = {-3957314.123456789, 3310254.5, 3737540.0,
+                             0.0000004,          -1e-7,     12.5};
+  std::vector<char> buffer(256);
+  FormatResult result = formatPoints(
+      ConstPointView::interleaved(aos.data(), 2), buffer);
+  ASSERT_EQ(result.points, 2u);
+
+  std::string text(buffer.data(), result.bytes);
+  EXPECT_EQ(text,
+            "-3957314.123457,3310254.500000,3737540.000000\n"
+            "0.000000,-0.000000,12.500000\n");
+  // toString() の各成分と同じ表記
+  EXPECT_EQ(ECEFCoordinate(aos[0], aos[1], aos[2]).toString(),
+            "[-3957314.123457, 3310254.500000, 3737540.000000]");
+}
+
+/**
+ * @brief 精度・区切り文字・終端文字を変更できる
+ */
+TEST(TextFormatTest, CustomOptions) {
+  std::vector<double> x = {1.25}, y = {2.5}, z = {0.1};
+  ConstPointView points =
+      ConstPointView::columns(x.data(), y.data(), z.data(), 1);
+  std::vector<char> buffer(64);
+  FormatResult result = formatPoints(points, buffer, {2, '\t', ';'});
+  EXPECT_EQ(std::string(buffer.data(), result.bytes), "1.25\t2.50\t0.10;");
+
+  // 最短表現は元の値に戻せる
+  result = formatPoints(points, buffer, {kShortestRoundTrip, ',', '\n'});
+  EXPECT_EQ(std::string(buffer.data(), result.bytes), "1.25,2.5,0.1\n");
+}
+
+/**
+ * @brief バッファに収まらない点は書き込まず、続きから再開できる
+ */
+TEST(TextFormatTest, StopsAtPointBoundary) {
+  std::vector<double> aos = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0};
+  ConstPointView points = ConstPointView::interleaved(aos.data(), 3);
+  // 1 点は "1.000000,2.000000,3.000000\n" の 27 バイト
+  std::vector<char> buffer(60);
+
+  std::string text;
+  std::size_t done = 0;
+  while (done < points.size()) {
+    FormatResult result = formatPoints(
+        points.subview(done, points.size() - done), buffer);
+    ASSERT_GT(result.points, 0u);
+    EXPECT_EQ(result.bytes, 27u * result.points);
+    text.append(buffer.data(), result.bytes);
+    done += result.points;
+  }
+  EXPECT_EQ(text,
+            "1.000000,2.000000,3.000000\n"
+            "4.000000,5.000000,6.000000\n"
+            "7.000000,8.000000,9.000000\n");
+
+  // 1 点も収まらない場合
+  std::vector<char> tiny(10);
+  EXPECT_EQ(formatPoints(points, tiny).points, 0u);
+}
+}  // namespace trans_geo::io::test
@@ -0,0 +1,135 @@
+#include "io/text_parse.hpp"  // parsePoints の定義
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace trans_geo::coordinate;
+
+namespace trans_geo::io::test {
+/**
+ * @brief 既定の設定で CSV の 3 列を解析する
+ */
+TEST(TextParseTest, ParsesDefaultColumns) {
+  std::string text =
+      "35.5,139.25,10\n"
+      " -12.0 ,\t+45.5, -3.25e2\r\n"
+      "\n"
+      "# comment\n"
+      "1e-3,2,3";
+  PointBuffer buffer;
+  ParseReport report = parsePoints(text, buffer);
+
+  EXPECT_EQ(report.points, 3u);
+  EXPECT_EQ(report.linesRead, 5u);
+  EXPECT_EQ(report.malformedRows, 0u);
+  EXPECT_EQ(report.consumedBytes, text.size());
+  ASSERT_EQ(buffer.size(), 3u);
+  EXPECT_DOUBLE_EQ(buffer.component(0)[0], 35.5);
+  EXPECT_DOUBLE_EQ(buffer.component(1)[1], 45.5);
+  EXPECT_DOUBLE_EQ(buffer.component(2)[1], -325.0);
+  EXPECT_DOUBLE_EQ(buffer.component(0)[2], 0.001);
+}
+
+/**
+ * @brief 列の対応付け・見出し行・欠けた成分の補完
+ */
+TEST(TextParseTest, ColumnMappingAndFill) {
+  std::string text =
+      "id;lon;lat\n"
+      "a;139.0;35.0\n"
+      "b;140.0;36.0\n";
+  TextParseOptions options;
+  options.delimiter = ';';
+  options.skipLines = 1;
+  options.columns = {2, 1, kNoColumn};
+  options.fillValue = 100.0;
+
+  PointBuffer buffer;
+  ParseReport report = parsePoints(text, buffer, options);
+  ASSERT_EQ(report.points, 2u);
+  EXPECT_DOUBLE_EQ(buffer.component(0)[1], 36.0);
+  EXPECT_DOUBLE_EQ(buffer.component(1)[1], 140.0);
+  EXPECT_DOUBLE_EQ(buffer.component(2)[0], 100.0);
+}
+
+/**
+ * @brief 空白区切りでは桁揃えの連続した空白・タブを 1 つの区切りとみなす
+ */
+TEST(TextParseTest, BlankDelimiterCollapsesRuns) {
+  std::string text =
+      "   1.0  2.0 3.0\n"
+      "-10.5\t \t20.25   -3  \n"
+      "7 8\n";
+  for (char delimiter : {' ', '\t'}) {
+    TextParseOptions options;
+    options.delimiter = delimiter;
+    PointBuffer buffer;
+    ParseReport report = parsePoints(text, buffer, options);
+    ASSERT_EQ(report.points, 2u);
+    EXPECT_DOUBLE_EQ(buffer.component(0)[0], 1.0);
+    EXPECT_DOUBLE_EQ(buffer.component(1)[0], 2.0);
+    EXPECT_DOUBLE_EQ(buffer.component(2)[0], 3.0);
+    EXPECT_DOUBLE_EQ(buffer.component(0)[1], -10.5);
+    EXPECT_DOUBLE_EQ(buffer.component(1)[1], 20.25);
+    EXPECT_DOUBLE_EQ(buffer.component(2)[1], -3.0);
+    // 列が足りない行は行末の空白を列に数えない
+    ASSERT_EQ(report.errors.size(), 1u);
+    EXPECT_EQ(report.errors[0].line, 3u);
+    EXPECT_EQ(report.errors[0].kind, ParseErrorKind::MissingField);
+  }
+}
+
+/**
+ * @brief 不正な行は例外を送出せず、読み飛ばして報告する
+ */
+TEST(TextParseTest, ReportsMalformedRows) {
+  std::string text =
+      "1,2,3\n"
+      "1,abc,3\n"
+      "4,5\n"
+      "6,7,8x\n"
+      "9,10,11\n";
+  PointBuffer buffer;
+  ParseReport report = parsePoints(text, buffer);
+
+  EXPECT_EQ(report.points, 2u);
+  EXPECT_EQ(report.malformedRows, 3u);
+  ASSERT_EQ(report.errors.size(), 3u);
+  EXPECT_EQ(report.errors[0].line, 2u);
+  EXPECT_EQ(report.errors[0].component, 1u);
+  EXPECT_EQ(report.errors[0].kind, ParseErrorKind::InvalidNumber);
+  EXPECT_EQ(report.errors[1].line, 3u);
+  EXPECT_EQ(report.errors[1].component, 2u);
+  EXPECT_EQ(report.errors[1].kind, ParseErrorKind::MissingField);
+  EXPECT_EQ(report.errors[2].kind, ParseErrorKind::InvalidNumber);
+  EXPECT_DOUBLE_EQ(buffer.component(0)[1], 9.0);
+
+  // 報告件数の上限
+  TextParseOptions options;
+  options.maxReportedErrors = 1;
+  PointBuffer limited;
+  report = parsePoints(text, limited, options);
+  EXPECT_EQ(report.malformedRows, 3u);
+  EXPECT_EQ(report.errors.size(), 1u);
+}
+
+/**
+ * @brief 出力が満杯になったら中断し、続きから再開できる
+ */
+TEST(TextParseTest, ResumesWhenOutputIsFull) {
+  std::string text = "1,1,1\n2,2,2\n3,3,3\n";
+  std::vector<double> out(6, 0.0);
+  PointView view = PointView::interleaved(out.data(), 2);
+
+  ParseReport first = parsePoints(text, view);
+  EXPECT_EQ(first.points, 2u);
+  EXPECT_EQ(first.consumedBytes, 12u);
+
+  ParseReport second =
+      parsePoints(std::string_view(text).substr(first.consumedBytes), view);
+  EXPECT_EQ(second.points, 1u);
+  EXPECT_DOUBLE_EQ(out[0], 3.0);
+}
+}  // namespace trans_geo::io::test
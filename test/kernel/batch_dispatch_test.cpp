@@ -0,0 +1,256 @@
+#include "kernel/batch_dispatch.hpp"  // BatchKernels の定義
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <string_view>
+#include <vector>
+
+#include "coordinate/point_view.hpp"    // PointView の定義
+#include "coordinate/quantization.hpp"  // quantize / dequantize の定義
+#include "gtest/gtest.h"
+#include "kernel/enu.hpp"       // ECEF ⇔ ENU のカーネル
+#include "kernel/geodetic.hpp"  // Geo ⇔ ECEF のカーネル
+
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+namespace trans_geo::kernel::test {
+namespace {
+constexpr std::array<Isa, 3> kAllIsas = {Isa::Generic, Isa::Avx2,
+                                         Isa::Avx512};
+
+/**
+ * @brief 緯度・経度・高度を格子状に並べた点列（極・日付変更線を含む）
+ */
+std::vector<double> geoSamples() {
+  std::vector<double> geo;
+  for (double lat = -90.0; lat <= 90.0; lat += 7.5) {
+    for (double lon = -180.0; lon <= 180.0; lon += 22.5) {
+      for (double h : {-100.0, 0.0, 5000.0, 400e3, 20000e3}) {
+        geo.insert(geo.end(), {lat, lon, h});
+      }
+    }
+  }
+  return geo;
+}
+}  // namespace
+
+/**
+ * @brief 使える版の表は自分の命令セットを返し、Generic は常に使える
+ */
+TEST(BatchDispatchTest, KernelTables) {
+  EXPECT_TRUE(isaSupported(Isa::Generic));
+  for (Isa isa : kAllIsas) {
+    const BatchKernels* kernels = batchKernelsFor(isa);
+    EXPECT_EQ(kernels != nullptr, isaSupported(isa)) << isaName(isa);
+    if (kernels != nullptr) {
+      EXPECT_EQ(kernels->isa, isa);
+    }
+  }
+  EXPECT_STREQ(isaName(Isa::Avx512), "avx512");
+  EXPECT_TRUE(isaSupported(batchKernels().isa));
+}
+
+/**
+ * @brief 選択した版は TRANSGEO_FORCE_ISA に従い、未指定なら最も新しい版になる
+ *
+ * ctest では環境変数を変えて同じテストを版ごとに実行する。
+ */
+TEST(BatchDispatchTest, SelectionHonoursOverride) {
+  const char* forced = std::getenv("TRANSGEO_FORCE_ISA");
+  Isa expected = Isa::Generic;
+  for (Isa isa : kAllIsas) {
+    if (isaSupported(isa)) {
+      expected = isa;
+    }
+  }
+  if (forced != nullptr) {
+    for (Isa isa : kAllIsas) {
+      if (std::string_view(forced) == isaName(isa) && isaSupported(isa)) {
+        expected = isa;
+      }
+    }
+  }
+  EXPECT_EQ(batchKernels().isa, expected) << isaName(batchKernels().isa);
+}
+
+/**
+ * @brief Geo → ECEF はどの版も点ごとのカーネルとビット単位で一致する（AoS）
+ */
+TEST(BatchDispatchTest, GeoToEcefMatchesScalarKernel) {
+  std::vector<double> geo = geoSamples();
+  std::size_t n = geo.size() / 3;
+  for (Isa isa : kAllIsas) {
+    const BatchKernels* kernels = batchKernelsFor(isa);
+    if (kernels == nullptr) {
+      continue;
+    }
+    std::vector<double> ecef(geo.size());
+    kernels->geoToEcef(WGS84,
+                       makeBatchSpan(ConstPointView::interleaved(geo.data(), n),
+                                     PointView::interleaved(ecef.data(), n)));
+    for (std::size_t i = 0; i < n; ++i) {
+      std::array<double, 3> expected =
+          geoToEcef(WGS84, geo[3 * i], geo[3 * i + 1], geo[3 * i + 2]);
+      for (std::size_t k = 0; k < 3; ++k) {
+        EXPECT_EQ(ecef[3 * i + k], expected[k])
+            << isaName(isa) << " point " << i;
+      }
+    }
+  }
+}
+
+/**
+ * @brief ECEF → Geo は 1 / 2 ステップの選択を含めて点ごとのカーネルと一致する
+ */
+TEST(BatchDispatchTest, EcefToGeoMatchesScalarKernel) {
+  std::vector<double> geo = geoSamples();
+  std::size_t n = geo.size() / 3;
+  std::vector<double> ecef(geo.size());
+  for (std::size_t i = 0; i < n; ++i) {
+    std::array<double, 3> p =
+        geoToEcef(WGS84, geo[3 * i], geo[3 * i + 1], geo[3 * i + 2]);
+    ecef[3 * i] = p[0];
+    ecef[3 * i + 1] = p[1];
+    ecef[3 * i + 2] = p[2];
+  }
+  // 地心（p = 0, Z = 0）も含める
+  ecef.insert(ecef.end(), {0.0, 0.0, 0.0});
+  n += 1;
+
+  double limit = 100e3;
+  double radiusSquared = (WGS84.b + limit) * (WGS84.b + limit);
+  for (Isa isa : kAllIsas) {
+    const BatchKernels* kernels = batchKernelsFor(isa);
+    if (kernels == nullptr) {
+      continue;
+    }
+    for (double threshold : {-1.0, radiusSquared}) {
+      std::vector<double> out(ecef.size());
+      kernels->ecefToGeo(
+          WGS84, threshold,
+          makeBatchSpan(ConstPointView::interleaved(ecef.data(), n),
+                        PointView::interleaved(out.data(), n)));
+      for (std::size_t i = 0; i < n; ++i) {
+        double X = ecef[3 * i];
+        double Y = ecef[3 * i + 1];
+        double Z = ecef[3 * i + 2];
+        int steps = (X * X + Y * Y + Z * Z) <= threshold ? 1 : 2;
+        std::array<double, 3> expected =
+            ecefToGeoBowring(WGS84, X, Y, Z, steps);
+        EXPECT_EQ(out[3 * i], expected[0]);
+        EXPECT_EQ(out[3 * i + 1], expected[1]);
+        EXPECT_EQ(out[3 * i + 2], expected[2])
+            << isaName(isa) << " point " << i;
+      }
+    }
+  }
+}
+
+/**
+ * @brief ECEF ⇔ ENU は点ごとのカーネルと一致し、上書き変換もできる
+ */
+TEST(BatchDispatchTest, EnuRotationInPlace) {
+  std::array<double, 9> R = enuRotation(35.0, 139.0);
+  std::array<double, 3> origin = geoToEcef(WGS84, 35.0, 139.0, 0.0);
+
+  // 1000 点は 1 ブロック（256 点）の倍数でない
+  std::size_t n = 1000;
+  std::vector<double> x(n), y(n), z(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    x[i] = origin[0] + 10.0 * static_cast<double>(i);
+    y[i] = origin[1] - 3.0 * static_cast<double>(i);
+    z[i] = origin[2] + 0.5 * static_cast<double>(i);
+  }
+  for (Isa isa : kAllIsas) {
+    const BatchKernels* kernels = batchKernelsFor(isa);
+    if (kernels == nullptr) {
+      continue;
+    }
+    std::vector<double> e = x, nn = y, u = z;
+    PointView view = PointView::columns(e.data(), nn.data(), u.data(), n);
+    kernels->ecefToEnu(R.data(), origin.data(), makeBatchSpan(view, view));
+    for (std::size_t i = 0; i < n; ++i) {
+      std::array<double, 3> expected =
+          ecefToEnu(R, origin, {x[i], y[i], z[i]});
+      EXPECT_EQ(e[i], expected[0]);
+      EXPECT_EQ(nn[i], expected[1]);
+      EXPECT_EQ(u[i], expected[2]);
+    }
+    kernels->enuToEcef(R.data(), origin.data(), makeBatchSpan(view, view));
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_NEAR(e[i], x[i], 1e-8) << isaName(isa) << " point " << i;
+      EXPECT_NEAR(nn[i], y[i], 1e-8);
+      EXPECT_NEAR(u[i], z[i], 1e-8);
+    }
+  }
+}
+
+/**
+ * @brief 量子化・逆量子化を融合した版は、どの版も double の版の結果を
+ *        quantize() した値・dequantize() した入力の結果と一致する
+ */
+TEST(BatchDispatchTest, FixedPointMatchesDoubleKernels) {
+  std::array<double, 9> R = enuRotation(35.0, 139.0);
+  std::array<double, 3> origin = geoToEcef(WGS84, 35.0, 139.0, 0.0);
+  // ミリメートルでは ±2147 km を超える成分が飽和する
+  FixedPointScale fixed = {{1e-3, 1e-3, 1e-3}, {0.0, 0.0, 0.0}};
+
+  std::size_t n = 1000;
+  std::vector<double> ecef(3 * n);
+  for (std::size_t i = 0; i < n; ++i) {
+    double d = 3000.0 * static_cast<double>(i);
+    ecef[3 * i] = origin[0] + d;
+    ecef[3 * i + 1] = origin[1] - 0.3 * d;
+    ecef[3 * i + 2] = origin[2] + 0.7 * d;
+  }
+  ecef[3 * 5] = NAN;
+  ConstPointView input = ConstPointView::interleaved(ecef.data(), n);
+
+  for (Isa isa : kAllIsas) {
+    const BatchKernels* kernels = batchKernelsFor(isa);
+    if (kernels == nullptr) {
+      continue;
+    }
+    std::vector<double> enu(3 * n);
+    kernels->ecefToEnu(
+        R.data(), origin.data(),
+        makeBatchSpan(input, PointView::interleaved(enu.data(), n)));
+    std::vector<std::int32_t> expected(3 * n);
+    std::size_t expectedSaturated = 0;
+    for (std::size_t j = 0; j < 3 * n; ++j) {
+      bool saturated = false;
+      expected[j] = quantize(enu[j], 1e-3, 0.0, saturated);
+      expectedSaturated += saturated ? 1 : 0;
+    }
+    ASSERT_GT(expectedSaturated, 3u);
+
+    std::vector<std::int32_t> quantized(3 * n);
+    EXPECT_EQ(kernels->ecefToEnuQuantized(
+                  R.data(), origin.data(), fixed,
+                  makeBatchSpan(input, QuantizedPointView::interleaved(
+                                           quantized.data(), n))),
+              expectedSaturated);
+    EXPECT_EQ(quantized, expected) << isaName(isa);
+
+    // 逆量子化して ECEF に戻す
+    std::vector<double> restored(3 * n);
+    for (std::size_t j = 0; j < 3 * n; ++j) {
+      restored[j] = dequantize(quantized[j], 1e-3, 0.0);
+    }
+    std::vector<double> back(3 * n), fusedBack(3 * n);
+    kernels->enuToEcef(
+        R.data(), origin.data(),
+        makeBatchSpan(ConstPointView::interleaved(restored.data(), n),
+                      PointView::interleaved(back.data(), n)));
+    kernels->enuToEcefDequantized(
+        R.data(), origin.data(), fixed,
+        makeBatchSpan(ConstQuantizedPointView::interleaved(quantized.data(),
+                                                           n),
+                      PointView::interleaved(fusedBack.data(), n)));
+    EXPECT_EQ(fusedBack, back) << isaName(isa);
+  }
+}
+}  // namespace trans_geo::kernel::test
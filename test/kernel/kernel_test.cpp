@@ -0,0 +1,94 @@
+#include <array>
+#include <cmath>
+
+#include "converter/ECEF_to_ENU_converter.hpp"  // ECEFToENUConverter の定義
+#include "converter/ECEF_to_geo_converter.hpp"  // ECEFToGeoConverter の定義
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "gtest/gtest.h"
+#include "kernel/enu.hpp"       // ECEF ⇔ ENU のカーネル
+#include "kernel/geodetic.hpp"  // Geo ⇔ ECEF のカーネル
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+namespace trans_geo::kernel::test {
+namespace {
+constexpr std::array<double, 9> kIdentity = {1, 0, 0, 0, 1, 0, 0, 0, 1};
+constexpr std::array<double, 3> kOrigin = {1, 2, 3};
+
+// 回転の適用はコンパイル時に評価できる
+static_assert(ecefToEnu(kIdentity, kOrigin, {4, 6, 8}) ==
+              std::array<double, 3>{3, 4, 5});
+static_assert(enuToEcef(kIdentity, kOrigin, {3, 4, 5}) ==
+              std::array<double, 3>{4, 6, 8});
+}  // namespace
+
+/**
+ * @brief geoToEcef() は GeoToECEFConverter と同じ値を返す
+ */
+TEST(KernelTest, GeoToEcefMatchesConverter) {
+  GeoToECEFConverter converter(WGS84);
+  for (const auto& geo : {std::array<double, 3>{35.0, 139.0, 10.0},
+                          std::array<double, 3>{-89.9, -179.0, 0.0},
+                          std::array<double, 3>{0.0, 0.0, -100.0}}) {
+    std::array<double, 3> expected{};
+    converter.convertPoint(geo, expected);
+    EXPECT_EQ(geoToEcef(WGS84, geo[0], geo[1], geo[2]), expected);
+  }
+}
+
+/**
+ * @brief ecefToGeoBowring() は Micrometre プリセットの変換器と同じ値を返す
+ */
+TEST(KernelTest, BowringMatchesMicrometrePreset) {
+  ECEFToGeoConverter converter(WGS84, GeodeticPrecision::Micrometre);
+  std::array<double, 3> ecef = geoToEcef(WGS84, 35.0, 139.0, 1000.0);
+  std::array<double, 3> expected{};
+  converter.convertPoint(ecef, expected);
+  EXPECT_EQ(ecefToGeoBowring(WGS84, ecef[0], ecef[1], ecef[2], 2), expected);
+  EXPECT_NEAR(expected[0], 35.0, 1e-9);
+  EXPECT_NEAR(expected[2], 1000.0, 1e-6);
+}
+
+/**
+ * @brief 反復法は収束した反復回数を返す
+ */
+TEST(KernelTest, IterativeLatitudeConverges) {
+  std::array<double, 3> ecef = geoToEcef(WGS84, 45.0, 10.0, 0.0);
+  double p = std::hypot(ecef[0], ecef[1]);
+  double lat = 0.0;
+  int iterations =
+      solveLatitudeIterative(WGS84, p, ecef[2], 1e-12, 100, lat);
+  EXPECT_GT(iterations, 0);
+  EXPECT_LT(iterations, 100);
+  EXPECT_NEAR(lat, M_PI / 4, 1e-12);
+}
+
+/**
+ * @brief enuRotation() は正規直交で、ECEFToENUConverter と同じ値を返す
+ */
+TEST(KernelTest, EnuRotationMatchesConverter) {
+  std::array<double, 9> R = enuRotation(35.0, 139.0);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      double dot = R[3 * i] * R[3 * j] + R[3 * i + 1] * R[3 * j + 1] +
+                   R[3 * i + 2] * R[3 * j + 2];
+      EXPECT_NEAR(dot, i == j ? 1.0 : 0.0, 1e-15);
+    }
+  }
+
+  ECEFToENUConverter converter(WGS84, GeoCoordinate(35.0, 139.0, 0.0));
+  std::array<double, 3> origin = geoToEcef(WGS84, 35.0, 139.0, 0.0);
+  std::array<double, 3> point = geoToEcef(WGS84, 35.01, 139.02, 50.0);
+  std::array<double, 3> expected{};
+  converter.convertPoint(point, expected);
+  std::array<double, 3> enu = ecefToEnu(R, origin, point);
+  EXPECT_EQ(enu, expected);
+
+  std::array<double, 3> back = enuToEcef(R, origin, enu);
+  for (int k = 0; k < 3; ++k) {
+    EXPECT_NEAR(back[k], point[k], 1e-8);
+  }
+}
+}  // namespace trans_geo::kernel::test
@@ -0,0 +1,163 @@
+#include "parallel/numa_executor.hpp"  // NumaExecutor の定義
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "common/sample_points.hpp"             // テスト用の決定的な点列
+#include "converter/ECEF_to_geo_converter.hpp"  // ECEFToGeoConverter の定義
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "coordinate/point_buffer.hpp"          // PointBuffer の定義
+#include "gtest/gtest.h"
+#include "parallel/numa_point_buffer.hpp"  // NumaPointBuffer の定義
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+namespace trans_geo::parallel::test {
+namespace {
+constexpr std::size_t kPoints = 10007;
+
+/**
+ * @brief 極付近を除く全球の緯度・経度・高度
+ */
+PointBuffer geoSamples(std::size_t size) {
+  return trans_geo::test::geoSamples(size, {-80.0, 80.0}, {-180.0, 180.0},
+                                     {0.0, 9000.0});
+}
+
+/**
+ * @brief 2 ノード・ノードあたり 2 スレッドに見せかけた構成（libnuma なし）
+ */
+NumaExecutor twoNodeExecutor(std::size_t blockPoints) {
+  NumaTopology topology({{0, {0}}, {1, {0}}}, false);
+  NumaExecutorOptions options;
+  options.threadsPerNode = 2;
+  options.blockPoints = blockPoints;
+  return NumaExecutor(topology, options);
+}
+}  // namespace
+
+/**
+ * @brief 検出した構成には CPU を持つノードが 1 つ以上ある
+ */
+TEST(NumaExecutorTest, DetectTopology) {
+  NumaTopology topology = NumaTopology::detect();
+  ASSERT_FALSE(topology.getNodes().empty());
+  for (const NumaNode& node : topology.getNodes()) {
+    EXPECT_FALSE(node.cpus.empty()) << node.id;
+  }
+  EXPECT_THROW(NumaTopology({}, false), std::invalid_argument);
+  EXPECT_THROW(NumaTopology({{0, {}}}, false), std::invalid_argument);
+
+  NumaExecutorOptions options;
+  options.blockPoints = 0;
+  EXPECT_THROW(NumaExecutor{options}, std::invalid_argument);
+}
+
+/**
+ * @brief runOnNodes はノードごとに指定した数のスレッドを 1 回ずつ実行する
+ */
+TEST(NumaExecutorTest, RunOnNodes) {
+  NumaExecutor executor = twoNodeExecutor(64);
+  std::atomic<int> calls[2][2] = {};
+  executor.runOnNodes(
+      [&](std::size_t node, std::size_t thread, std::size_t threadCount) {
+        EXPECT_EQ(threadCount, 2u);
+        ++calls[node][thread];
+      });
+  for (auto& node : calls) {
+    for (auto& thread : node) {
+      EXPECT_EQ(thread.load(), 1);
+    }
+  }
+}
+
+/**
+ * @brief チャンクは連続した区間ごとにノードへ割り当てられ、
+ *        assign / copyTo で元の点列に戻る
+ */
+TEST(NumaExecutorTest, BufferRoundTrip) {
+  NumaExecutor executor = twoNodeExecutor(64);
+  NumaPointBuffer buffer(executor, kPoints, 1000);
+  ASSERT_EQ(buffer.getChunkCount(), 11u);
+  EXPECT_EQ(buffer.chunk(10).size(), 7u);
+  EXPECT_EQ(buffer.getChunkNode(0), 0u);
+  EXPECT_EQ(buffer.getChunkNode(10), 1u);
+  for (std::size_t c = 1; c < buffer.getChunkCount(); ++c) {
+    EXPECT_LE(buffer.getChunkNode(c - 1), buffer.getChunkNode(c));
+  }
+  EXPECT_EQ(buffer.get(kPoints - 1), (std::array<double, 3>{0.0, 0.0, 0.0}));
+
+  PointBuffer geo = geoSamples(kPoints);
+  buffer.assign(geo.view());
+  PointBuffer back(kPoints);
+  buffer.copyTo(back.view());
+  for (std::size_t i = 0; i < kPoints; ++i) {
+    ASSERT_EQ(back.view().get(i), geo.view().get(i)) << i;
+    ASSERT_EQ(buffer.get(i), geo.view().get(i)) << i;
+  }
+  buffer.set(1234, {1.0, 2.0, 3.0});
+  EXPECT_EQ(buffer.get(1234), (std::array<double, 3>{1.0, 2.0, 3.0}));
+
+  PointBuffer wrong(kPoints - 1);
+  EXPECT_THROW(buffer.assign(wrong.view()), std::invalid_argument);
+  EXPECT_THROW(buffer.copyTo(wrong.view()), std::invalid_argument);
+  EXPECT_THROW(NumaPointBuffer(executor, kPoints, 0), std::invalid_argument);
+}
+
+/**
+ * @brief convert は convertBatch と一致し、ノードごとの点数の和が全点数になる
+ */
+TEST(NumaExecutorTest, ConvertMatchesBatch) {
+  GeoToECEFConverter toEcef(WGS84);
+  ECEFToGeoConverter toGeo(WGS84);
+  PointBuffer geo = geoSamples(kPoints);
+  PointBuffer ecef(kPoints);
+  PointBuffer expected(kPoints);
+  ASSERT_EQ(toEcef.convertBatch(geo.view(), ecef.view()), ConversionStatus::Ok);
+  ASSERT_EQ(toGeo.convertBatch(ecef.view(), expected.view()),
+            ConversionStatus::Ok);
+
+  for (const NumaExecutor& executor :
+       {twoNodeExecutor(333), NumaExecutor(NumaExecutorOptions{})}) {
+    NumaPointBuffer input(executor, kPoints, 1000);
+    NumaPointBuffer output(executor, kPoints, 1000);
+    input.assign(geo.view());
+
+    NumaRunReport report = executor.convert(toEcef, input, output);
+    ASSERT_EQ(report.status, ConversionStatus::Ok);
+    EXPECT_EQ(report.points, kPoints);
+    std::size_t points = 0;
+    for (const NodeThroughput& node : report.nodes) {
+      points += node.points;
+    }
+    EXPECT_EQ(points, kPoints);
+    EXPECT_EQ(report.nodes.size(), executor.getTopology().getNodes().size());
+
+    // 上書き変換
+    report = executor.convert(toGeo, output, output);
+    ASSERT_EQ(report.status, ConversionStatus::Ok);
+    for (std::size_t i = 0; i < kPoints; ++i) {
+      ASSERT_EQ(output.get(i), expected.view().get(i)) << i;
+    }
+  }
+}
+
+/**
+ * @brief 点数またはチャンクの大きさが異なるバッファは SizeMismatch
+ */
+TEST(NumaExecutorTest, SizeMismatch) {
+  NumaExecutor executor = twoNodeExecutor(64);
+  GeoToECEFConverter toEcef(WGS84);
+  NumaPointBuffer input(executor, kPoints, 1000);
+  NumaPointBuffer shorter(executor, kPoints - 1, 1000);
+  NumaPointBuffer rechunked(executor, kPoints, 500);
+  EXPECT_EQ(executor.convert(toEcef, input, shorter).status,
+            ConversionStatus::SizeMismatch);
+  EXPECT_EQ(executor.convert(toEcef, input, rechunked).status,
+            ConversionStatus::SizeMismatch);
+}
+
+}  // namespace trans_geo::parallel::test
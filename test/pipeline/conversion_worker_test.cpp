@@ -0,0 +1,77 @@
+#include "pipeline/conversion_worker.hpp"  // ConversionWorker の定義
+
+#include <array>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "gtest/gtest.h"
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::ellipsoid;
+
+namespace trans_geo::pipeline::test {
+/**
+ * @brief 入力リングの点を変換し、識別子を保って出力リングに渡す
+ */
+TEST(ConversionWorkerTest, ConvertsAndPreservesTags) {
+  constexpr std::uint64_t kCount = 10000;
+  GeoToECEFConverter converter(WGS84);
+  MpscRing<TaggedPoint> input(256);
+  SpscRing<TaggedPoint> output(64);
+  ConversionWorker worker(converter, input, output, 32);
+  worker.start();
+
+  std::thread producer([&] {
+    for (std::uint64_t i = 0; i < kCount; ++i) {
+      TaggedPoint fix{{35.0 + 1e-4 * static_cast<double>(i), 139.0, 10.0}, i};
+      while (!input.tryPush(fix)) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  std::uint64_t received = 0;
+  TaggedPoint result{};
+  while (received < kCount) {
+    if (!output.tryPop(result)) {
+      std::this_thread::yield();
+      continue;
+    }
+    ASSERT_EQ(result.tag, received);
+    std::array<double, 3> expected{};
+    converter.convertPoint(
+        {35.0 + 1e-4 * static_cast<double>(received), 139.0, 10.0}, expected);
+    ASSERT_EQ(result.values, expected);
+    ++received;
+  }
+  producer.join();
+  worker.stop();
+  EXPECT_EQ(worker.getConvertedCount(), kCount);
+  EXPECT_EQ(worker.getDroppedCount(), 0u);
+}
+
+/**
+ * @brief 停止時には入力に残った点を変換してから終了する
+ */
+TEST(ConversionWorkerTest, DrainsInputOnStop) {
+  GeoToECEFConverter converter(WGS84);
+  MpscRing<TaggedPoint> input(16);
+  SpscRing<TaggedPoint> output(16);
+  for (std::uint64_t i = 0; i < 10; ++i) {
+    ASSERT_TRUE(input.tryPush({{0.0, 0.0, 0.0}, i}));
+  }
+  {
+    ConversionWorker worker(converter, input, output, 4);
+    worker.start();
+    worker.stop();
+    EXPECT_EQ(worker.getConvertedCount(), 10u);
+  }
+  TaggedPoint results[16];
+  EXPECT_EQ(output.popBatch(results, 16), 10u);
+  EXPECT_DOUBLE_EQ(results[9].values[0], WGS84.a);
+  EXPECT_THROW(ConversionWorker(converter, input, output, 0),
+               std::invalid_argument);
+}
+}  // namespace trans_geo::pipeline::test
@@ -0,0 +1,113 @@
+#include "pipeline/ring_buffer.hpp"  // SpscRing / MpscRing の定義
+
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace trans_geo::pipeline::test {
+/**
+ * @brief 容量は 2 のべき乗に切り上げ、満杯・空を判定する
+ */
+TEST(RingBufferTest, SpscFullAndEmpty) {
+  SpscRing<int> ring(3);
+  EXPECT_EQ(ring.capacity(), 4u);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(ring.tryPush(i));
+  }
+  EXPECT_FALSE(ring.tryPush(4));
+
+  int values[8];
+  EXPECT_EQ(ring.popBatch(values, 3), 3u);
+  EXPECT_EQ(values[2], 2);
+  EXPECT_TRUE(ring.tryPush(5));
+  EXPECT_EQ(ring.popBatch(values, 8), 2u);
+  EXPECT_EQ(values[0], 3);
+  EXPECT_EQ(values[1], 5);
+  EXPECT_FALSE(ring.tryPop(values[0]));
+  EXPECT_THROW(SpscRing<int>(0), std::invalid_argument);
+}
+
+/**
+ * @brief 2 スレッド間で順序を保って受け渡す
+ */
+TEST(RingBufferTest, SpscPreservesOrderAcrossThreads) {
+  constexpr std::uint64_t kCount = 200000;
+  SpscRing<std::uint64_t> ring(64);
+  std::thread producer([&] {
+    for (std::uint64_t i = 0; i < kCount; ++i) {
+      while (!ring.tryPush(i)) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  std::uint64_t expected = 0;
+  std::uint64_t values[16];
+  while (expected < kCount) {
+    std::size_t n = ring.popBatch(values, 16);
+    for (std::size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(values[i], expected++);
+    }
+    if (n == 0) {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+}
+
+/**
+ * @brief 複数の生産者から追加した要素を、欠落・重複なく 1 回ずつ取り出す
+ */
+TEST(RingBufferTest, MpscDeliversEachItemOnce) {
+  constexpr std::uint64_t kProducers = 4;
+  constexpr std::uint64_t kPerProducer = 50000;
+  MpscRing<std::uint64_t> ring(128);
+  std::vector<std::thread> producers;
+  for (std::uint64_t p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&, p] {
+      for (std::uint64_t i = 0; i < kPerProducer; ++i) {
+        while (!ring.tryPush(p * kPerProducer + i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  std::vector<std::uint64_t> next(kProducers, 0);
+  std::uint64_t received = 0;
+  std::uint64_t values[32];
+  while (received < kProducers * kPerProducer) {
+    std::size_t n = ring.popBatch(values, 32);
+    for (std::size_t i = 0; i < n; ++i) {
+      // 生産者ごとの順序は保たれる
+      std::uint64_t p = values[i] / kPerProducer;
+      ASSERT_EQ(values[i] % kPerProducer, next[p]++);
+    }
+    received += n;
+    if (n == 0) {
+      std::this_thread::yield();
+    }
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  EXPECT_FALSE(ring.tryPop(values[0]));
+}
+
+/**
+ * @brief MPSC リングの満杯判定
+ */
+TEST(RingBufferTest, MpscFull) {
+  MpscRing<int> ring(2);
+  EXPECT_TRUE(ring.tryPush(1));
+  EXPECT_TRUE(ring.tryPush(2));
+  EXPECT_FALSE(ring.tryPush(3));
+  int value = 0;
+  EXPECT_TRUE(ring.tryPop(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_TRUE(ring.tryPush(3));
+}
+}  // namespace trans_geo::pipeline::test
@@ -0,0 +1,126 @@
+#include "pipeline/stages.hpp"  // パイプラインの各段の定義
+
+#include <array>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "converter/ECEF_to_ENU_converter.hpp"  // ECEFToENUConverter の定義
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "gtest/gtest.h"
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+namespace trans_geo::pipeline::test {
+namespace {
+/**
+ * @brief 指定した点数ずつ区切ったバッチを生成する（不定期な入力の模擬）
+ */
+BatchStream bursts(ConstPointView points, std::vector<std::size_t> sizes) {
+  std::size_t offset = 0;
+  for (std::size_t size : sizes) {
+    co_yield points.subview(offset, size);
+    offset += size;
+  }
+}
+
+PointBuffer makeGeoPoints(std::size_t count) {
+  PointBuffer points(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    double u = static_cast<double>(i) / static_cast<double>(count);
+    points.view().set(i, {35.0 + 0.01 * u, 139.0 + 0.02 * u, 10.0 * u});
+  }
+  return points;
+}
+}  // namespace
+
+/**
+ * @brief 小さなバッチをまとめ、大きなバッチはコピーせずに分割する
+ */
+TEST(PipelineStagesTest, CoalescesBurstyInput) {
+  PointBuffer points = makeGeoPoints(20);
+  std::vector<std::size_t> sizes;
+  std::vector<const double*> firsts;
+  for (ConstPointView batch : coalesce(
+           bursts(points.view(), {1, 2, 3, 10, 4}), 4)) {
+    sizes.push_back(batch.size());
+    firsts.push_back(&batch(0, 0));
+  }
+  EXPECT_EQ(sizes, (std::vector<std::size_t>{4, 4, 4, 4, 4}));
+
+  // 空の状態で届いた 4 点以上のバッチは入力をそのまま指す
+  EXPECT_NE(firsts[0], points.component(0).data());
+  EXPECT_EQ(firsts[2], points.component(0).data() + 8);
+
+  std::vector<std::size_t> tail;
+  for (ConstPointView batch : coalesce(bursts(points.view(), {3, 2}), 4)) {
+    tail.push_back(batch.size());
+  }
+  EXPECT_EQ(tail, (std::vector<std::size_t>{4, 1}));
+}
+
+/**
+ * @brief Geo → ECEF → ENU の段を連結した結果が直接の一括変換と一致する
+ */
+TEST(PipelineStagesTest, ComposesConverterStages) {
+  PointBuffer geo = makeGeoPoints(1000);
+  GeoToECEFConverter toEcef(WGS84);
+  ECEFToENUConverter toEnu(WGS84, GeoCoordinate(35.0, 139.0, 0.0));
+
+  PointBuffer expected(geo.size());
+  ASSERT_EQ(toEcef.convertBatch(geo.view(), expected.view()),
+            ConversionStatus::Ok);
+  ASSERT_EQ(toEnu.convertBatch(expected.view(), expected.view()),
+            ConversionStatus::Ok);
+
+  std::size_t index = 0;
+  for (ConstPointView batch : convertStage(
+           convertStage(viewSource(geo.view(), 64), toEcef), toEnu)) {
+    EXPECT_LE(batch.size(), 64u);
+    for (std::size_t i = 0; i < batch.size(); ++i, ++index) {
+      EXPECT_EQ(batch.get(i), ConstPointView(expected.view()).get(index));
+    }
+  }
+  EXPECT_EQ(index, geo.size());
+}
+
+/**
+ * @brief 容量の小さいキューでも、背圧で入力側を待たせて全点を処理する
+ */
+TEST(PipelineStagesTest, ChannelAppliesBackpressure) {
+  PointBuffer geo = makeGeoPoints(5000);
+  PointChannel channel(16);
+  std::thread producer([&] {
+    for (std::size_t i = 0; i < geo.size(); ++i) {
+      channel.push(ConstPointView(geo.view()).get(i));
+    }
+    channel.close();
+  });
+
+  GeoToECEFConverter toEcef(WGS84);
+  std::size_t received = 0;
+  for (ConstPointView batch :
+       convertStage(coalesce(channelSource(channel, 16), 64), toEcef)) {
+    EXPECT_LE(batch.size(), 64u);
+    std::array<double, 3> expected{};
+    toEcef.convertPoint(ConstPointView(geo.view()).get(received), expected);
+    EXPECT_EQ(batch.get(0), expected);
+    received += batch.size();
+  }
+  producer.join();
+  EXPECT_EQ(received, geo.size());
+  EXPECT_FALSE(channel.push({0.0, 0.0, 0.0}));
+}
+
+/**
+ * @brief 段の中で送出された例外は取り出す側で受け取る
+ */
+TEST(PipelineStagesTest, PropagatesStageErrors) {
+  PointBuffer geo = makeGeoPoints(4);
+  BatchStream stream = coalesce(viewSource(geo.view()), 0);
+  EXPECT_THROW(stream.begin(), std::invalid_argument);
+  EXPECT_THROW(PointChannel(0), std::invalid_argument);
+}
+}  // namespace trans_geo::pipeline::test
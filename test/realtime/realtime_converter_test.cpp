@@ -0,0 +1,89 @@
+#include "realtime/realtime_converter.hpp"  // RealtimeConverter の定義
+
+#include <array>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+
+#include "converter/ECEF_to_ENU_converter.hpp"  // ECEFToENUConverter の定義
+#include "converter/ECEF_to_geo_converter.hpp"  // ECEFToGeoConverter の定義
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "gtest/gtest.h"
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+namespace trans_geo::realtime::test {
+namespace {
+// 値型のみを扱い、例外を送出しない
+static_assert(std::is_trivially_copyable_v<GeoPoint>);
+static_assert(std::is_trivially_copyable_v<RealtimeConverter>);
+static_assert(noexcept(std::declval<const RealtimeConverter&>().toGeo(
+    std::declval<const ECEFPoint&>())));
+static_assert(noexcept(std::declval<const RealtimeConverter&>().toENU(
+    std::declval<const GeoPoint&>())));
+
+const GeoPoint kOrigin{35.0, 139.0, 0.0};
+}  // namespace
+
+/**
+ * @brief Geo ⇔ ECEF が既存の変換器（Micrometre プリセット）と一致する
+ */
+TEST(RealtimeConverterTest, MatchesConverters) {
+  RealtimeConverter rt(WGS84, kOrigin);
+  GeoToECEFConverter toEcef(WGS84);
+  ECEFToGeoConverter toGeo(WGS84, GeodeticPrecision::Micrometre);
+
+  std::array<double, 3> expected{};
+  toEcef.convertPoint({35.5, 139.5, 120.0}, expected);
+  ECEFPoint ecef = rt.toECEF(GeoPoint{35.5, 139.5, 120.0});
+  EXPECT_EQ((std::array<double, 3>{ecef.x, ecef.y, ecef.z}), expected);
+
+  std::array<double, 3> geo{};
+  toGeo.convertPoint(expected, geo);
+  GeoPoint back = rt.toGeo(ecef);
+  EXPECT_EQ((std::array<double, 3>{back.latitude, back.longitude,
+                                   back.altitude}),
+            geo);
+  EXPECT_NEAR(back.latitude, 35.5, 1e-10);
+  EXPECT_NEAR(back.altitude, 120.0, 1e-6);
+}
+
+/**
+ * @brief ENU が ECEFToENUConverter と一致し、往復で元に戻る
+ */
+TEST(RealtimeConverterTest, EnuRoundTrip) {
+  RealtimeConverter rt(WGS84, kOrigin);
+  ECEFToENUConverter reference(WGS84, GeoCoordinate(35.0, 139.0, 0.0));
+
+  GeoPoint geo{35.01, 139.02, 42.0};
+  ECEFPoint ecef = rt.toECEF(geo);
+  std::array<double, 3> expected{};
+  reference.convertPoint({ecef.x, ecef.y, ecef.z}, expected);
+  ENUPoint enu = rt.toENU(geo);
+  EXPECT_EQ((std::array<double, 3>{enu.east, enu.north, enu.up}), expected);
+
+  GeoPoint back = rt.toGeo(enu);
+  EXPECT_NEAR(back.latitude, geo.latitude, 1e-10);
+  EXPECT_NEAR(back.longitude, geo.longitude, 1e-10);
+  EXPECT_NEAR(back.altitude, geo.altitude, 1e-6);
+}
+
+/**
+ * @brief 地球中心・極・高高度でも有限の値を返す
+ */
+TEST(RealtimeConverterTest, DegenerateInputsStayFinite) {
+  RealtimeConverter rt(WGS84, kOrigin);
+  GeoPoint center = rt.toGeo(ECEFPoint{0.0, 0.0, 0.0});
+  EXPECT_TRUE(std::isfinite(center.latitude));
+  EXPECT_TRUE(std::isfinite(center.altitude));
+
+  GeoPoint pole = rt.toGeo(rt.toECEF(GeoPoint{90.0, 0.0, 100.0}));
+  EXPECT_NEAR(pole.latitude, 90.0, 1e-9);
+  EXPECT_NEAR(pole.altitude, 100.0, 1e-6);
+
+  GeoPoint geostationary = rt.toGeo(rt.toECEF(GeoPoint{0.1, 10.0, 35786e3}));
+  EXPECT_NEAR(geostationary.altitude, 35786e3, 1e-3);
+}
+}  // namespace trans_geo::realtime::test
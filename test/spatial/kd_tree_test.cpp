@@ -0,0 +1,235 @@
+#include "spatial/kd_tree.hpp"  // KdTree の定義
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "converter/ENU_to_ECEF_converter.hpp"  // ENUToECEFConverter の定義
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "gtest/gtest.h"
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+namespace trans_geo::spatial::test {
+namespace {
+/**
+ * @brief 東京周辺の地表付近に散らばる点を ECEF で生成する
+ */
+PointBuffer randomPoints(std::size_t n, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<double> lat(35.0, 36.0);
+  std::uniform_real_distribution<double> lon(139.0, 140.0);
+  std::uniform_real_distribution<double> h(0.0, 500.0);
+  PointBuffer geo(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    geo.view().set(i, {lat(rng), lon(rng), h(rng)});
+  }
+  PointBuffer ecef(n);
+  GeoToECEFConverter(WGS84).convertBatch(geo.view(), ecef.view());
+  return ecef;
+}
+
+double distance(const std::array<double, 3>& a,
+                const std::array<double, 3>& b) {
+  return std::sqrt((a[0] - b[0]) * (a[0] - b[0]) +
+                   (a[1] - b[1]) * (a[1] - b[1]) +
+                   (a[2] - b[2]) * (a[2] - b[2]));
+}
+
+/**
+ * @brief 全点との距離を計算して近い順に並べる
+ */
+std::vector<Neighbor> bruteForce(ConstPointView points,
+                                 const std::array<double, 3>& query) {
+  std::vector<Neighbor> all;
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    all.push_back(Neighbor{i, distance(points.get(i), query)});
+  }
+  std::sort(all.begin(), all.end(), [](const Neighbor& a, const Neighbor& b) {
+    return a.distance < b.distance;
+  });
+  return all;
+}
+}  // namespace
+
+/**
+ * @brief k 近傍が全探索と一致する
+ */
+TEST(KdTreeTest, NearestMatchesBruteForce) {
+  PointBuffer points = randomPoints(5000, 1);
+  PointBuffer queries = randomPoints(100, 2);
+  KdTree tree(points.view(), 8);
+  EXPECT_EQ(tree.size(), 5000u);
+
+  std::array<Neighbor, 5> result;
+  for (std::size_t q = 0; q < queries.size(); ++q) {
+    std::vector<Neighbor> expected = bruteForce(points.view(),
+                                                queries.view().get(q));
+    ASSERT_EQ(tree.nearest(queries.view().get(q), result), 5u);
+    for (std::size_t j = 0; j < result.size(); ++j) {
+      EXPECT_EQ(result[j].index, expected[j].index);
+      EXPECT_NEAR(result[j].distance, expected[j].distance, 1e-6);
+    }
+  }
+}
+
+/**
+ * @brief 半径探索が全探索と一致する
+ */
+TEST(KdTreeTest, WithinRadiusMatchesBruteForce) {
+  PointBuffer points = randomPoints(5000, 3);
+  KdTree tree(points.view());
+
+  std::vector<Neighbor> result;
+  for (std::size_t q = 0; q < 20; ++q) {
+    std::array<double, 3> query = points.view().get(q * 101);
+    std::vector<Neighbor> expected = bruteForce(points.view(), query);
+    expected.erase(std::find_if(expected.begin(), expected.end(),
+                                [](const Neighbor& n) {
+                                  return n.distance > 2000.0;
+                                }),
+                   expected.end());
+    tree.withinRadius(query, 2000.0, result);
+    ASSERT_EQ(result.size(), expected.size());
+    ASSERT_FALSE(result.empty());
+    EXPECT_EQ(result.front().index, q * 101);
+    EXPECT_DOUBLE_EQ(result.front().distance, 0.0);
+    for (std::size_t j = 0; j < result.size(); ++j) {
+      EXPECT_NEAR(result[j].distance, expected[j].distance, 1e-6);
+    }
+  }
+
+  tree.withinRadius(points.view().get(0), -1.0, result);
+  EXPECT_TRUE(result.empty());
+}
+
+/**
+ * @brief 点数が k より少ない場合と空の木
+ */
+TEST(KdTreeTest, FewerPointsThanK) {
+  std::array<double, 9> data = {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 5.0, 0.0, 0.0};
+  KdTree tree(ConstPointView::interleaved(data.data(), 3));
+  std::array<Neighbor, 5> result;
+  EXPECT_EQ(tree.nearest({4.0, 0.0, 0.0}, result), 3u);
+  EXPECT_EQ(result[0].index, 2u);
+  EXPECT_DOUBLE_EQ(result[0].distance, 1.0);
+  EXPECT_EQ(result[1].index, 1u);
+  EXPECT_EQ(result[2].index, 0u);
+  EXPECT_EQ(result[3].index, kNoNeighbor);
+
+  KdTree empty(ConstPointView{});
+  EXPECT_EQ(empty.size(), 0u);
+  EXPECT_EQ(empty.nearest({0.0, 0.0, 0.0}, result), 0u);
+  EXPECT_EQ(result[0].index, kNoNeighbor);
+}
+
+/**
+ * @brief 同じ座標の点が多数ある場合
+ */
+TEST(KdTreeTest, DuplicatePoints) {
+  PointBuffer points(100);
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    points.view().set(i, {1.0, 2.0, i < 90 ? 3.0 : 4.0});
+  }
+  KdTree tree(points.view(), 4);
+  std::vector<Neighbor> result;
+  tree.withinRadius({1.0, 2.0, 3.0}, 0.5, result);
+  EXPECT_EQ(result.size(), 90u);
+  std::array<Neighbor, 3> nearest;
+  EXPECT_EQ(tree.nearest({1.0, 2.0, 4.2}, nearest), 3u);
+  for (const Neighbor& neighbor : nearest) {
+    EXPECT_GE(neighbor.index, 90u);
+  }
+}
+
+/**
+ * @brief Geo / ENU の問い合わせを内部で ECEF に変換する
+ */
+TEST(KdTreeTest, GeoAndEnuQueries) {
+  PointBuffer points = randomPoints(2000, 4);
+  KdTree tree(points.view());
+  GeoToECEFConverter geoToEcef(WGS84);
+  GeoCoordinate origin(35.5, 139.5, 10.0);
+  ENUToECEFConverter enuToEcef(WGS84, origin);
+
+  std::array<double, 3> geo = {35.5, 139.5, 10.0};
+  std::array<double, 3> ecef{};
+  ASSERT_EQ(geoToEcef.convertPoint(geo, ecef), ConversionStatus::Ok);
+
+  std::array<Neighbor, 4> expected;
+  std::array<Neighbor, 4> fromGeo;
+  std::array<Neighbor, 4> fromEnu;
+  tree.nearest(ecef, expected);
+  EXPECT_EQ(tree.nearest(geo, geoToEcef, fromGeo), 4u);
+  EXPECT_EQ(tree.nearest({0.0, 0.0, 0.0}, enuToEcef, fromEnu), 4u);
+  for (std::size_t j = 0; j < expected.size(); ++j) {
+    EXPECT_EQ(fromGeo[j].index, expected[j].index);
+    EXPECT_EQ(fromEnu[j].index, expected[j].index);
+    EXPECT_NEAR(fromEnu[j].distance, expected[j].distance, 1e-6);
+  }
+
+  std::vector<Neighbor> radiusEcef;
+  std::vector<Neighbor> radiusEnu;
+  tree.withinRadius(ecef, 3000.0, radiusEcef);
+  tree.withinRadius({0.0, 0.0, 0.0}, enuToEcef, 3000.0, radiusEnu);
+  ASSERT_EQ(radiusEnu.size(), radiusEcef.size());
+  for (std::size_t j = 0; j < radiusEcef.size(); ++j) {
+    EXPECT_EQ(radiusEnu[j].index, radiusEcef[j].index);
+  }
+}
+
+/**
+ * @brief 並列の一括探索が 1 点ずつの探索と一致する
+ */
+TEST(KdTreeTest, NearestBatchMatchesSerial) {
+  PointBuffer points = randomPoints(3000, 5);
+  PointBuffer queries = randomPoints(257, 6);
+  KdTree tree(points.view());
+  constexpr std::size_t k = 3;
+
+  std::vector<Neighbor> parallel(queries.size() * k);
+  tree.nearestBatch(queries.view(), k, parallel, 4);
+  std::array<Neighbor, k> serial;
+  for (std::size_t q = 0; q < queries.size(); ++q) {
+    tree.nearest(queries.view().get(q), serial);
+    for (std::size_t j = 0; j < k; ++j) {
+      EXPECT_EQ(parallel[q * k + j].index, serial[j].index);
+    }
+  }
+
+  // Geo 入力の一括探索
+  PointBuffer geo(4);
+  for (std::size_t i = 0; i < geo.size(); ++i) {
+    geo.view().set(i, {35.1 + 0.2 * i, 139.3 + 0.1 * i, 0.0});
+  }
+  PointBuffer ecef(geo.size());
+  GeoToECEFConverter toEcef(WGS84);
+  toEcef.convertBatch(geo.view(), ecef.view());
+  std::vector<Neighbor> fromGeo(geo.size() * k);
+  std::vector<Neighbor> fromEcef(geo.size() * k);
+  EXPECT_EQ(tree.nearestBatch(geo.view(), toEcef, k, fromGeo, 2),
+            ConversionStatus::Ok);
+  tree.nearestBatch(ecef.view(), k, fromEcef, 1);
+  for (std::size_t j = 0; j < fromGeo.size(); ++j) {
+    EXPECT_EQ(fromGeo[j].index, fromEcef[j].index);
+  }
+
+  std::vector<Neighbor> wrong(5);
+  EXPECT_THROW(tree.nearestBatch(queries.view(), k, wrong),
+               std::invalid_argument);
+}
+
+/**
+ * @brief 不正な構築パラメータ
+ */
+TEST(KdTreeTest, InvalidLeafSize) {
+  PointBuffer points = randomPoints(10, 7);
+  EXPECT_THROW(KdTree(points.view(), 0), std::invalid_argument);
+}
+
+}  // namespace trans_geo::spatial::test
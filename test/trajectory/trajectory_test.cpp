@@ -0,0 +1,180 @@
+#include "trajectory/trajectory.hpp"  // Trajectory の定義
+
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "converter/ECEF_to_ENU_converter.hpp"  // ECEFToENUConverter の定義
+#include "converter/geo_to_ECEF_converter.hpp"  // GeoToECEFConverter の定義
+#include "gtest/gtest.h"
+
+using namespace trans_geo::conversion;
+using namespace trans_geo::coordinate;
+using namespace trans_geo::ellipsoid;
+
+namespace trans_geo::trajectory::test {
+namespace {
+std::array<double, 3> cubic(double t) {
+  return {t * t * t, 2.0 * t, 1.0 - t * t};
+}
+
+std::array<double, 3> cubicVelocity(double t) {
+  return {3.0 * t * t, 2.0, -2.0 * t};
+}
+}  // namespace
+
+/**
+ * @brief 線形補間と範囲外の時刻
+ */
+TEST(TrajectoryTest, LinearAndOutOfRange) {
+  Trajectory trajectory;
+  trajectory.append(0.0, {0.0, 0.0, 0.0});
+  trajectory.append(1.0, {10.0, 20.0, 30.0});
+  trajectory.append(3.0, {10.0, 0.0, 30.0});
+  EXPECT_EQ(trajectory.size(), 3u);
+  EXPECT_DOUBLE_EQ(trajectory.getEndTime(), 3.0);
+
+  std::vector<double> times = {-1.0, 0.0, 0.5, 1.0, 2.0, 3.0, 3.5};
+  PointBuffer output(times.size());
+  EXPECT_EQ(trajectory.interpolate(times, output.view(),
+                                   InterpolationMethod::Linear),
+            5u);
+  ConstPointView view = output.view();
+  EXPECT_TRUE(std::isnan(view(0, 0)));
+  EXPECT_EQ(view.get(2), (std::array<double, 3>{5.0, 10.0, 15.0}));
+  EXPECT_EQ(view.get(4), (std::array<double, 3>{10.0, 10.0, 30.0}));
+  EXPECT_EQ(view.get(5), (std::array<double, 3>{10.0, 0.0, 30.0}));
+  EXPECT_TRUE(std::isnan(view(6, 2)));
+}
+
+/**
+ * @brief 速度付きの Hermite 補間は 3 次式を厳密に再現する
+ */
+TEST(TrajectoryTest, HermiteWithVelocityIsExactForCubics) {
+  Trajectory trajectory;
+  for (double t : {0.0, 1.0, 2.5, 4.0}) {
+    trajectory.append(t, cubic(t), cubicVelocity(t));
+  }
+  std::vector<double> times = {0.25, 0.9, 1.7, 3.3, 4.0};
+  PointBuffer output(times.size());
+  trajectory.interpolate(times, output.view(), InterpolationMethod::Hermite);
+  for (std::size_t i = 0; i < times.size(); ++i) {
+    std::array<double, 3> expected = cubic(times[i]);
+    for (std::size_t k = 0; k < 3; ++k) {
+      EXPECT_NEAR(ConstPointView(output.view())(i, k), expected[k], 1e-12);
+    }
+  }
+}
+
+/**
+ * @brief スプラインと差分 Hermite は滑らかな軌跡を近似する
+ */
+TEST(TrajectoryTest, SplineAndEstimatedHermiteApproximateSmoothMotion) {
+  Trajectory trajectory;
+  for (int i = 0; i <= 40; ++i) {
+    double t = 0.25 * i;
+    trajectory.append(t, {std::cos(t), std::sin(t), 0.5 * t});
+  }
+  std::vector<double> times;
+  for (int i = 1; i < 200; ++i) {
+    times.push_back(0.05 * i);
+  }
+  PointBuffer spline(times.size());
+  PointBuffer hermite(times.size());
+  PointBuffer linear(times.size());
+  trajectory.interpolate(times, spline.view(),
+                         InterpolationMethod::CubicSpline);
+  trajectory.interpolate(times, hermite.view(), InterpolationMethod::Hermite);
+  trajectory.interpolate(times, linear.view(), InterpolationMethod::Linear);
+
+  double splineError = 0.0;
+  double hermiteError = 0.0;
+  double linearError = 0.0;
+  // 自然スプラインの端点条件の影響を避けて内部で比較する
+  for (std::size_t i = 20; i + 20 < times.size(); ++i) {
+    double expected = std::cos(times[i]);
+    splineError = std::max(splineError, std::fabs(spline.component(0)[i] -
+                                                  expected));
+    hermiteError = std::max(hermiteError, std::fabs(hermite.component(0)[i] -
+                                                    expected));
+    linearError = std::max(linearError, std::fabs(linear.component(0)[i] -
+                                                  expected));
+    EXPECT_NEAR(spline.component(2)[i], 0.5 * times[i], 1e-12);
+  }
+  EXPECT_LT(splineError, 1e-4);
+  EXPECT_LT(hermiteError, 2e-3);
+  EXPECT_LT(splineError, linearError);
+  EXPECT_LT(hermiteError, linearError);
+}
+
+/**
+ * @brief 昇順でない時刻列でも同じ結果になる
+ */
+TEST(TrajectoryTest, UnsortedQueries) {
+  Trajectory trajectory;
+  for (int i = 0; i < 10; ++i) {
+    trajectory.append(i, cubic(i));
+  }
+  std::vector<double> sorted = {0.5, 2.5, 4.5, 8.5, 9.0};
+  std::vector<double> shuffled = {8.5, 0.5, 9.0, 4.5, 2.5};
+  PointBuffer a(sorted.size());
+  PointBuffer b(shuffled.size());
+  trajectory.interpolate(sorted, a.view(), InterpolationMethod::CubicSpline);
+  trajectory.interpolate(shuffled, b.view(), InterpolationMethod::CubicSpline);
+  EXPECT_EQ(ConstPointView(b.view()).get(0), ConstPointView(a.view()).get(3));
+  EXPECT_EQ(ConstPointView(b.view()).get(1), ConstPointView(a.view()).get(0));
+  EXPECT_EQ(ConstPointView(b.view()).get(2), ConstPointView(a.view()).get(4));
+  EXPECT_EQ(ConstPointView(b.view()).get(4), ConstPointView(a.view()).get(1));
+}
+
+/**
+ * @brief 補間結果を一括変換器で ENU に変換する
+ */
+TEST(TrajectoryTest, InterpolatesIntoConverter) {
+  GeoToECEFConverter toEcef(WGS84);
+  Trajectory trajectory;
+  for (int i = 0; i < 5; ++i) {
+    std::array<double, 3> ecef{};
+    toEcef.convertPoint({89.9, 60.0 * i, 100.0}, ecef);
+    trajectory.append(i, ecef);
+  }
+
+  ECEFToENUConverter toEnu(WGS84, GeoCoordinate(89.9, 0.0, 100.0));
+  std::vector<double> times = {0.0, 0.5, 1.0, 10.0};
+  PointBuffer output(times.size());
+  InterpolationResult result = trajectory.interpolate(
+      times, output.view(), InterpolationMethod::Linear, toEnu);
+  ASSERT_EQ(result.status, ConversionStatus::Ok);
+  EXPECT_EQ(result.interpolated, 3u);
+  EXPECT_NEAR(output.component(0)[0], 0.0, 1e-6);
+  EXPECT_NEAR(output.component(1)[0], 0.0, 1e-6);
+  // ECEF の直線補間は極を回り込まずに弦を通る
+  EXPECT_GT(output.component(1)[1], 0.0);
+  // 範囲外の時刻は変換後も NaN
+  EXPECT_TRUE(std::isnan(output.component(0)[3]));
+}
+
+/**
+ * @brief 不正なサンプルと出力の検証
+ */
+TEST(TrajectoryTest, RejectsInvalidInput) {
+  Trajectory trajectory;
+  trajectory.append(1.0, {0.0, 0.0, 0.0});
+  EXPECT_THROW(trajectory.append(1.0, {1.0, 1.0, 1.0}),
+               std::invalid_argument);
+  EXPECT_THROW(trajectory.append(2.0, {1.0, 1.0, 1.0}, {0.0, 0.0, 0.0}),
+               std::invalid_argument);
+
+  std::vector<double> times = {1.0};
+  PointBuffer output(1);
+  EXPECT_THROW(trajectory.interpolate(times, output.view(),
+                                      InterpolationMethod::Linear),
+               std::invalid_argument);
+  trajectory.append(2.0, {1.0, 1.0, 1.0});
+  PointBuffer wrongSize(2);
+  EXPECT_THROW(trajectory.interpolate(times, wrongSize.view(),
+                                      InterpolationMethod::Linear),
+               std::invalid_argument);
+}
+}  // namespace trans_geo::trajectory::test